@@ -51,6 +51,10 @@
 #define configUSE_16_BIT_TICKS		0
 #define configIDLE_SHOULD_YIELD		0
 #define configUSE_CO_ROUTINES 		0
+#define configUSE_QUEUE_BATCH_TRANSFER 1
+#define configUSE_QUEUE_SIZED_COPY 1
+#define configUSE_BROADCAST_CHANNELS 1
+#define configUSE_STREAM_BUFFER_ZERO_COPY 1
 
 #define configGENERATE_RUN_TIME_STATS 1
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() ( vSetupRunTimeStatsTimer() )
@@ -0,0 +1,188 @@
+/* Environment includes. */
+#include "DriverLib.h"
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+
+#include "adc_capture.h"
+
+/* DEFINES */
+/* Sequencer 0 has an eight entry FIFO, so up to eight samples can be
+ * collected by one interrupt if it is delayed. */
+#define ADC_CAPTURE_SEQUENCER   ( 0 )
+#define ADC_CAPTURE_FIFO_DEPTH  ( 8 )
+
+/* GLOBALS */
+static StreamBufferHandle_t s_capture_buffer = NULL;
+static size_t s_block_bytes = 0;
+/* Block being filled by the interrupt. 's_fill' is NULL while the interrupt
+ * is waiting for a free block. */
+static uint16_t *s_fill = NULL;
+static size_t s_fill_count = 0;
+static size_t s_block_samples = 0;
+/* Counters */
+static volatile ADCCaptureStats_t s_stats = { 0 };
+
+/* HANDLERS */
+static void vADCCapture_Handler(void);
+
+/* FUNCTIONS */
+static uint16_t *prvGetFreeBlock(void);
+
+BaseType_t xADCCaptureInit(unsigned long channel, unsigned long sample_rate_hz,
+    size_t block_samples, size_t blocks)
+{
+    configASSERT(s_capture_buffer == NULL);
+    configASSERT(block_samples > 0);
+    configASSERT(blocks >= ADC_CAPTURE_MIN_BLOCKS);
+
+    /* A stream buffer always keeps one byte free, so its storage area is made
+     * one block longer than needed, less that byte. The storage area is then
+     * an exact number of blocks and, as whole blocks are always written and
+     * consumed, a block never wraps past its end. */
+    s_block_samples = block_samples;
+    s_block_bytes = block_samples * sizeof(uint16_t);
+    s_capture_buffer = xStreamBufferCreate(((blocks + 1) * s_block_bytes) - 1,
+        s_block_bytes);
+    if (s_capture_buffer == NULL)
+        return pdFAIL;
+
+    /* Timer1 triggers one conversion every sample period. */
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER1);
+    TimerConfigure(TIMER1_BASE, TIMER_CFG_32_BIT_PER);
+    TimerLoadSet(TIMER1_BASE, TIMER_A, configCPU_CLOCK_HZ / sample_rate_hz);
+    TimerControlTrigger(TIMER1_BASE, TIMER_A, true);
+
+    /* Sequencer 0 converts 'channel' once per trigger and interrupts when the
+     * sample is in its FIFO. */
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC);
+    ADCSequenceConfigure(ADC_BASE, ADC_CAPTURE_SEQUENCER, ADC_TRIGGER_TIMER, 0);
+    ADCSequenceStepConfigure(ADC_BASE, ADC_CAPTURE_SEQUENCER, 0,
+        channel | ADC_CTL_IE | ADC_CTL_END);
+    ADCSequenceEnable(ADC_BASE, ADC_CAPTURE_SEQUENCER);
+
+    /* The handler uses the FreeRTOS API, so it must not run above
+     * configMAX_SYSCALL_INTERRUPT_PRIORITY. */
+    ADCIntRegister(ADC_BASE, ADC_CAPTURE_SEQUENCER, vADCCapture_Handler);
+    IntPrioritySet(INT_ADC0, configKERNEL_INTERRUPT_PRIORITY);
+    ADCIntEnable(ADC_BASE, ADC_CAPTURE_SEQUENCER);
+
+    return pdPASS;
+}
+
+void vADCCaptureStart(void)
+{
+    configASSERT(s_capture_buffer != NULL);
+
+    ADCIntClear(ADC_BASE, ADC_CAPTURE_SEQUENCER);
+    IntEnable(INT_ADC0);
+    TimerEnable(TIMER1_BASE, TIMER_A);
+}
+
+void vADCCaptureStop(void)
+{
+    TimerDisable(TIMER1_BASE, TIMER_A);
+    IntDisable(INT_ADC0);
+}
+
+/** pusADCCaptureReceive
+ * Blocks are committed whole and never wrap, so any data in the buffer is at
+ * least one complete, contiguous block starting at the read position.
+ */
+const uint16_t *pusADCCaptureReceive(TickType_t ticks_to_wait)
+{
+    StreamBufferWindow_t window;
+
+    if (xStreamBufferGetReadWindow(s_capture_buffer, &window, ticks_to_wait)
+        < s_block_bytes)
+        return NULL;
+
+    return (const uint16_t *)window.pucFirst;
+}
+
+void vADCCaptureRelease(void)
+{
+    xStreamBufferConsume(s_capture_buffer, s_block_bytes);
+}
+
+void vADCCaptureGetStats(ADCCaptureStats_t *stats)
+{
+    taskENTER_CRITICAL();
+    {
+        stats->ulBlocks = s_stats.ulBlocks;
+        stats->ulOverruns = s_stats.ulOverruns;
+        stats->ulSamplesDropped = s_stats.ulSamplesDropped;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/** prvGetFreeBlock
+ * Returns the next free block of the capture buffer, or NULL if the
+ * processing task still holds all of them. Called from the interrupt only.
+ */
+static uint16_t *prvGetFreeBlock(void)
+{
+    StreamBufferWindow_t window;
+
+    if (xStreamBufferGetWriteWindowFromISR(s_capture_buffer, &window)
+        < s_block_bytes)
+        return NULL;
+
+    return (uint16_t *)window.pucFirst;
+}
+
+/** vADCCapture_Handler
+ * \brief Move every sample in the sequencer FIFO into the block being filled
+ * and hand the block to the processing task once it is full. Samples that
+ * arrive while no block is free are counted and dropped.
+ */
+static void vADCCapture_Handler(void)
+{
+    unsigned long samples[ADC_CAPTURE_FIFO_DEPTH];
+    long count, i;
+    BaseType_t higher_priority_task_woken = pdFALSE;
+
+    ADCIntClear(ADC_BASE, ADC_CAPTURE_SEQUENCER);
+
+    /* The FIFO filled up before this interrupt ran, so conversions were lost
+     * in hardware. How many is unknown. */
+    if (ADCSequenceOverflow(ADC_BASE, ADC_CAPTURE_SEQUENCER))
+    {
+        HWREG(ADC_BASE + ADC_O_OSTAT) = 1 << ADC_CAPTURE_SEQUENCER;
+        s_stats.ulOverruns++;
+    }
+
+    count = ADCSequenceDataGet(ADC_BASE, ADC_CAPTURE_SEQUENCER, samples);
+
+    for (i = 0; i < count; i++)
+    {
+        if (s_fill == NULL)
+        {
+            s_fill = prvGetFreeBlock();
+            if (s_fill == NULL)
+            {
+                /* The task has fallen behind. Drop what is left in the
+                 * FIFO and try again on the next interrupt. */
+                s_stats.ulOverruns++;
+                s_stats.ulSamplesDropped += count - i;
+                break;
+            }
+        }
+
+        s_fill[s_fill_count++] = (uint16_t)samples[i];
+
+        /* Publish a full block with a single notification. */
+        if (s_fill_count == s_block_samples)
+        {
+            xStreamBufferCommitWriteFromISR(s_capture_buffer, s_block_bytes,
+                &higher_priority_task_woken);
+            s_stats.ulBlocks++;
+            s_fill = NULL;
+            s_fill_count = 0;
+        }
+    }
+
+    portEND_SWITCHING_ISR(higher_priority_task_woken);
+}
@@ -0,0 +1,55 @@
+#ifndef ADC_CAPTURE_H
+#define ADC_CAPTURE_H
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "stream_buffer.h"
+
+/* ADC capture service.
+ *
+ * Timer1 triggers ADC sample sequencer 0 at a fixed rate and the sequencer
+ * interrupt writes each sample straight into a block of a stream buffer's
+ * storage area. Only whole blocks are handed to the processing task, with
+ * one notification per block instead of one per sample, and the task
+ * processes a block where it is while the interrupt fills the next one.
+ * Requires configUSE_STREAM_BUFFER_ZERO_COPY. */
+
+/* Number of blocks that can be in use at the same time: one being filled by
+ * the interrupt, one being processed by the task, and any waiting between
+ * them. Two gives classic double buffering. */
+#define ADC_CAPTURE_MIN_BLOCKS  ( 2 )
+
+/* Counters kept by the capture interrupt. */
+typedef struct
+{
+    uint32_t ulBlocks;          /* Blocks handed to the processing task. */
+    uint32_t ulOverruns;        /* Times samples were lost, either because no
+                                 * block was free or because the ADC FIFO
+                                 * overflowed. */
+    uint32_t ulSamplesDropped;  /* Samples dropped because no block was
+                                 * free. */
+} ADCCaptureStats_t;
+
+/* Allocates the capture buffer and configures the ADC and Timer1 to sample
+ * 'channel' (one of ADC_CTL_CH0..ADC_CTL_CH3) at 'sample_rate_hz'. Samples
+ * are handed over in blocks of 'block_samples', and up to 'blocks' blocks can
+ * be in use at once. Returns pdFAIL if the buffer could not be allocated. */
+BaseType_t xADCCaptureInit(unsigned long channel, unsigned long sample_rate_hz,
+    size_t block_samples, size_t blocks);
+
+/* Starts and stops sampling. */
+void vADCCaptureStart(void);
+void vADCCaptureStop(void);
+
+/* Waits up to 'ticks_to_wait' for a complete block and returns a pointer to
+ * its samples, which stay valid until vADCCaptureRelease() is called. Returns
+ * NULL on timeout. Only one task may receive blocks. */
+const uint16_t *pusADCCaptureReceive(TickType_t ticks_to_wait);
+
+/* Returns the block obtained from pusADCCaptureReceive() to the interrupt. */
+void vADCCaptureRelease(void);
+
+/* Copies the capture counters into 'stats'. */
+void vADCCaptureGetStats(ADCCaptureStats_t *stats);
+
+#endif /* ADC_CAPTURE_H */
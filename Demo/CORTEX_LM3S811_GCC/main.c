@@ -5,6 +5,8 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
+#include "broadcast.h"
+#include "adc_capture.h"
 #include "timer.h"
 
 /* DEFINES */
@@ -19,10 +21,15 @@
 #define INITIAL_TEMP_DECIMALS   ( (MAX_TEMP_DECIMALS + MIN_TEMP_DECIMALS) / 2 )
 #define TEMP_DECIMALS_STEP      ( 30 )
 #define TEMP_QUEUE_SIZE         ( 3 )
+#define AVERAGE_CHANNEL_SIZE    ( 8 )
+#define AVERAGE_SUBSCRIBERS     ( 2 )
 #define MAX_NUMBER_OF_SAMPLES   ( 20 )
 #define MIN_NUMBER_OF_SAMPLES   ( 1 )
 #define SENSOR_FRECUENCY_HZ     ( 10 )
-#define SENSOR_DELAY_MS         ( 1000 / SENSOR_FRECUENCY_HZ )
+#define SENSOR_CHANNEL          ( ADC_CTL_CH0 )
+#define SENSOR_BLOCK_SAMPLES    ( 10 ) // ADC samples averaged into one value
+#define SENSOR_SAMPLE_RATE_HZ   ( SENSOR_FRECUENCY_HZ * SENSOR_BLOCK_SAMPLES )
+#define SENSOR_ADC_MAX          ( 1023 ) // 10 bit conversions
 /* Display */
 #define LCD_COLUMNS_FOR_GRAPH   ( 69 )
 /* Timer */
@@ -35,7 +42,7 @@
 /* GLOBALS */
 /* Temp */
 static QueueHandle_t s_temps_queue;
-static QueueHandle_t s_temps_to_display_queue;
+static BroadcastHandle_t s_averages_channel;
 static volatile uint8_t s_numberOfSamples = 10; // Number of samples to average
 /* UART */
 static unsigned char s_uart_buffer[3] = {};
@@ -76,9 +83,15 @@ int main(void)
     /* Configure UART and LCD. */
     prvSetupHardware();
 
-    /* Initialize temps queues*/
+    /* Initialize temps queue and the channel the averages are published to. */
     s_temps_queue = xQueueCreate(TEMP_QUEUE_SIZE, sizeof(uint8_t));
-    s_temps_to_display_queue = xQueueCreate(TEMP_QUEUE_SIZE, sizeof(uint8_t));
+    s_averages_channel = xBroadcastCreate(AVERAGE_CHANNEL_SIZE, sizeof(uint8_t),
+        AVERAGE_SUBSCRIBERS);
+
+    /* Sample the sensor into blocks of SENSOR_BLOCK_SAMPLES, one block for
+     * each new temperature value. */
+    xADCCaptureInit(SENSOR_CHANNEL, SENSOR_SAMPLE_RATE_HZ, SENSOR_BLOCK_SAMPLES,
+        ADC_CAPTURE_MIN_BLOCKS);
     
     // Create tasks
     xTaskCreate(vSensorTask, "SensorGen", configMINIMAL_STACK_SIZE / 2,
@@ -131,40 +144,35 @@ void vSetupRunTimeStatsTimer(void) {
 /** vSensorTask
  * Create new temperature measurements, between values defined in 
  * MAX_TEMP_DECIMALS and MIN_TEMP_DECIMALS, with a defined frequency in
- * SENSOR_FRECUENCY_HZ. The new values ​​are placed into the global queue
- * defined as s_temps_queue.
+ * SENSOR_FRECUENCY_HZ. Each value is the average of one block of ADC samples
+ * from the capture service, scaled to the temperature range. The new values
+ * are placed into the global queue defined as s_temps_queue.
  */
 static void vSensorTask(void *pvParameters)
 {
-    /* Get tick count to control delay beteween new values */
-    TickType_t last_call = xTaskGetTickCount();
-    /* Initialize initial tempareture and ramdomize tool */
-    uint8_t temp_decimals = INITIAL_TEMP_DECIMALS;
-    unsigned long xorshift_state = SysTickValueGet();
-    if (xorshift_state == 0)
-        xorshift_state = 1;
+    const uint16_t *samples;
+    uint32_t sum;
+    uint8_t temp_decimals;
+    size_t i;
+
+    vADCCaptureStart();
 
     while (true)
     {
-        /* Wait for next iteration */
-        xTaskDelayUntil(&last_call, pdMS_TO_TICKS(SENSOR_DELAY_MS));
-
-        /* Initialize edges of temps */
-        int16_t lower = temp_decimals - TEMP_DECIMALS_STEP;
-        int16_t upper = temp_decimals + TEMP_DECIMALS_STEP;
-
-        /* Verify limits */
-        if (lower < MIN_TEMP_DECIMALS)
-            lower = MIN_TEMP_DECIMALS;
-        if (upper > MAX_TEMP_DECIMALS)
-            upper = MAX_TEMP_DECIMALS;
+        /* Wait for the next full block of samples */
+        samples = pusADCCaptureReceive(portMAX_DELAY);
+        if (samples == NULL)
+            continue;
 
-        /* Calculate a new random value from last tempareture base */
-        xorshift_state ^= xorshift_state << 13;
-        xorshift_state ^= xorshift_state >> 17;
-        xorshift_state ^= xorshift_state << 5;
+        /* Average the block where it is and give it back to the interrupt */
+        sum = 0;
+        for (i = 0; i < SENSOR_BLOCK_SAMPLES; i++)
+            sum += samples[i];
+        vADCCaptureRelease();
 
-        temp_decimals = (xorshift_state % (upper - lower + 1)) + lower;
+        /* Scale the average reading to the temperature range */
+        temp_decimals = MIN_TEMP_DECIMALS + ((sum / SENSOR_BLOCK_SAMPLES) *
+            (MAX_TEMP_DECIMALS - MIN_TEMP_DECIMALS)) / SENSOR_ADC_MAX;
 
         /* Put new temp into s_temps_queue */
         xQueueSend(s_temps_queue, &temp_decimals, portMAX_DELAY);
@@ -173,32 +181,36 @@ static void vSensorTask(void *pvParameters)
 
 /** vAverageTask
  * Get values from global queue 's_temps_queue', use the last N values for
- * calculate an average and save this value into the global queue
- * 's_temps_to_display_queue'.
+ * calculate an average and publish this value to every subscriber of the
+ * global channel 's_averages_channel'.
  */
 static void vAverageTask(void *pvParameters)
 {
-    /* Uses to get temp from 's_temps_queue' and to save the average */
-    uint8_t new_temp, average; 
+    /* Uses to get temps from 's_temps_queue' and to save the average */
+    uint8_t new_temps[TEMP_QUEUE_SIZE], average;
+    UBaseType_t received, i;
     /* Stores the last MAX_NUMBER_OF_SAMPLES historical temperature values */
     uint8_t temps_array[MAX_NUMBER_OF_SAMPLES] = {};
 
     while (true)
     {
-        /* Wait until a new value is in the queue */
-        xQueueReceive(s_temps_queue, &new_temp, portMAX_DELAY);
-
-        /* Add new value to the array and calculate the average */
-        appendToArray(temps_array, new_temp, MAX_NUMBER_OF_SAMPLES);
+        /* Wait until at least one new value is in the queue and drain every
+         * value waiting with a single call. */
+        received = xQueueReceiveMultiple(s_temps_queue, new_temps, 1,
+            TEMP_QUEUE_SIZE, portMAX_DELAY);
+
+        /* Add new values to the array and calculate the average */
+        for (i = 0; i < received; i++)
+            appendToArray(temps_array, new_temps[i], MAX_NUMBER_OF_SAMPLES);
         average = avgArray(temps_array, MAX_NUMBER_OF_SAMPLES, s_numberOfSamples);
 
-        /* Send the average to the display queue */
-        xQueueSend(s_temps_to_display_queue, &average, portMAX_DELAY);
+        /* Publish the average to the display and top tasks. */
+        vBroadcastPublish(s_averages_channel, &average);
     }
 }
 
 /** vDisplayTask
- * Get values from global queue 's_temps_to_display_queue' to display its in
+ * Get values from global channel 's_averages_channel' to display its in
  * the LCD panel. Also displays the actual value of N and a y axis its take
  * values into the follow interval [0, 1, 2,...,16].
  */
@@ -211,11 +223,13 @@ static void vDisplayTask(void *pvParameters)
     uint16_t col;
     /* String to display the N current value. */
     char display_N_buffer[5] = {'N', '=', '\0', '\0', '\0'};
+    /* Subscription to the averages channel. */
+    BroadcastSubscriberHandle_t subscriber = xBroadcastSubscribe(s_averages_channel);
     
     while (true)
     {
-        /* Wait until a new value is in the queue and add it to the array. */
-        xQueueReceive(s_temps_to_display_queue, &new_temp, portMAX_DELAY);
+        /* Wait until a new value is in the channel and add it to the array. */
+        xBroadcastReceive(subscriber, &new_temp, NULL, portMAX_DELAY);
         appendToArray(temps_array, new_temp / 10, LCD_COLUMNS_FOR_GRAPH);
 
         /* Clear the LCD panel */
@@ -269,7 +283,7 @@ static void vDisplayTask(void *pvParameters)
 
 /** vTopTask
  * The task print periodically information about the task existing in the
- * system and the state of the system heap.
+ * system, the state of the system heap and the last average published.
  */
 static void vTopTask(void * pvParameters)
 {
@@ -283,6 +297,12 @@ static void vTopTask(void * pvParameters)
     uint32_t last_mark_time_counter;
     TickType_t last_call = xTaskGetTickCount();
 
+    /* Vars to read the averages channel, the top task only reads it every
+     * few seconds so it is told how many averages were overwritten. */
+    BroadcastSubscriberHandle_t subscriber = xBroadcastSubscribe(s_averages_channel);
+    uint8_t average = 0;
+    uint32_t missed, total_missed;
+
     /* Print args for printFormat functions, the max number needed in the task
      * its 4. */
     void** print_args = (void**)pvPortMalloc(4 * sizeof(void *));
@@ -398,6 +418,16 @@ static void vTopTask(void * pvParameters)
         printFormat("%-3c %%]    | %-4d | %-4d | %-4d |\r\n", print_args);
         printString("+------------------------------------+------+------+------+\r\n");
 
+        /* Drain the averages published since the last iteration. */
+        total_missed = 0;
+        while (xBroadcastReceive(subscriber, &average, &missed, 0) == pdPASS)
+            total_missed += missed;
+
+        /* Print the last average and the averages that were overwritten. */
+        print_args[0] = (uint8_t *) &average;
+        print_args[1] = (uint32_t *) &total_missed;
+        printFormat("| LAST AVERAGE: %-4c | MISSED: %-6d |\r\n", print_args);
+
         last_mark_time_counter = s_overflow_counter;
         vTaskDelay(pdMS_TO_TICKS(TOP_TASK_DELAY_MS));  
     }
@@ -0,0 +1,432 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "broadcast.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include broadcast channel functionality. This #if is closed at the very
+ * bottom of this file. If you want to include broadcast channels then ensure
+ * configUSE_BROADCAST_CHANNELS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_BROADCAST_CHANNELS == 1 )
+
+/* A subscription.  The subscriptions of a channel are held in an array that
+ * follows the channel structure in memory. */
+    typedef struct BroadcastSubscriberDef_t
+    {
+        struct BroadcastDef_t * pxChannel;  /**< The channel this subscription belongs to. */
+        TaskHandle_t volatile xTask;        /**< The subscribed task, or NULL if the subscription is free. */
+        volatile BaseType_t xWaiting;       /**< pdTRUE while the task is about to block or blocked.  Only written by the subscribed task. */
+        uint32_t ulNextItem;                /**< The sequence number of the next item to receive.  Only accessed by the subscribed task. */
+    } BroadcastSubscriber_t;
+
+/* Items are numbered by a free running sequence number, and item n is held in
+ * slot ( n & ulMask ).  The publisher advances ulWritesStarted before it
+ * overwrites a slot and ulWritesCompleted after, so a subscriber can tell
+ * whether the slot it just copied was overwritten while it was being copied.
+ * Both counters wrap, so they are only ever compared by subtraction. */
+    typedef struct BroadcastDef_t
+    {
+        volatile uint32_t ulWritesStarted;     /**< One more than the sequence number of the item being written.  Only written by the publisher. */
+        volatile uint32_t ulWritesCompleted;   /**< One more than the sequence number of the newest complete item.  Only written by the publisher. */
+        uint32_t ulMask;                       /**< The number of slots minus one. */
+        UBaseType_t uxItemSize;                /**< The size of each item in bytes. */
+        UBaseType_t uxMaxSubscribers;          /**< The number of subscriptions in the subscription array. */
+        BroadcastSubscriber_t * pxSubscribers; /**< The subscription array, which follows this structure in memory. */
+        uint8_t * pucStorage;                  /**< The storage area, which follows the subscription array in memory. */
+    } Broadcast_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Copy an item into the next slot of the channel, overwriting the oldest item
+ * if the channel is full.
+ */
+    static void prvWriteItem( Broadcast_t * const pxChannel,
+                              const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        BroadcastHandle_t xBroadcastCreate( UBaseType_t uxLength,
+                                            UBaseType_t uxItemSize,
+                                            UBaseType_t uxMaxSubscribers )
+        {
+            Broadcast_t * pxChannel = NULL;
+            size_t xSubscribersSizeInBytes;
+            size_t xStorageSizeInBytes;
+            UBaseType_t ux;
+
+            traceENTER_xBroadcastCreate( uxLength, uxItemSize, uxMaxSubscribers );
+
+            configASSERT( uxItemSize > ( UBaseType_t ) 0U );
+            configASSERT( uxMaxSubscribers > ( UBaseType_t ) 0U );
+            configASSERT( configBROADCAST_NOTIFICATION_INDEX < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+            /* The length must be a power of two so a sequence number can be
+             * turned into a slot with a mask, and must leave room for the
+             * sequence numbers to be compared by subtraction. */
+            configASSERT( ( uxLength & ( uxLength - ( UBaseType_t ) 1U ) ) == ( UBaseType_t ) 0U );
+
+            if( ( uxLength > ( UBaseType_t ) 0U ) &&
+                ( uxLength <= ( UBaseType_t ) 0x80000000UL ) &&
+                ( ( uxLength & ( uxLength - ( UBaseType_t ) 1U ) ) == ( UBaseType_t ) 0U ) &&
+                ( uxMaxSubscribers > ( UBaseType_t ) 0U ) &&
+                /* Check for multiplication overflow. */
+                ( ( SIZE_MAX / uxLength ) >= uxItemSize ) &&
+                ( ( SIZE_MAX / sizeof( BroadcastSubscriber_t ) ) >= uxMaxSubscribers ) &&
+                /* Check for addition overflow. */
+                ( ( SIZE_MAX - sizeof( Broadcast_t ) - ( ( size_t ) uxMaxSubscribers * sizeof( BroadcastSubscriber_t ) ) ) >= ( size_t ) ( ( size_t ) uxLength * ( size_t ) uxItemSize ) ) )
+            {
+                xSubscribersSizeInBytes = ( size_t ) uxMaxSubscribers * sizeof( BroadcastSubscriber_t );
+                xStorageSizeInBytes = ( size_t ) uxLength * ( size_t ) uxItemSize;
+
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxChannel = ( Broadcast_t * ) pvPortMalloc( sizeof( Broadcast_t ) + xSubscribersSizeInBytes + xStorageSizeInBytes );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxChannel != NULL )
+            {
+                pxChannel->ulWritesStarted = 0UL;
+                pxChannel->ulWritesCompleted = 0UL;
+                pxChannel->ulMask = ( uint32_t ) ( uxLength - ( UBaseType_t ) 1U );
+                pxChannel->uxItemSize = uxItemSize;
+                pxChannel->uxMaxSubscribers = uxMaxSubscribers;
+                pxChannel->pxSubscribers = ( BroadcastSubscriber_t * ) &( pxChannel[ 1 ] );
+                pxChannel->pucStorage = ( uint8_t * ) &( pxChannel->pxSubscribers[ uxMaxSubscribers ] );
+
+                for( ux = ( UBaseType_t ) 0U; ux < uxMaxSubscribers; ux++ )
+                {
+                    pxChannel->pxSubscribers[ ux ].pxChannel = pxChannel;
+                    pxChannel->pxSubscribers[ ux ].xTask = NULL;
+                    pxChannel->pxSubscribers[ ux ].xWaiting = pdFALSE;
+                    pxChannel->pxSubscribers[ ux ].ulNextItem = 0UL;
+                }
+            }
+            else
+            {
+                traceBROADCAST_CREATE_FAILED();
+            }
+
+            traceRETURN_xBroadcastCreate( pxChannel );
+
+            return pxChannel;
+        }
+/*-----------------------------------------------------------*/
+
+        void vBroadcastDelete( BroadcastHandle_t xChannel )
+        {
+            traceENTER_vBroadcastDelete( xChannel );
+
+            configASSERT( xChannel != NULL );
+
+            vPortFree( xChannel );
+
+            traceRETURN_vBroadcastDelete();
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    BroadcastSubscriberHandle_t xBroadcastSubscribe( BroadcastHandle_t xChannel )
+    {
+        Broadcast_t * const pxChannel = xChannel;
+        BroadcastSubscriber_t * pxSubscriber = NULL;
+        UBaseType_t ux;
+
+        traceENTER_xBroadcastSubscribe( xChannel );
+
+        configASSERT( pxChannel != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            for( ux = ( UBaseType_t ) 0U; ux < pxChannel->uxMaxSubscribers; ux++ )
+            {
+                if( pxChannel->pxSubscribers[ ux ].xTask == NULL )
+                {
+                    pxSubscriber = &( pxChannel->pxSubscribers[ ux ] );
+                    pxSubscriber->xWaiting = pdFALSE;
+                    pxSubscriber->ulNextItem = pxChannel->ulWritesCompleted;
+                    pxSubscriber->xTask = xTaskGetCurrentTaskHandle();
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xBroadcastSubscribe( pxSubscriber );
+
+        return pxSubscriber;
+    }
+/*-----------------------------------------------------------*/
+
+    void vBroadcastUnsubscribe( BroadcastSubscriberHandle_t xSubscriber )
+    {
+        BroadcastSubscriber_t * const pxSubscriber = xSubscriber;
+
+        traceENTER_vBroadcastUnsubscribe( xSubscriber );
+
+        configASSERT( pxSubscriber != NULL );
+
+        pxSubscriber->xWaiting = pdFALSE;
+        pxSubscriber->xTask = NULL;
+
+        traceRETURN_vBroadcastUnsubscribe();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvWriteItem( Broadcast_t * const pxChannel,
+                              const void * pvItem )
+    {
+        const uint32_t ulItem = pxChannel->ulWritesCompleted;
+
+        /* Subscribers that read the slot being overwritten must be able to see
+         * that it is being overwritten before it changes. */
+        pxChannel->ulWritesStarted = ulItem + 1UL;
+        portMEMORY_BARRIER();
+
+        ( void ) memcpy( ( void * ) &( pxChannel->pucStorage[ ( size_t ) ( ulItem & pxChannel->ulMask ) * ( size_t ) pxChannel->uxItemSize ] ), pvItem, ( size_t ) pxChannel->uxItemSize );
+
+        /* The item must be complete before subscribers can see it. */
+        portMEMORY_BARRIER();
+        pxChannel->ulWritesCompleted = ulItem + 1UL;
+
+        /* A subscriber sets xWaiting before it checks the channel one last
+         * time, so the new item must be visible before the publisher checks
+         * xWaiting.  One side or the other then always sees the item. */
+        portMEMORY_BARRIER();
+    }
+/*-----------------------------------------------------------*/
+
+    void vBroadcastPublish( BroadcastHandle_t xChannel,
+                            const void * pvItem )
+    {
+        Broadcast_t * const pxChannel = xChannel;
+        TaskHandle_t xTask;
+        UBaseType_t ux;
+
+        traceENTER_vBroadcastPublish( xChannel, pvItem );
+
+        configASSERT( pxChannel != NULL );
+        configASSERT( pvItem != NULL );
+
+        prvWriteItem( pxChannel, pvItem );
+
+        for( ux = ( UBaseType_t ) 0U; ux < pxChannel->uxMaxSubscribers; ux++ )
+        {
+            xTask = pxChannel->pxSubscribers[ ux ].xTask;
+
+            if( ( xTask != NULL ) && ( pxChannel->pxSubscribers[ ux ].xWaiting != pdFALSE ) )
+            {
+                ( void ) xTaskNotifyGiveIndexed( xTask, configBROADCAST_NOTIFICATION_INDEX );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_vBroadcastPublish();
+    }
+/*-----------------------------------------------------------*/
+
+    void vBroadcastPublishFromISR( BroadcastHandle_t xChannel,
+                                   const void * pvItem,
+                                   BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        Broadcast_t * const pxChannel = xChannel;
+        TaskHandle_t xTask;
+        UBaseType_t ux;
+
+        traceENTER_vBroadcastPublishFromISR( xChannel, pvItem, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxChannel != NULL );
+        configASSERT( pvItem != NULL );
+
+        prvWriteItem( pxChannel, pvItem );
+
+        for( ux = ( UBaseType_t ) 0U; ux < pxChannel->uxMaxSubscribers; ux++ )
+        {
+            xTask = pxChannel->pxSubscribers[ ux ].xTask;
+
+            if( ( xTask != NULL ) && ( pxChannel->pxSubscribers[ ux ].xWaiting != pdFALSE ) )
+            {
+                vTaskNotifyGiveIndexedFromISR( xTask, configBROADCAST_NOTIFICATION_INDEX, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_vBroadcastPublishFromISR();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xBroadcastReceive( BroadcastSubscriberHandle_t xSubscriber,
+                                  void * pvBuffer,
+                                  uint32_t * pulMissed,
+                                  TickType_t xTicksToWait )
+    {
+        BroadcastSubscriber_t * const pxSubscriber = xSubscriber;
+        Broadcast_t * pxChannel;
+        TimeOut_t xTimeOut;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xReturn = errQUEUE_EMPTY;
+        uint32_t ulMissed = 0UL;
+        uint32_t ulCompleted, ulStarted, ulLength;
+
+        traceENTER_xBroadcastReceive( xSubscriber, pvBuffer, pulMissed, xTicksToWait );
+
+        configASSERT( pxSubscriber != NULL );
+        configASSERT( pvBuffer != NULL );
+        configASSERT( pxSubscriber->xTask == xTaskGetCurrentTaskHandle() );
+
+        pxChannel = pxSubscriber->pxChannel;
+        ulLength = pxChannel->ulMask + 1UL;
+
+        for( ; ; )
+        {
+            ulCompleted = pxChannel->ulWritesCompleted;
+            portMEMORY_BARRIER();
+            ulStarted = pxChannel->ulWritesStarted;
+
+            /* Skip any items that have been, or are being, overwritten. */
+            if( ( ulStarted - pxSubscriber->ulNextItem ) > ulLength )
+            {
+                ulMissed += ( ulStarted - pxSubscriber->ulNextItem ) - ulLength;
+                pxSubscriber->ulNextItem = ulStarted - ulLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxSubscriber->ulNextItem != ulCompleted )
+            {
+                /* Do not read the item until the count that published it has
+                 * been read. */
+                portMEMORY_BARRIER();
+                ( void ) memcpy( pvBuffer, ( const void * ) &( pxChannel->pucStorage[ ( size_t ) ( pxSubscriber->ulNextItem & pxChannel->ulMask ) * ( size_t ) pxChannel->uxItemSize ] ), ( size_t ) pxChannel->uxItemSize );
+
+                /* The copy is only valid if the publisher did not start to
+                 * overwrite the slot before the copy finished.  If it did,
+                 * go round again to skip to the oldest item still held. */
+                portMEMORY_BARRIER();
+
+                if( ( pxChannel->ulWritesStarted - pxSubscriber->ulNextItem ) <= ulLength )
+                {
+                    pxSubscriber->ulNextItem++;
+                    xReturn = pdPASS;
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                continue;
+            }
+
+            /* xTaskCheckForTimeOut() sets xTicksToWait to zero on timeout. */
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                break;
+            }
+
+            if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+
+            /* Mark the subscription as waiting, then check the channel again
+             * in case an item was published before the publisher could see
+             * the mark. */
+            pxSubscriber->xWaiting = pdTRUE;
+            portMEMORY_BARRIER();
+
+            if( pxSubscriber->ulNextItem == pxChannel->ulWritesCompleted )
+            {
+                /* Clearing the notification value on exit also discards a
+                 * notification left by an item that arrived after an earlier
+                 * check. */
+                ( void ) ulTaskNotifyTakeIndexed( configBROADCAST_NOTIFICATION_INDEX, pdTRUE, xTicksToWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxSubscriber->xWaiting = pdFALSE;
+
+            ( void ) xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
+        }
+
+        if( pulMissed != NULL )
+        {
+            *pulMissed = ulMissed;
+        }
+
+        traceRETURN_xBroadcastReceive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include broadcast channel functionality. If you want to include broadcast
+ * channels then ensure configUSE_BROADCAST_CHANNELS is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_BROADCAST_CHANNELS == 1 */
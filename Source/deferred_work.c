@@ -0,0 +1,393 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "deferred_work.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include deferred work functionality. This #if is closed at the very bottom
+ * of this file. If you want to include the deferred work service then ensure
+ * configUSE_DEFERRED_WORK is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_DEFERRED_WORK == 1 )
+
+/* A source identifier holds the level of the source and the bit used for the
+ * source in the notification value of that level's worker. */
+    #define deferredSOURCE_LEVEL( xSource )    ( ( UBaseType_t ) ( xSource ) / ( UBaseType_t ) configDEFERRED_WORK_SOURCES_PER_LEVEL )
+    #define deferredSOURCE_BIT( xSource )      ( ( UBaseType_t ) ( xSource ) % ( UBaseType_t ) configDEFERRED_WORK_SOURCES_PER_LEVEL )
+
+/* A registered source. */
+    typedef struct DeferredWorkHandler
+    {
+        DeferredWorkFunction_t pxFunction;
+        void * pvArgument;
+    } DeferredWorkHandler_t;
+
+/* The state of one level.  The pending sources are held in the notification
+ * value of the worker task, so pending a source is a single notification.  The
+ * handlers and counters are only written from a critical section, as they are
+ * written by registering tasks, pending tasks and interrupts, and the worker. */
+    typedef struct DeferredWorkLevel
+    {
+        TaskHandle_t xTask;                                                        /**< The worker task. */
+        UBaseType_t uxSourceCount;                                                 /**< Number of sources registered with the level. */
+        DeferredWorkHandler_t xHandlers[ configDEFERRED_WORK_SOURCES_PER_LEVEL ]; /**< Handlers, indexed by the bit of the source. */
+        DeferredWorkStats_t xStats;
+    } DeferredWorkLevel_t;
+
+    typedef struct DeferredWorkDef_t
+    {
+        DeferredWorkLevel_t * pxLevels;
+        UBaseType_t uxLevelCount;
+    } DeferredWork_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The function executed by the worker task of each level.
+ */
+    static portTASK_FUNCTION_PROTO( prvDeferredWorkWorker, pvParameters );
+
+/*
+ * Return the level of xSource, asserting that the source was registered.
+ */
+    static DeferredWorkLevel_t * prvGetSourceLevel( const DeferredWork_t * pxService,
+                                                    DeferredWorkSource_t xSource ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        DeferredWorkHandle_t xDeferredWorkCreate( const char * const pcName,
+                                                  UBaseType_t uxLevels,
+                                                  configSTACK_DEPTH_TYPE uxStackDepth,
+                                                  UBaseType_t uxLowestPriority )
+        {
+            DeferredWork_t * pxService;
+            DeferredWorkLevel_t * pxLevel;
+            UBaseType_t uxLevel;
+            BaseType_t xCreated = pdPASS;
+
+            traceENTER_xDeferredWorkCreate( pcName, uxLevels, uxStackDepth, uxLowestPriority );
+
+            configASSERT( uxLevels > ( UBaseType_t ) 0U );
+            configASSERT( ( uxLowestPriority + uxLevels ) <= ( UBaseType_t ) configMAX_PRIORITIES );
+            configASSERT( configDEFERRED_WORK_NOTIFICATION_INDEX < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+            /* The service and the levels are allocated in one block.  The
+             * service contains only a pointer and a UBaseType_t, so the levels
+             * are suitably aligned when placed after it. */
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxService = ( DeferredWork_t * ) pvPortMalloc( sizeof( DeferredWork_t ) +
+                                                           ( ( size_t ) uxLevels * sizeof( DeferredWorkLevel_t ) ) );
+
+            if( pxService != NULL )
+            {
+                pxService->pxLevels = ( DeferredWorkLevel_t * ) &( pxService[ 1 ] );
+                pxService->uxLevelCount = uxLevels;
+
+                for( uxLevel = ( UBaseType_t ) 0U; uxLevel < uxLevels; uxLevel++ )
+                {
+                    pxLevel = &( pxService->pxLevels[ uxLevel ] );
+                    ( void ) memset( ( void * ) pxLevel, 0x00, sizeof( DeferredWorkLevel_t ) );
+
+                    /* The worker of each level runs one priority above the
+                     * worker of the level below it. */
+                    xCreated = xTaskCreate( prvDeferredWorkWorker, pcName, uxStackDepth, ( void * ) pxLevel, uxLowestPriority + uxLevel, &( pxLevel->xTask ) );
+
+                    if( xCreated != pdPASS )
+                    {
+                        break;
+                    }
+                }
+
+                if( xCreated != pdPASS )
+                {
+                    #if ( INCLUDE_vTaskDelete == 1 )
+                    {
+                        /* Remove the workers that were created, after which
+                         * nothing references the service memory. */
+                        while( uxLevel > ( UBaseType_t ) 0U )
+                        {
+                            uxLevel--;
+                            vTaskDelete( pxService->pxLevels[ uxLevel ].xTask );
+                        }
+
+                        vPortFree( pxService );
+                    }
+                    #else
+                    {
+                        /* The workers that were created cannot be deleted, and
+                         * they reference the service memory, so the memory
+                         * cannot be freed.  The workers remain blocked as no
+                         * sources can be registered with them. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                    #endif /* INCLUDE_vTaskDelete */
+
+                    pxService = NULL;
+                }
+            }
+            else
+            {
+                traceDEFERRED_WORK_CREATE_FAILED();
+            }
+
+            traceRETURN_xDeferredWorkCreate( pxService );
+
+            return pxService;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    BaseType_t xDeferredWorkRegister( DeferredWorkHandle_t xService,
+                                      UBaseType_t uxLevel,
+                                      DeferredWorkFunction_t pxFunction,
+                                      void * pvArgument,
+                                      DeferredWorkSource_t * pxSource )
+    {
+        DeferredWork_t * const pxService = xService;
+        DeferredWorkLevel_t * pxLevel;
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xDeferredWorkRegister( xService, uxLevel, pxFunction, pvArgument, pxSource );
+
+        configASSERT( pxService != NULL );
+        configASSERT( uxLevel < pxService->uxLevelCount );
+        configASSERT( pxFunction != NULL );
+        configASSERT( pxSource != NULL );
+
+        pxLevel = &( pxService->pxLevels[ uxLevel ] );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxLevel->uxSourceCount < ( UBaseType_t ) configDEFERRED_WORK_SOURCES_PER_LEVEL )
+            {
+                pxLevel->xHandlers[ pxLevel->uxSourceCount ].pxFunction = pxFunction;
+                pxLevel->xHandlers[ pxLevel->uxSourceCount ].pvArgument = pvArgument;
+                *pxSource = ( DeferredWorkSource_t ) ( ( uxLevel * ( UBaseType_t ) configDEFERRED_WORK_SOURCES_PER_LEVEL ) + pxLevel->uxSourceCount );
+                ( pxLevel->uxSourceCount )++;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xDeferredWorkRegister( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xDeferredWorkPend( DeferredWorkHandle_t xService,
+                                  DeferredWorkSource_t xSource )
+    {
+        DeferredWorkLevel_t * const pxLevel = prvGetSourceLevel( xService, xSource );
+        const uint32_t ulBit = ( uint32_t ) 1U << deferredSOURCE_BIT( xSource );
+        uint32_t ulPreviouslyPending = 0U;
+        BaseType_t xReturn;
+
+        traceENTER_xDeferredWorkPend( xService, xSource );
+
+        /* Setting the bit both pends the source and wakes the worker.  The
+         * worker clears all the bits it has seen in the same operation that
+         * reads them, so a pend that finds its bit set is certain to be
+         * followed by a run of the handler. */
+        ( void ) xTaskNotifyAndQueryIndexed( pxLevel->xTask, configDEFERRED_WORK_NOTIFICATION_INDEX, ulBit, eSetBits, &ulPreviouslyPending );
+
+        xReturn = ( ( ulPreviouslyPending & ulBit ) == 0U ) ? pdTRUE : pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            pxLevel->xStats.ulPends++;
+
+            if( xReturn == pdFALSE )
+            {
+                pxLevel->xStats.ulCoalesced++;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xDeferredWorkPend( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xDeferredWorkPendFromISR( DeferredWorkHandle_t xService,
+                                         DeferredWorkSource_t xSource,
+                                         BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        DeferredWorkLevel_t * const pxLevel = prvGetSourceLevel( xService, xSource );
+        const uint32_t ulBit = ( uint32_t ) 1U << deferredSOURCE_BIT( xSource );
+        uint32_t ulPreviouslyPending = 0U;
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xReturn;
+
+        traceENTER_xDeferredWorkPendFromISR( xService, xSource, pxHigherPriorityTaskWoken );
+
+        ( void ) xTaskNotifyAndQueryIndexedFromISR( pxLevel->xTask, configDEFERRED_WORK_NOTIFICATION_INDEX, ulBit, eSetBits, &ulPreviouslyPending, pxHigherPriorityTaskWoken );
+
+        xReturn = ( ( ulPreviouslyPending & ulBit ) == 0U ) ? pdTRUE : pdFALSE;
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            pxLevel->xStats.ulPends++;
+
+            if( xReturn == pdFALSE )
+            {
+                pxLevel->xStats.ulCoalesced++;
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_xDeferredWorkPendFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vDeferredWorkGetStats( DeferredWorkHandle_t xService,
+                                UBaseType_t uxLevel,
+                                DeferredWorkStats_t * pxStats )
+    {
+        DeferredWork_t * const pxService = xService;
+
+        traceENTER_vDeferredWorkGetStats( xService, uxLevel, pxStats );
+
+        configASSERT( pxService != NULL );
+        configASSERT( uxLevel < pxService->uxLevelCount );
+        configASSERT( pxStats != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            *pxStats = pxService->pxLevels[ uxLevel ].xStats;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vDeferredWorkGetStats();
+    }
+/*-----------------------------------------------------------*/
+
+    static portTASK_FUNCTION( prvDeferredWorkWorker, pvParameters )
+    {
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        DeferredWorkLevel_t * const pxLevel = ( DeferredWorkLevel_t * ) pvParameters;
+        uint32_t ulPending, ulRemaining;
+        UBaseType_t uxPendingCount, uxSource;
+
+        for( ; ; )
+        {
+            /* Take and clear every pending bit at once.  Sources pended while
+             * the handlers run set their bits again and are handled on the
+             * next pass, without the worker blocking. */
+            ( void ) xTaskNotifyWaitIndexed( configDEFERRED_WORK_NOTIFICATION_INDEX, 0U, ( uint32_t ) 0xffffffffUL, &ulPending, portMAX_DELAY );
+
+            uxPendingCount = ( UBaseType_t ) 0U;
+
+            for( ulRemaining = ulPending; ulRemaining != 0U; ulRemaining &= ulRemaining - 1U )
+            {
+                uxPendingCount++;
+            }
+
+            taskENTER_CRITICAL();
+            {
+                pxLevel->xStats.ulWakes++;
+                pxLevel->xStats.ulRuns += ( uint32_t ) uxPendingCount;
+
+                if( uxPendingCount > pxLevel->xStats.uxMaxPending )
+                {
+                    pxLevel->xStats.uxMaxPending = uxPendingCount;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            /* Run the handlers in the order the sources were registered. */
+            for( uxSource = ( UBaseType_t ) 0U; ulPending != 0U; uxSource++ )
+            {
+                if( ( ulPending & ( ( uint32_t ) 1U << uxSource ) ) != 0U )
+                {
+                    ulPending &= ~( ( uint32_t ) 1U << uxSource );
+                    pxLevel->xHandlers[ uxSource ].pxFunction( pxLevel->xHandlers[ uxSource ].pvArgument );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static DeferredWorkLevel_t * prvGetSourceLevel( const DeferredWork_t * pxService,
+                                                    DeferredWorkSource_t xSource )
+    {
+        DeferredWorkLevel_t * pxLevel;
+
+        configASSERT( pxService != NULL );
+        configASSERT( deferredSOURCE_LEVEL( xSource ) < pxService->uxLevelCount );
+
+        pxLevel = &( pxService->pxLevels[ deferredSOURCE_LEVEL( xSource ) ] );
+
+        /* Pending a bit with no handler would stop the worker. */
+        configASSERT( deferredSOURCE_BIT( xSource ) < pxLevel->uxSourceCount );
+
+        return pxLevel;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include deferred work functionality. If you want to include the deferred
+ * work service then ensure configUSE_DEFERRED_WORK is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_DEFERRED_WORK == 1 */
@@ -51,11 +51,28 @@
  * configUSE_EVENT_GROUPS is set to 1 in FreeRTOSConfig.h. */
 #if ( configUSE_EVENT_GROUPS == 1 )
 
+/* The number of bits that can be waited for - all the bits of an EventBits_t
+ * other than the control bits in the most significant byte. */
+    #define eventNUMBER_OF_INDEXED_BITS    ( ( sizeof( EventBits_t ) * ( size_t ) 8 ) - ( size_t ) 8 )
+
     typedef struct EventGroupDef_t
     {
         EventBits_t uxEventBits;
         List_t xTasksWaitingForBits; /**< List of tasks waiting for a bit to be set. */
 
+        #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+            List_t xTasksWaitingForBit[ eventNUMBER_OF_INDEXED_BITS ]; /**< Lists of tasks that cannot unblock until a particular bit is set, indexed by the bit number.  xTasksWaitingForBits then only holds tasks waiting for any one of several bits. */
+        #endif
+
+        #if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+            UBaseType_t uxTaskAccessDepth; /**< Non-zero while a task is using the list of waiting tasks, in which case xEventGroupSetBitsFromISR() defers to the timer task rather than unblocking tasks itself. */
+        #endif
+
+        #if ( configUSE_64_BIT_EVENT_BITS == 1 )
+            EventBits_t uxBitsToSetFromISR;   /**< Bits an interrupt has asked to be set that the timer task has not yet set. */
+            EventBits_t uxBitsToClearFromISR; /**< Bits an interrupt has asked to be cleared that the timer task has not yet cleared. */
+        #endif
+
         #if ( configUSE_TRACE_FACILITY == 1 )
             UBaseType_t uxEventGroupNumber;
         #endif
@@ -67,6 +84,77 @@
 
 /*-----------------------------------------------------------*/
 
+/* Normally interrupts do not access event groups, so the bits and the list of
+ * waiting tasks are protected by suspending the scheduler.  When
+ * xEventGroupSetBitsFromISR() is allowed to unblock tasks itself it must not
+ * do so while a task is part way through using the list.  Rather than walk the
+ * list with interrupts masked, which would take an unbounded time, a task
+ * marks the event group as in use for as long as it has the scheduler
+ * suspended, and xEventGroupSetBitsFromISR() defers to the timer task while
+ * the mark is set.  The mark is a count as xEventGroupSync() calls
+ * xEventGroupSetBits(). */
+    #if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+        #define eventENTER_TASK_ACCESS( pxEventBits ) \
+    do {                                              \
+        taskENTER_CRITICAL();                         \
+        {                                             \
+            ( pxEventBits )->uxTaskAccessDepth++;     \
+        }                                             \
+        taskEXIT_CRITICAL();                          \
+    } while( 0 )
+
+        #define eventEXIT_TASK_ACCESS( pxEventBits ) \
+    do {                                             \
+        taskENTER_CRITICAL();                        \
+        {                                            \
+            ( pxEventBits )->uxTaskAccessDepth--;    \
+        }                                            \
+        taskEXIT_CRITICAL();                         \
+    } while( 0 )
+    #else
+        #define eventENTER_TASK_ACCESS( pxEventBits )
+        #define eventEXIT_TASK_ACCESS( pxEventBits )
+    #endif
+
+/* A port is only expected to read and write a TickType_t atomically.  When the
+ * event bits are wider than that, for example 64-bit event bits on a 32-bit
+ * architecture, a write made with only the scheduler suspended could be seen
+ * half done by xEventGroupGetBitsFromISR(), so such writes are also made in a
+ * critical section. */
+    #if ( ( configUSE_64_BIT_EVENT_BITS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+        #define eventENTER_BITS_CRITICAL()    taskENTER_CRITICAL()
+        #define eventEXIT_BITS_CRITICAL()     taskEXIT_CRITICAL()
+    #else
+        #define eventENTER_BITS_CRITICAL()
+        #define eventEXIT_BITS_CRITICAL()
+    #endif
+
+/* Returns the value stored in the event list item of a task waiting on the
+ * event group - the bits it is waiting for, plus the control bits. */
+    #if ( tskEVENT_ITEM_VALUE_IN_TCB != 0 )
+        #define eventGET_WAITER_VALUE( pxListItem )    ( ( EventBits_t ) uxTaskGetEventItemValue( pxListItem ) )
+    #else
+        #define eventGET_WAITER_VALUE( pxListItem )    ( ( EventBits_t ) listGET_LIST_ITEM_VALUE( pxListItem ) )
+    #endif
+
+/* Pends an event group set or clear operation from an interrupt to the timer
+ * task.  Only one of uxBitsToSet and uxBitsToClear is non-zero.  The value
+ * passed to a pended function is only 32 bits wide, so when event bits are 64
+ * bits wide the bits are instead held in the event group until the timer task
+ * applies them, and eventHAS_BITS_PENDED_FROM_ISR() returns pdTRUE until it
+ * has. */
+    #if ( configUSE_64_BIT_EVENT_BITS == 1 )
+        #define eventPEND_FROM_ISR( xFunction, xEventGroup, uxBitsToSet, uxBitsToClear, pxHigherPriorityTaskWoken ) \
+    prvPendFromISR( ( xEventGroup ), ( uxBitsToSet ), ( uxBitsToClear ), ( pxHigherPriorityTaskWoken ) )
+        #define eventHAS_BITS_PENDED_FROM_ISR( pxEventBits ) \
+    ( ( ( ( pxEventBits )->uxBitsToSetFromISR | ( pxEventBits )->uxBitsToClearFromISR ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE )
+    #else
+        #define eventPEND_FROM_ISR( xFunction, xEventGroup, uxBitsToSet, uxBitsToClear, pxHigherPriorityTaskWoken ) \
+    xTimerPendFunctionCallFromISR( ( xFunction ), ( void * ) ( xEventGroup ), ( uint32_t ) ( ( uxBitsToSet ) | ( uxBitsToClear ) ), ( pxHigherPriorityTaskWoken ) )
+        #define eventHAS_BITS_PENDED_FROM_ISR( pxEventBits )    pdFALSE
+    #endif
+/*-----------------------------------------------------------*/
+
 /*
  * Test the bits set in uxCurrentEventBits to see if the wait condition is met.
  * The wait condition is defined by xWaitForAllBits.  If xWaitForAllBits is
@@ -79,6 +167,68 @@
                                             const EventBits_t uxBitsToWaitFor,
                                             const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+/*
+ * Unblock the tasks whose wait condition is met now that uxBitsSet have been
+ * set in the event group, and return the bits that must then be cleared
+ * because a task that unblocked asked for them to be cleared on exit.
+ * xFromISR is pdTRUE when called from xEventGroupSetBitsFromISR(), in which
+ * case *pxHigherPriorityTaskWoken is set to pdTRUE if an unblocked task has a
+ * priority above that of the interrupted task.
+ */
+    static EventBits_t prvUnblockTasks( EventGroup_t * pxEventBits,
+                                        const EventBits_t uxBitsSet,
+                                        const BaseType_t xFromISR,
+                                        BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Does the work of prvUnblockTasks() for the tasks held in one list.
+ */
+    static EventBits_t prvUnblockTasksOnList( EventGroup_t * pxEventBits,
+                                              const List_t * pxList,
+                                              const BaseType_t xFromISR,
+                                              BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the list in which to hold a task that is going to block on the
+ * event group.  A task that cannot unblock until a particular bit is set - a
+ * task waiting for one bit, or for all of several bits of which at least one
+ * is clear - is held in the list for that bit, so setting other bits does not
+ * need to look at it.
+ */
+    #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+        static List_t * prvGetWaitingList( EventGroup_t * pxEventBits,
+                                           const EventBits_t uxBitsToWaitFor,
+                                           const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
+    #endif
+
+/*
+ * Returns the number of tasks prvUnblockTasks() would have to look at if
+ * uxBitsSet were set, which bounds the time xEventGroupSetBitsFromISR() takes.
+ */
+    #if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+        static UBaseType_t prvGetNumberOfTasksToTest( const EventGroup_t * pxEventBits,
+                                                      const EventBits_t uxBitsSet ) PRIVILEGED_FUNCTION;
+    #endif
+
+/*
+ * Add uxBitsToSet and uxBitsToClear to the bits held in the event group for the
+ * timer task to apply, pending a call to prvApplyBitsFromISRCallback() if one
+ * is not already pending.  Used by eventPEND_FROM_ISR().
+ */
+    #if ( ( configUSE_64_BIT_EVENT_BITS == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+        static BaseType_t prvPendFromISR( EventGroupHandle_t xEventGroup,
+                                          const EventBits_t uxBitsToSet,
+                                          const EventBits_t uxBitsToClear,
+                                          BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Execute the 'set bits' and 'clear bits' commands held in the event group
+ * by prvPendFromISR().
+ */
+        static void prvApplyBitsFromISRCallback( void * pvEventGroup,
+                                                 uint32_t ulUnused ) PRIVILEGED_FUNCTION;
+    #endif
+
 /*-----------------------------------------------------------*/
 
     #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -113,6 +263,30 @@
                 pxEventBits->uxEventBits = 0;
                 vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+                #if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+                {
+                    pxEventBits->uxTaskAccessDepth = 0;
+                }
+                #endif
+
+                #if ( configUSE_64_BIT_EVENT_BITS == 1 )
+                {
+                    pxEventBits->uxBitsToSetFromISR = 0;
+                    pxEventBits->uxBitsToClearFromISR = 0;
+                }
+                #endif
+
+                #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+                {
+                    UBaseType_t uxBit;
+
+                    for( uxBit = 0; uxBit < ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS; uxBit++ )
+                    {
+                        vListInitialise( &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) );
+                    }
+                }
+                #endif
+
                 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
                 {
                     /* Both static and dynamic allocation can be used, so note that
@@ -158,6 +332,30 @@
                 pxEventBits->uxEventBits = 0;
                 vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+                #if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+                {
+                    pxEventBits->uxTaskAccessDepth = 0;
+                }
+                #endif
+
+                #if ( configUSE_64_BIT_EVENT_BITS == 1 )
+                {
+                    pxEventBits->uxBitsToSetFromISR = 0;
+                    pxEventBits->uxBitsToClearFromISR = 0;
+                }
+                #endif
+
+                #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+                {
+                    UBaseType_t uxBit;
+
+                    for( uxBit = 0; uxBit < ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS; uxBit++ )
+                    {
+                        vListInitialise( &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) );
+                    }
+                }
+                #endif
+
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
                     /* Both static and dynamic allocation can be used, so note this
@@ -203,6 +401,7 @@
         #endif
 
         vTaskSuspendAll();
+        eventENTER_TASK_ACCESS( pxEventBits );
         {
             uxOriginalBitValue = pxEventBits->uxEventBits;
 
@@ -215,7 +414,11 @@
 
                 /* Rendezvous always clear the bits.  They will have been cleared
                  * already unless this is the only task in the rendezvous. */
-                pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+                eventENTER_BITS_CRITICAL();
+                {
+                    pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+                }
+                eventEXIT_BITS_CRITICAL();
 
                 xTicksToWait = 0;
             }
@@ -228,7 +431,15 @@
                     /* Store the bits that the calling task is waiting for in the
                      * task's event list item so the kernel knows when a match is
                      * found.  Then enter the blocked state. */
-                    vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+                    #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+                    {
+                        vTaskPlaceOnUnorderedEventList( prvGetWaitingList( pxEventBits, uxBitsToWaitFor, pdTRUE ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+                    }
+                    #else
+                    {
+                        vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+                    }
+                    #endif
 
                     /* This assignment is obsolete as uxReturn will get set after
                      * the task unblocks, but some compilers mistakenly generate a
@@ -245,6 +456,7 @@
                 }
             }
         }
+        eventEXIT_TASK_ACCESS( pxEventBits );
         xAlreadyYielded = xTaskResumeAll();
 
         if( xTicksToWait != ( TickType_t ) 0 )
@@ -334,6 +546,7 @@
         #endif
 
         vTaskSuspendAll();
+        eventENTER_TASK_ACCESS( pxEventBits );
         {
             const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
 
@@ -350,7 +563,11 @@
                 /* Clear the wait bits if requested to do so. */
                 if( xClearOnExit != pdFALSE )
                 {
-                    pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+                    eventENTER_BITS_CRITICAL();
+                    {
+                        pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+                    }
+                    eventEXIT_BITS_CRITICAL();
                 }
                 else
                 {
@@ -391,7 +608,15 @@
                 /* Store the bits that the calling task is waiting for in the
                  * task's event list item so the kernel knows when a match is
                  * found.  Then enter the blocked state. */
-                vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+                #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+                {
+                    vTaskPlaceOnUnorderedEventList( prvGetWaitingList( pxEventBits, uxBitsToWaitFor, xWaitForAllBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+                }
+                #else
+                {
+                    vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+                }
+                #endif
 
                 /* This is obsolete as it will get set after the task unblocks, but
                  * some compilers mistakenly generate a warning about the variable
@@ -401,6 +626,7 @@
                 traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
             }
         }
+        eventEXIT_TASK_ACCESS( pxEventBits );
         xAlreadyYielded = xTaskResumeAll();
 
         if( xTicksToWait != ( TickType_t ) 0 )
@@ -501,7 +727,7 @@
     }
 /*-----------------------------------------------------------*/
 
-    #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+    #if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_BITS == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
         BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
                                                 const EventBits_t uxBitsToClear )
@@ -511,14 +737,14 @@
             traceENTER_xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear );
 
             traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
-            xReturn = xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL );
+            xReturn = eventPEND_FROM_ISR( vEventGroupClearBitsCallback, xEventGroup, 0, uxBitsToClear, NULL );
 
             traceRETURN_xEventGroupClearBitsFromISR( xReturn );
 
             return xReturn;
         }
 
-    #endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    #endif /* if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_BITS == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
 /*-----------------------------------------------------------*/
 
     EventBits_t xEventGroupGetBitsFromISR( EventGroupHandle_t xEventGroup )
@@ -547,13 +773,8 @@
     EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
                                     const EventBits_t uxBitsToSet )
     {
-        ListItem_t * pxListItem;
-        ListItem_t * pxNext;
-        ListItem_t const * pxListEnd;
-        List_t const * pxList;
-        EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits, uxReturnBits;
+        EventBits_t uxBitsToClear, uxReturnBits;
         EventGroup_t * pxEventBits = xEventGroup;
-        BaseType_t xMatchFound = pdFALSE;
 
         traceENTER_xEventGroupSetBits( xEventGroup, uxBitsToSet );
 
@@ -562,83 +783,40 @@
         configASSERT( xEventGroup );
         configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-        pxList = &( pxEventBits->xTasksWaitingForBits );
-        pxListEnd = listGET_END_MARKER( pxList );
         vTaskSuspendAll();
+        eventENTER_TASK_ACCESS( pxEventBits );
         {
             traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-            pxListItem = listGET_HEAD_ENTRY( pxList );
-
             /* Set the bits. */
-            pxEventBits->uxEventBits |= uxBitsToSet;
-
-            /* See if the new bit value should unblock any tasks. */
-            while( pxListItem != pxListEnd )
+            eventENTER_BITS_CRITICAL();
             {
-                pxNext = listGET_NEXT( pxListItem );
-                uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-                xMatchFound = pdFALSE;
-
-                /* Split the bits waited for from the control bits. */
-                uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-                uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+                pxEventBits->uxEventBits |= uxBitsToSet;
+            }
+            eventEXIT_BITS_CRITICAL();
 
-                if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
-                {
-                    /* Just looking for single bit being set. */
-                    if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
-                    {
-                        xMatchFound = pdTRUE;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-                }
-                else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
-                {
-                    /* All bits are set. */
-                    xMatchFound = pdTRUE;
-                }
-                else
-                {
-                    /* Need all bits to be set, but not all the bits were set. */
-                }
+            /* See if the new bit value should unblock any tasks. */
+            uxBitsToClear = prvUnblockTasks( pxEventBits, uxBitsToSet, pdFALSE, NULL );
 
-                if( xMatchFound != pdFALSE )
+            /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
+             * bit was set in the control word. */
+            if( uxBitsToClear != ( EventBits_t ) 0 )
+            {
+                eventENTER_BITS_CRITICAL();
                 {
-                    /* The bits match.  Should the bits be cleared on exit? */
-                    if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
-                    {
-                        uxBitsToClear |= uxBitsWaitedFor;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    /* Store the actual event flag value in the task's event list
-                     * item before removing the task from the event list.  The
-                     * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-                     * that is was unblocked due to its required bits matching, rather
-                     * than because it timed out. */
-                    vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+                    pxEventBits->uxEventBits &= ~uxBitsToClear;
                 }
-
-                /* Move onto the next list item.  Note pxListItem->pxNext is not
-                 * used here as the list item may have been removed from the event list
-                 * and inserted into the ready/pending reading list. */
-                pxListItem = pxNext;
+                eventEXIT_BITS_CRITICAL();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
-
-            /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
-             * bit was set in the control word. */
-            pxEventBits->uxEventBits &= ~uxBitsToClear;
 
             /* Snapshot resulting bits. */
             uxReturnBits = pxEventBits->uxEventBits;
         }
+        eventEXIT_TASK_ACCESS( pxEventBits );
         ( void ) xTaskResumeAll();
 
         traceRETURN_xEventGroupSetBits( uxReturnBits );
@@ -659,6 +837,7 @@
         pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
 
         vTaskSuspendAll();
+        eventENTER_TASK_ACCESS( pxEventBits );
         {
             traceEVENT_GROUP_DELETE( xEventGroup );
 
@@ -669,7 +848,24 @@
                 configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
                 vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
             }
+
+            #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+            {
+                UBaseType_t uxBit;
+
+                for( uxBit = 0; uxBit < ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS; uxBit++ )
+                {
+                    pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBit[ uxBit ] );
+
+                    while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+                    {
+                        vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+                    }
+                }
+            }
+            #endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
         }
+        eventEXIT_TASK_ACCESS( pxEventBits );
         ( void ) xTaskResumeAll();
 
         #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
@@ -775,6 +971,97 @@
     }
 /*-----------------------------------------------------------*/
 
+    #if ( ( configUSE_64_BIT_EVENT_BITS == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+
+        static void prvApplyBitsFromISRCallback( void * pvEventGroup,
+                                                 uint32_t ulUnused )
+        {
+            /* MISRA Ref 11.5.4 [Callback function parameter] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            EventGroup_t * pxEventBits = pvEventGroup;
+            EventBits_t uxBitsToSet, uxBitsToClear;
+
+            ( void ) ulUnused;
+
+            /* Take all the bits pended so far.  An interrupt that occurs after
+             * this pends a new call. */
+            taskENTER_CRITICAL();
+            {
+                uxBitsToSet = pxEventBits->uxBitsToSetFromISR;
+                uxBitsToClear = pxEventBits->uxBitsToClearFromISR;
+                pxEventBits->uxBitsToSetFromISR = 0;
+                pxEventBits->uxBitsToClearFromISR = 0;
+            }
+            taskEXIT_CRITICAL();
+
+            /* prvPendFromISR() keeps the two sets of bits apart, so the order in
+             * which they are applied does not change the result. */
+            if( uxBitsToClear != ( EventBits_t ) 0 )
+            {
+                ( void ) xEventGroupClearBits( pxEventBits, uxBitsToClear );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( uxBitsToSet != ( EventBits_t ) 0 )
+            {
+                ( void ) xEventGroupSetBits( pxEventBits, uxBitsToSet );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+/*-----------------------------------------------------------*/
+
+        static BaseType_t prvPendFromISR( EventGroupHandle_t xEventGroup,
+                                          const EventBits_t uxBitsToSet,
+                                          const EventBits_t uxBitsToClear,
+                                          BaseType_t * pxHigherPriorityTaskWoken )
+        {
+            EventGroup_t * pxEventBits = xEventGroup;
+            UBaseType_t uxSavedInterruptStatus;
+            BaseType_t xReturn = pdPASS;
+
+            configASSERT( xEventGroup );
+
+            /* The call is pended inside the critical section so a nested
+             * interrupt cannot add bits, and rely on this call, between the
+             * pend failing and the bits being discarded. */
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                if( eventHAS_BITS_PENDED_FROM_ISR( pxEventBits ) == pdFALSE )
+                {
+                    xReturn = xTimerPendFunctionCallFromISR( prvApplyBitsFromISRCallback, ( void * ) xEventGroup, 0U, pxHigherPriorityTaskWoken );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( xReturn != pdFAIL )
+                {
+                    /* A later operation overrides an earlier one on the same
+                     * bits, so the result is the same as applying each in turn. */
+                    pxEventBits->uxBitsToSetFromISR = ( pxEventBits->uxBitsToSetFromISR | uxBitsToSet ) & ~uxBitsToClear;
+                    pxEventBits->uxBitsToClearFromISR = ( pxEventBits->uxBitsToClearFromISR | uxBitsToClear ) & ~uxBitsToSet;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+            return xReturn;
+        }
+
+    #endif /* if ( ( configUSE_64_BIT_EVENT_BITS == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
     static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
                                             const EventBits_t uxBitsToWaitFor,
                                             const BaseType_t xWaitForAllBits )
@@ -812,7 +1099,7 @@
     }
 /*-----------------------------------------------------------*/
 
-    #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+    #if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 ) || ( configUSE_64_BIT_EVENT_BITS == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
         BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
                                               const EventBits_t uxBitsToSet,
@@ -820,17 +1107,320 @@
         {
             BaseType_t xReturn;
 
+            #if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+                EventGroup_t * pxEventBits = xEventGroup;
+                UBaseType_t uxSavedInterruptStatus;
+                EventBits_t uxBitsToClear;
+                BaseType_t xDeferred = pdTRUE;
+            #endif
+
             traceENTER_xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken );
 
             traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
-            xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken );
+
+            #if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+            {
+                configASSERT( xEventGroup );
+                configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+                /* The time spent here is bounded by only unblocking tasks
+                 * directly if few enough need to be looked at.  Otherwise, or if
+                 * a task is part way through using the list of waiting tasks, the
+                 * whole operation is deferred to the timer task as before. */
+                uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+                {
+                    if( ( pxEventBits->uxTaskAccessDepth == ( UBaseType_t ) 0 ) &&
+                        ( eventHAS_BITS_PENDED_FROM_ISR( pxEventBits ) == pdFALSE ) &&
+                        ( prvGetNumberOfTasksToTest( pxEventBits, uxBitsToSet ) <= ( UBaseType_t ) configEVENT_GROUP_ISR_MAX_WAITERS ) )
+                    {
+                        pxEventBits->uxEventBits |= uxBitsToSet;
+                        uxBitsToClear = prvUnblockTasks( pxEventBits, uxBitsToSet, pdTRUE, pxHigherPriorityTaskWoken );
+                        pxEventBits->uxEventBits &= ~uxBitsToClear;
+                        xDeferred = pdFALSE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+                if( xDeferred == pdFALSE )
+                {
+                    xReturn = pdPASS;
+                }
+                else
+                {
+                    xReturn = eventPEND_FROM_ISR( vEventGroupSetBitsCallback, xEventGroup, uxBitsToSet, 0, pxHigherPriorityTaskWoken );
+                }
+            }
+            #else /* if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 ) */
+            {
+                xReturn = eventPEND_FROM_ISR( vEventGroupSetBitsCallback, xEventGroup, uxBitsToSet, 0, pxHigherPriorityTaskWoken );
+            }
+            #endif /* if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 ) */
 
             traceRETURN_xEventGroupSetBitsFromISR( xReturn );
 
             return xReturn;
         }
 
-    #endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    #endif /* if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 ) || ( configUSE_64_BIT_EVENT_BITS == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+    static EventBits_t prvUnblockTasks( EventGroup_t * pxEventBits,
+                                        const EventBits_t uxBitsSet,
+                                        const BaseType_t xFromISR,
+                                        BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        EventBits_t uxBitsToClear;
+
+        uxBitsToClear = prvUnblockTasksOnList( pxEventBits, &( pxEventBits->xTasksWaitingForBits ), xFromISR, pxHigherPriorityTaskWoken );
+
+        #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+        {
+            UBaseType_t uxBit;
+
+            /* Of the tasks held in the per bit lists, only those waiting for
+             * one of the bits just set can have their wait condition met. */
+            for( uxBit = 0; uxBit < ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS; uxBit++ )
+            {
+                if( ( uxBitsSet & ( ( EventBits_t ) 1U << uxBit ) ) != ( EventBits_t ) 0 )
+                {
+                    uxBitsToClear |= prvUnblockTasksOnList( pxEventBits, &( pxEventBits->xTasksWaitingForBit[ uxBit ] ), xFromISR, pxHigherPriorityTaskWoken );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        #else /* configUSE_EVENT_GROUP_WAITER_INDEX */
+        {
+            ( void ) uxBitsSet;
+        }
+        #endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+
+        return uxBitsToClear;
+    }
+/*-----------------------------------------------------------*/
+
+    static EventBits_t prvUnblockTasksOnList( EventGroup_t * pxEventBits,
+                                              const List_t * pxList,
+                                              const BaseType_t xFromISR,
+                                              BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        ListItem_t * pxListItem;
+        ListItem_t * pxNext;
+        ListItem_t const * pxListEnd;
+        EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+        BaseType_t xMatchFound;
+
+        pxListEnd = listGET_END_MARKER( pxList );
+        pxListItem = listGET_HEAD_ENTRY( pxList );
+
+        while( pxListItem != pxListEnd )
+        {
+            pxNext = listGET_NEXT( pxListItem );
+            uxBitsWaitedFor = eventGET_WAITER_VALUE( pxListItem );
+            xMatchFound = pdFALSE;
+
+            /* Split the bits waited for from the control bits. */
+            uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+            uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+            if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+            {
+                /* Just looking for single bit being set. */
+                if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+                {
+                    xMatchFound = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+            {
+                /* All bits are set. */
+                xMatchFound = pdTRUE;
+            }
+            else
+            {
+                /* Need all bits to be set, but not all the bits were set. */
+            }
+
+            if( xMatchFound != pdFALSE )
+            {
+                /* The bits match.  Should the bits be cleared on exit? */
+                if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+                {
+                    uxBitsToClear |= uxBitsWaitedFor;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Store the actual event flag value in the task's event list
+                 * item before removing the task from the event list.  The
+                 * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+                 * that is was unblocked due to its required bits matching, rather
+                 * than because it timed out. */
+                #if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+                    if( xFromISR != pdFALSE )
+                    {
+                        /* Unblocked tasks are held pending if the interrupted
+                         * task had suspended the scheduler. */
+                        if( xTaskRemoveFromUnorderedEventListFromISR( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET ) != pdFALSE )
+                        {
+                            if( pxHigherPriorityTaskWoken != NULL )
+                            {
+                                *pxHigherPriorityTaskWoken = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                #endif /* configEVENT_GROUP_ISR_MAX_WAITERS */
+                {
+                    vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+                }
+            }
+            #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+                else if( pxList != &( pxEventBits->xTasksWaitingForBits ) )
+                {
+                    /* The task is waiting for all of several bits and was held
+                     * in the list for a bit that is now set.  Move it to the list
+                     * for one of the bits it is still waiting for.  That bit is
+                     * clear, so is not one of the bits being set, and the task
+                     * will not be looked at again by this call. */
+                    ( void ) uxListRemove( pxListItem );
+                    vListInsertEnd( prvGetWaitingList( pxEventBits, uxBitsWaitedFor, pdTRUE ), pxListItem );
+                }
+            #endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Move onto the next list item.  Note pxListItem->pxNext is not
+             * used here as the list item may have been removed from the event list
+             * and inserted into the ready/pending reading list. */
+            pxListItem = pxNext;
+        }
+
+        #if ( configEVENT_GROUP_ISR_MAX_WAITERS == 0 )
+        {
+            ( void ) xFromISR;
+            ( void ) pxHigherPriorityTaskWoken;
+        }
+        #endif
+
+        return uxBitsToClear;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+
+        static List_t * prvGetWaitingList( EventGroup_t * pxEventBits,
+                                           const EventBits_t uxBitsToWaitFor,
+                                           const BaseType_t xWaitForAllBits )
+        {
+            EventBits_t uxBlockingBits;
+            UBaseType_t uxBit = 0;
+            List_t * pxList;
+
+            if( ( uxBitsToWaitFor & ( uxBitsToWaitFor - ( EventBits_t ) 1U ) ) == ( EventBits_t ) 0 )
+            {
+                /* Waiting for a single bit. */
+                uxBlockingBits = uxBitsToWaitFor;
+            }
+            else if( xWaitForAllBits != pdFALSE )
+            {
+                /* Waiting for all of several bits, so the task cannot unblock
+                 * until each of those that is clear is set.  Any one of them will
+                 * do, so use the lowest. */
+                uxBlockingBits = uxBitsToWaitFor & ~( pxEventBits->uxEventBits );
+            }
+            else
+            {
+                /* Waiting for any one of several bits. */
+                uxBlockingBits = 0;
+            }
+
+            if( uxBlockingBits != ( EventBits_t ) 0 )
+            {
+                while( ( uxBit < ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS ) && ( ( uxBlockingBits & ( ( EventBits_t ) 1U << uxBit ) ) == ( EventBits_t ) 0 ) )
+                {
+                    uxBit++;
+                }
+            }
+            else
+            {
+                uxBit = ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS;
+            }
+
+            if( uxBit < ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS )
+            {
+                pxList = &( pxEventBits->xTasksWaitingForBit[ uxBit ] );
+            }
+            else
+            {
+                /* Not waiting for one particular bit, so the task is looked at
+                 * whenever any bit is set. */
+                pxList = &( pxEventBits->xTasksWaitingForBits );
+            }
+
+            return pxList;
+        }
+
+    #endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+/*-----------------------------------------------------------*/
+
+    #if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+
+        static UBaseType_t prvGetNumberOfTasksToTest( const EventGroup_t * pxEventBits,
+                                                      const EventBits_t uxBitsSet )
+        {
+            UBaseType_t uxNumberOfTasks;
+
+            uxNumberOfTasks = listCURRENT_LIST_LENGTH( &( pxEventBits->xTasksWaitingForBits ) );
+
+            #if ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+            {
+                UBaseType_t uxBit;
+
+                for( uxBit = 0; uxBit < ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS; uxBit++ )
+                {
+                    if( ( uxBitsSet & ( ( EventBits_t ) 1U << uxBit ) ) != ( EventBits_t ) 0 )
+                    {
+                        uxNumberOfTasks += listCURRENT_LIST_LENGTH( &( pxEventBits->xTasksWaitingForBit[ uxBit ] ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            #else /* configUSE_EVENT_GROUP_WAITER_INDEX */
+            {
+                ( void ) uxBitsSet;
+            }
+            #endif /* configUSE_EVENT_GROUP_WAITER_INDEX */
+
+            return uxNumberOfTasks;
+        }
+
+    #endif /* configEVENT_GROUP_ISR_MAX_WAITERS */
 /*-----------------------------------------------------------*/
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -321,6 +321,10 @@
     #define configUSE_MUTEXES    0
 #endif
 
+#ifndef configUSE_FAST_MUTEXES
+    #define configUSE_FAST_MUTEXES    0
+#endif
+
 #ifndef configUSE_TIMERS
     #define configUSE_TIMERS    0
 #endif
@@ -329,10 +333,93 @@
     #define configUSE_EVENT_GROUPS    1
 #endif
 
+#ifndef configEVENT_GROUP_ISR_MAX_WAITERS
+    #define configEVENT_GROUP_ISR_MAX_WAITERS    0
+#endif
+
+#ifndef configUSE_EVENT_GROUP_WAITER_INDEX
+    #define configUSE_EVENT_GROUP_WAITER_INDEX    0
+#endif
+
+#ifndef configUSE_64_BIT_EVENT_BITS
+    #define configUSE_64_BIT_EVENT_BITS    0
+#endif
+
 #ifndef configUSE_STREAM_BUFFERS
     #define configUSE_STREAM_BUFFERS    1
 #endif
 
+#ifndef configUSE_QUEUE_ZERO_COPY
+    #define configUSE_QUEUE_ZERO_COPY    0
+#endif
+
+#ifndef configUSE_QUEUE_BATCH_TRANSFER
+    #define configUSE_QUEUE_BATCH_TRANSFER    0
+#endif
+
+#ifndef configUSE_QUEUE_SIZED_COPY
+    #define configUSE_QUEUE_SIZED_COPY    0
+#endif
+
+#ifndef configUSE_PRIORITY_QUEUES
+    #define configUSE_PRIORITY_QUEUES    0
+#endif
+
+#ifndef configUSE_TASK_POOL
+    #define configUSE_TASK_POOL    0
+#endif
+
+#ifndef configTASK_POOL_NOTIFICATION_INDEX
+    #define configTASK_POOL_NOTIFICATION_INDEX    0
+#endif
+
+#ifndef configUSE_SPSC_QUEUES
+    #define configUSE_SPSC_QUEUES    0
+#endif
+
+#ifndef configSPSC_QUEUE_NOTIFICATION_INDEX
+    #define configSPSC_QUEUE_NOTIFICATION_INDEX    0
+#endif
+
+#ifndef configUSE_MPMC_QUEUES
+    #define configUSE_MPMC_QUEUES    0
+#endif
+
+#ifndef configUSE_RW_LOCKS
+    #define configUSE_RW_LOCKS    0
+#endif
+
+#ifndef configUSE_BROADCAST_CHANNELS
+    #define configUSE_BROADCAST_CHANNELS    0
+#endif
+
+#ifndef configBROADCAST_NOTIFICATION_INDEX
+    #define configBROADCAST_NOTIFICATION_INDEX    0
+#endif
+
+#ifndef configUSE_DEFERRED_WORK
+    #define configUSE_DEFERRED_WORK    0
+#endif
+
+#ifndef configDEFERRED_WORK_NOTIFICATION_INDEX
+    #define configDEFERRED_WORK_NOTIFICATION_INDEX    0
+#endif
+
+/* Each source of a deferred work level is one bit of the level's 32-bit
+ * notification value. */
+#ifndef configDEFERRED_WORK_SOURCES_PER_LEVEL
+    #define configDEFERRED_WORK_SOURCES_PER_LEVEL    8
+#endif
+
+/* The number of bytes that separate data written by different cores, or by a
+ * core and another bus master, so that the writes of one do not invalidate
+ * cached data used by the other.  Single core devices can have a data cache
+ * too, so the separation is applied to every build by default.  Set it to 1
+ * to remove the padding where RAM matters more than cache behaviour. */
+#ifndef configCACHE_LINE_SIZE
+    #define configCACHE_LINE_SIZE    64
+#endif
+
 #ifndef configUSE_DAEMON_TASK_STARTUP_HOOK
     #define configUSE_DAEMON_TASK_STARTUP_HOOK    0
 #endif
@@ -512,6 +599,32 @@
     #define configUSE_PASSIVE_IDLE_HOOK    0
 #endif /* configUSE_PASSIVE_IDLE_HOOK */
 
+#ifndef configUSE_EDF_SCHEDULING
+    #define configUSE_EDF_SCHEDULING    0
+#endif /* configUSE_EDF_SCHEDULING */
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    #ifndef configEDF_PRIORITY
+        #error If configUSE_EDF_SCHEDULING is set to 1 then configEDF_PRIORITY must also be defined.
+    #endif /* configEDF_PRIORITY */
+#endif
+
+#ifndef configUSE_TASK_CPU_BUDGET
+    #define configUSE_TASK_CPU_BUDGET    0
+#endif /* configUSE_TASK_CPU_BUDGET */
+
+#if ( ( configUSE_TASK_CPU_BUDGET == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_TASK_CPU_BUDGET requires configGENERATE_RUN_TIME_STATS to be set to 1 as budgets are measured with the run time stats counter.
+#endif
+
+#ifndef configTASK_RECYCLE_CACHE_DEPTH
+    #define configTASK_RECYCLE_CACHE_DEPTH    0
+#endif /* configTASK_RECYCLE_CACHE_DEPTH */
+
+#ifndef configUSE_WAIT_ANY
+    #define configUSE_WAIT_ANY    0
+#endif /* configUSE_WAIT_ANY */
+
 /* The timers module relies on xTaskGetSchedulerState(). */
 #if configUSE_TIMERS == 1
 
@@ -952,6 +1065,10 @@
     #define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )
 #endif
 
+#ifndef traceTASK_WAIT_ANY_BLOCK
+    #define traceTASK_WAIT_ANY_BLOCK( uxObjectCount )
+#endif
+
 #ifndef traceTASK_NOTIFY_TAKE
     #define traceTASK_NOTIFY_TAKE( uxIndexToWait )
 #endif
@@ -1044,6 +1161,30 @@
     #define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
 #endif
 
+#ifndef traceTASK_POOL_CREATE_FAILED
+    #define traceTASK_POOL_CREATE_FAILED()
+#endif
+
+#ifndef traceSPSC_QUEUE_CREATE_FAILED
+    #define traceSPSC_QUEUE_CREATE_FAILED()
+#endif
+
+#ifndef traceMPMC_QUEUE_CREATE_FAILED
+    #define traceMPMC_QUEUE_CREATE_FAILED()
+#endif
+
+#ifndef traceRW_LOCK_CREATE_FAILED
+    #define traceRW_LOCK_CREATE_FAILED()
+#endif
+
+#ifndef traceBROADCAST_CREATE_FAILED
+    #define traceBROADCAST_CREATE_FAILED()
+#endif
+
+#ifndef traceDEFERRED_WORK_CREATE_FAILED
+    #define traceDEFERRED_WORK_CREATE_FAILED()
+#endif
+
 #ifndef traceENTER_xEventGroupCreateStatic
     #define traceENTER_xEventGroupCreateStatic( pxEventGroupBuffer )
 #endif
@@ -1244,6 +1385,22 @@
     #define traceRETURN_xQueueTakeMutexRecursive( xReturn )
 #endif
 
+#ifndef traceENTER_xQueueTakeFastMutex
+    #define traceENTER_xQueueTakeFastMutex( xMutex, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueTakeFastMutex
+    #define traceRETURN_xQueueTakeFastMutex( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueGiveFastMutex
+    #define traceENTER_xQueueGiveFastMutex( xMutex )
+#endif
+
+#ifndef traceRETURN_xQueueGiveFastMutex
+    #define traceRETURN_xQueueGiveFastMutex( xReturn )
+#endif
+
 #ifndef traceENTER_xQueueCreateCountingSemaphoreStatic
     #define traceENTER_xQueueCreateCountingSemaphoreStatic( uxMaxCount, uxInitialCount, pxStaticQueue )
 #endif
@@ -1292,6 +1449,70 @@
     #define traceRETURN_xQueueReceive( xReturn )
 #endif
 
+#ifndef traceENTER_xQueueReserve
+    #define traceENTER_xQueueReserve( xQueue, ppvSlot, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueReserve
+    #define traceRETURN_xQueueReserve( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueCommit
+    #define traceENTER_xQueueCommit( xQueue )
+#endif
+
+#ifndef traceRETURN_xQueueCommit
+    #define traceRETURN_xQueueCommit( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueAcquire
+    #define traceENTER_xQueueAcquire( xQueue, ppvItem, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueAcquire
+    #define traceRETURN_xQueueAcquire( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueRelease
+    #define traceENTER_xQueueRelease( xQueue )
+#endif
+
+#ifndef traceRETURN_xQueueRelease
+    #define traceRETURN_xQueueRelease( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueSendMultiple
+    #define traceENTER_xQueueSendMultiple( xQueue, pvItems, uxMinItems, uxMaxItems, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueSendMultiple
+    #define traceRETURN_xQueueSendMultiple( uxReturn )
+#endif
+
+#ifndef traceENTER_xQueueSendMultipleFromISR
+    #define traceENTER_xQueueSendMultipleFromISR( xQueue, pvItems, uxMaxItems, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xQueueSendMultipleFromISR
+    #define traceRETURN_xQueueSendMultipleFromISR( uxReturn )
+#endif
+
+#ifndef traceENTER_xQueueReceiveMultiple
+    #define traceENTER_xQueueReceiveMultiple( xQueue, pvBuffer, uxMinItems, uxMaxItems, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueReceiveMultiple
+    #define traceRETURN_xQueueReceiveMultiple( uxReturn )
+#endif
+
+#ifndef traceENTER_xQueueReceiveMultipleFromISR
+    #define traceENTER_xQueueReceiveMultipleFromISR( xQueue, pvBuffer, uxMaxItems, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xQueueReceiveMultipleFromISR
+    #define traceRETURN_xQueueReceiveMultipleFromISR( uxReturn )
+#endif
+
 #ifndef traceENTER_xQueueSemaphoreTake
     #define traceENTER_xQueueSemaphoreTake( xQueue, xTicksToWait )
 #endif
@@ -1476,6 +1697,14 @@
     #define traceRETURN_vQueueWaitForMessageRestricted()
 #endif
 
+#ifndef traceENTER_pxQueueGetWaitAnyListRestricted
+    #define traceENTER_pxQueueGetWaitAnyListRestricted( xQueue )
+#endif
+
+#ifndef traceRETURN_pxQueueGetWaitAnyListRestricted
+    #define traceRETURN_pxQueueGetWaitAnyListRestricted( pxReturn )
+#endif
+
 #ifndef traceENTER_xQueueCreateSet
     #define traceENTER_xQueueCreateSet( uxEventQueueLength )
 #endif
@@ -1748,6 +1977,14 @@
     #define traceRETURN_xTaskCreateAffinitySet( xReturn )
 #endif
 
+#ifndef traceENTER_xTaskCreateEdf
+    #define traceENTER_xTaskCreateEdf( pxTaskCode, pcName, uxStackDepth, pvParameters, xPeriod, xRelativeDeadline, xWorstCaseExecutionTime, pxCreatedTask )
+#endif
+
+#ifndef traceRETURN_xTaskCreateEdf
+    #define traceRETURN_xTaskCreateEdf( xReturn )
+#endif
+
 #ifndef traceENTER_vTaskDelete
     #define traceENTER_vTaskDelete( xTaskToDelete )
 #endif
@@ -1756,6 +1993,22 @@
     #define traceRETURN_vTaskDelete()
 #endif
 
+#ifndef traceENTER_vTaskGetRecycleCacheStats
+    #define traceENTER_vTaskGetRecycleCacheStats( puxHits, puxMisses )
+#endif
+
+#ifndef traceRETURN_vTaskGetRecycleCacheStats
+    #define traceRETURN_vTaskGetRecycleCacheStats()
+#endif
+
+#ifndef traceENTER_vTaskFlushRecycleCache
+    #define traceENTER_vTaskFlushRecycleCache()
+#endif
+
+#ifndef traceRETURN_vTaskFlushRecycleCache
+    #define traceRETURN_vTaskFlushRecycleCache()
+#endif
+
 #ifndef traceENTER_xTaskDelayUntil
     #define traceENTER_xTaskDelayUntil( pxPreviousWakeTime, xTimeIncrement )
 #endif
@@ -1772,6 +2025,14 @@
     #define traceRETURN_vTaskDelay()
 #endif
 
+#ifndef traceENTER_vTaskEdfWaitForNextPeriod
+    #define traceENTER_vTaskEdfWaitForNextPeriod()
+#endif
+
+#ifndef traceRETURN_vTaskEdfWaitForNextPeriod
+    #define traceRETURN_vTaskEdfWaitForNextPeriod()
+#endif
+
 #ifndef traceENTER_eTaskGetState
     #define traceENTER_eTaskGetState( xTask )
 #endif
@@ -1820,6 +2081,14 @@
     #define traceRETURN_vTaskPrioritySet()
 #endif
 
+#ifndef traceENTER_vTaskSetCpuBudget
+    #define traceENTER_vTaskSetCpuBudget( xTask, ulBudget, xPeriod )
+#endif
+
+#ifndef traceRETURN_vTaskSetCpuBudget
+    #define traceRETURN_vTaskSetCpuBudget()
+#endif
+
 #ifndef traceENTER_vTaskCoreAffinitySet
     #define traceENTER_vTaskCoreAffinitySet( xTask, uxCoreAffinityMask )
 #endif
@@ -2064,6 +2333,14 @@
     #define traceRETURN_vTaskPlaceOnEventList()
 #endif
 
+#ifndef traceENTER_vTaskPlaceOnEventListForBatch
+    #define traceENTER_vTaskPlaceOnEventListForBatch( pxEventList, uxItemsNeeded, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_vTaskPlaceOnEventListForBatch
+    #define traceRETURN_vTaskPlaceOnEventListForBatch()
+#endif
+
 #ifndef traceENTER_vTaskPlaceOnUnorderedEventList
     #define traceENTER_vTaskPlaceOnUnorderedEventList( pxEventList, xItemValue, xTicksToWait )
 #endif
@@ -2088,6 +2365,14 @@
     #define traceRETURN_xTaskRemoveFromEventList( xReturn )
 #endif
 
+#ifndef traceENTER_xTaskRemoveFromEventListForBatch
+    #define traceENTER_xTaskRemoveFromEventListForBatch( pxEventList, uxAvailable, uxAdded )
+#endif
+
+#ifndef traceRETURN_xTaskRemoveFromEventListForBatch
+    #define traceRETURN_xTaskRemoveFromEventListForBatch( xReturn )
+#endif
+
 #ifndef traceENTER_vTaskRemoveFromUnorderedEventList
     #define traceENTER_vTaskRemoveFromUnorderedEventList( pxEventListItem, xItemValue )
 #endif
@@ -2096,6 +2381,14 @@
     #define traceRETURN_vTaskRemoveFromUnorderedEventList()
 #endif
 
+#ifndef traceENTER_xTaskRemoveFromUnorderedEventListFromISR
+    #define traceENTER_xTaskRemoveFromUnorderedEventListFromISR( pxEventListItem, xItemValue )
+#endif
+
+#ifndef traceRETURN_xTaskRemoveFromUnorderedEventListFromISR
+    #define traceRETURN_xTaskRemoveFromUnorderedEventListFromISR( xReturn )
+#endif
+
 #ifndef traceENTER_vTaskSetTimeOutState
     #define traceENTER_vTaskSetTimeOutState( pxTimeOut )
 #endif
@@ -2312,6 +2605,14 @@
     #define traceRETURN_uxTaskResetEventItemValue( uxReturn )
 #endif
 
+#ifndef traceENTER_uxTaskGetEventItemValue
+    #define traceENTER_uxTaskGetEventItemValue( pxEventListItem )
+#endif
+
+#ifndef traceRETURN_uxTaskGetEventItemValue
+    #define traceRETURN_uxTaskGetEventItemValue( uxReturn )
+#endif
+
 #ifndef traceENTER_pvTaskIncrementMutexHeldCount
     #define traceENTER_pvTaskIncrementMutexHeldCount()
 #endif
@@ -2320,6 +2621,14 @@
     #define traceRETURN_pvTaskIncrementMutexHeldCount( pxTCB )
 #endif
 
+#ifndef traceENTER_vTaskIncrementMutexHeldCountOfHolder
+    #define traceENTER_vTaskIncrementMutexHeldCountOfHolder( xMutexHolder )
+#endif
+
+#ifndef traceRETURN_vTaskIncrementMutexHeldCountOfHolder
+    #define traceRETURN_vTaskIncrementMutexHeldCountOfHolder()
+#endif
+
 #ifndef traceENTER_ulTaskGenericNotifyTake
     #define traceENTER_ulTaskGenericNotifyTake( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait )
 #endif
@@ -2328,6 +2637,14 @@
     #define traceRETURN_ulTaskGenericNotifyTake( ulReturn )
 #endif
 
+#ifndef traceENTER_ulTaskGenericNotifyTakeUpTo
+    #define traceENTER_ulTaskGenericNotifyTakeUpTo( uxIndexToWaitOn, ulMaxCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_ulTaskGenericNotifyTakeUpTo
+    #define traceRETURN_ulTaskGenericNotifyTakeUpTo( ulReturn )
+#endif
+
 #ifndef traceENTER_xTaskGenericNotifyWait
     #define traceENTER_xTaskGenericNotifyWait( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait )
 #endif
@@ -2376,6 +2693,14 @@
     #define traceRETURN_ulTaskGenericNotifyValueClear( ulReturn )
 #endif
 
+#ifndef traceENTER_xTaskWaitAny
+    #define traceENTER_xTaskWaitAny( pxObjects, uxObjectCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTaskWaitAny
+    #define traceRETURN_xTaskWaitAny( xReturn )
+#endif
+
 #ifndef traceENTER_ulTaskGetRunTimeCounter
     #define traceENTER_ulTaskGetRunTimeCounter( xTask )
 #endif
@@ -2528,6 +2853,118 @@
     #define traceRETURN_xStreamBufferReceiveFromISR( xReceivedLength )
 #endif
 
+#ifndef traceENTER_xStreamBufferGetWriteWindow
+    #define traceENTER_xStreamBufferGetWriteWindow( xStreamBuffer, pxWindow, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferGetWriteWindow
+    #define traceRETURN_xStreamBufferGetWriteWindow( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferGetWriteWindowFromISR
+    #define traceENTER_xStreamBufferGetWriteWindowFromISR( xStreamBuffer, pxWindow )
+#endif
+
+#ifndef traceRETURN_xStreamBufferGetWriteWindowFromISR
+    #define traceRETURN_xStreamBufferGetWriteWindowFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferCommitWrite
+    #define traceENTER_xStreamBufferCommitWrite( xStreamBuffer, xBytesWritten )
+#endif
+
+#ifndef traceRETURN_xStreamBufferCommitWrite
+    #define traceRETURN_xStreamBufferCommitWrite( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferCommitWriteFromISR
+    #define traceENTER_xStreamBufferCommitWriteFromISR( xStreamBuffer, xBytesWritten, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferCommitWriteFromISR
+    #define traceRETURN_xStreamBufferCommitWriteFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferGetReadWindow
+    #define traceENTER_xStreamBufferGetReadWindow( xStreamBuffer, pxWindow, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferGetReadWindow
+    #define traceRETURN_xStreamBufferGetReadWindow( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferGetReadWindowFromISR
+    #define traceENTER_xStreamBufferGetReadWindowFromISR( xStreamBuffer, pxWindow )
+#endif
+
+#ifndef traceRETURN_xStreamBufferGetReadWindowFromISR
+    #define traceRETURN_xStreamBufferGetReadWindowFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferConsume
+    #define traceENTER_xStreamBufferConsume( xStreamBuffer, xBytesConsumed )
+#endif
+
+#ifndef traceRETURN_xStreamBufferConsume
+    #define traceRETURN_xStreamBufferConsume( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferConsumeFromISR
+    #define traceENTER_xStreamBufferConsumeFromISR( xStreamBuffer, xBytesConsumed, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferConsumeFromISR
+    #define traceRETURN_xStreamBufferConsumeFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferSendV
+    #define traceENTER_xStreamBufferSendV( xStreamBuffer, pxSegments, xSegmentCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferSendV
+    #define traceRETURN_xStreamBufferSendV( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferSendVFromISR
+    #define traceENTER_xStreamBufferSendVFromISR( xStreamBuffer, pxSegments, xSegmentCount, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferSendVFromISR
+    #define traceRETURN_xStreamBufferSendVFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferPeekMessage
+    #define traceENTER_xStreamBufferPeekMessage( xStreamBuffer, pxWindow, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferPeekMessage
+    #define traceRETURN_xStreamBufferPeekMessage( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferPeekMessageFromISR
+    #define traceENTER_xStreamBufferPeekMessageFromISR( xStreamBuffer, pxWindow )
+#endif
+
+#ifndef traceRETURN_xStreamBufferPeekMessageFromISR
+    #define traceRETURN_xStreamBufferPeekMessageFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferDiscardMessage
+    #define traceENTER_xStreamBufferDiscardMessage( xStreamBuffer )
+#endif
+
+#ifndef traceRETURN_xStreamBufferDiscardMessage
+    #define traceRETURN_xStreamBufferDiscardMessage( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferDiscardMessageFromISR
+    #define traceENTER_xStreamBufferDiscardMessageFromISR( xStreamBuffer, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferDiscardMessageFromISR
+    #define traceRETURN_xStreamBufferDiscardMessageFromISR( xReturn )
+#endif
+
 #ifndef traceENTER_xStreamBufferIsEmpty
     #define traceENTER_xStreamBufferIsEmpty( xStreamBuffer )
 #endif
@@ -2576,6 +3013,14 @@
     #define traceRETURN_vStreamBufferSetStreamBufferNotificationIndex()
 #endif
 
+#ifndef traceENTER_uxStreamBufferSetWaitingReceiverRestricted
+    #define traceENTER_uxStreamBufferSetWaitingReceiverRestricted( xStreamBuffer, xTask )
+#endif
+
+#ifndef traceRETURN_uxStreamBufferSetWaitingReceiverRestricted
+    #define traceRETURN_uxStreamBufferSetWaitingReceiverRestricted( uxReturn )
+#endif
+
 #ifndef traceENTER_uxStreamBufferGetStreamBufferNumber
     #define traceENTER_uxStreamBufferGetStreamBufferNumber( xStreamBuffer )
 #endif
@@ -2600,6 +3045,278 @@
     #define traceRETURN_ucStreamBufferGetStreamBufferType( ucStreamBufferType )
 #endif
 
+#ifndef traceENTER_xTaskPoolCreate
+    #define traceENTER_xTaskPoolCreate( pcName, uxWorkerCount, uxJobsPerWorker, uxStackDepth, uxPriority )
+#endif
+
+#ifndef traceRETURN_xTaskPoolCreate
+    #define traceRETURN_xTaskPoolCreate( pxPool )
+#endif
+
+#ifndef traceENTER_vTaskPoolInitialiseFuture
+    #define traceENTER_vTaskPoolInitialiseFuture( pxFuture )
+#endif
+
+#ifndef traceRETURN_vTaskPoolInitialiseFuture
+    #define traceRETURN_vTaskPoolInitialiseFuture()
+#endif
+
+#ifndef traceENTER_xTaskPoolSubmit
+    #define traceENTER_xTaskPoolSubmit( xPool, pxFunction, pvArgument, pxFuture )
+#endif
+
+#ifndef traceRETURN_xTaskPoolSubmit
+    #define traceRETURN_xTaskPoolSubmit( xReturn )
+#endif
+
+#ifndef traceENTER_uxTaskPoolSubmitBatch
+    #define traceENTER_uxTaskPoolSubmitBatch( xPool, pxJobs, uxJobCount, pxFuture )
+#endif
+
+#ifndef traceRETURN_uxTaskPoolSubmitBatch
+    #define traceRETURN_uxTaskPoolSubmitBatch( uxSubmitted )
+#endif
+
+#ifndef traceENTER_xTaskPoolWait
+    #define traceENTER_xTaskPoolWait( pxFuture, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTaskPoolWait
+    #define traceRETURN_xTaskPoolWait( xReturn )
+#endif
+
+#ifndef traceENTER_xSpscQueueCreate
+    #define traceENTER_xSpscQueueCreate( uxLength, uxItemSize )
+#endif
+
+#ifndef traceRETURN_xSpscQueueCreate
+    #define traceRETURN_xSpscQueueCreate( xReturn )
+#endif
+
+#ifndef traceENTER_vSpscQueueDelete
+    #define traceENTER_vSpscQueueDelete( xQueue )
+#endif
+
+#ifndef traceRETURN_vSpscQueueDelete
+    #define traceRETURN_vSpscQueueDelete()
+#endif
+
+#ifndef traceENTER_xSpscQueueSend
+    #define traceENTER_xSpscQueueSend( xQueue, pvItem, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xSpscQueueSend
+    #define traceRETURN_xSpscQueueSend( xReturn )
+#endif
+
+#ifndef traceENTER_xSpscQueueSendFromISR
+    #define traceENTER_xSpscQueueSendFromISR( xQueue, pvItem, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xSpscQueueSendFromISR
+    #define traceRETURN_xSpscQueueSendFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xSpscQueueReceive
+    #define traceENTER_xSpscQueueReceive( xQueue, pvBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xSpscQueueReceive
+    #define traceRETURN_xSpscQueueReceive( xReturn )
+#endif
+
+#ifndef traceENTER_uxSpscQueueMessagesWaiting
+    #define traceENTER_uxSpscQueueMessagesWaiting( xQueue )
+#endif
+
+#ifndef traceRETURN_uxSpscQueueMessagesWaiting
+    #define traceRETURN_uxSpscQueueMessagesWaiting( uxReturn )
+#endif
+
+#ifndef traceENTER_xMpmcQueueCreate
+    #define traceENTER_xMpmcQueueCreate( uxLength, uxItemSize )
+#endif
+
+#ifndef traceRETURN_xMpmcQueueCreate
+    #define traceRETURN_xMpmcQueueCreate( xReturn )
+#endif
+
+#ifndef traceENTER_vMpmcQueueDelete
+    #define traceENTER_vMpmcQueueDelete( xQueue )
+#endif
+
+#ifndef traceRETURN_vMpmcQueueDelete
+    #define traceRETURN_vMpmcQueueDelete()
+#endif
+
+#ifndef traceENTER_xMpmcQueueSend
+    #define traceENTER_xMpmcQueueSend( xQueue, pvItem, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xMpmcQueueSend
+    #define traceRETURN_xMpmcQueueSend( xReturn )
+#endif
+
+#ifndef traceENTER_xMpmcQueueReceive
+    #define traceENTER_xMpmcQueueReceive( xQueue, pvBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xMpmcQueueReceive
+    #define traceRETURN_xMpmcQueueReceive( xReturn )
+#endif
+
+#ifndef traceENTER_uxMpmcQueueMessagesWaiting
+    #define traceENTER_uxMpmcQueueMessagesWaiting( xQueue )
+#endif
+
+#ifndef traceRETURN_uxMpmcQueueMessagesWaiting
+    #define traceRETURN_uxMpmcQueueMessagesWaiting( uxReturn )
+#endif
+
+#ifndef traceENTER_xRwLockCreate
+    #define traceENTER_xRwLockCreate( uxMaxReaders )
+#endif
+
+#ifndef traceRETURN_xRwLockCreate
+    #define traceRETURN_xRwLockCreate( xReturn )
+#endif
+
+#ifndef traceENTER_vRwLockDelete
+    #define traceENTER_vRwLockDelete( xRwLock )
+#endif
+
+#ifndef traceRETURN_vRwLockDelete
+    #define traceRETURN_vRwLockDelete()
+#endif
+
+#ifndef traceENTER_xRwLockTakeRead
+    #define traceENTER_xRwLockTakeRead( xRwLock, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xRwLockTakeRead
+    #define traceRETURN_xRwLockTakeRead( xReturn )
+#endif
+
+#ifndef traceENTER_xRwLockGiveRead
+    #define traceENTER_xRwLockGiveRead( xRwLock )
+#endif
+
+#ifndef traceRETURN_xRwLockGiveRead
+    #define traceRETURN_xRwLockGiveRead( xReturn )
+#endif
+
+#ifndef traceENTER_xRwLockTakeWrite
+    #define traceENTER_xRwLockTakeWrite( xRwLock, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xRwLockTakeWrite
+    #define traceRETURN_xRwLockTakeWrite( xReturn )
+#endif
+
+#ifndef traceENTER_xRwLockGiveWrite
+    #define traceENTER_xRwLockGiveWrite( xRwLock )
+#endif
+
+#ifndef traceRETURN_xRwLockGiveWrite
+    #define traceRETURN_xRwLockGiveWrite( xReturn )
+#endif
+
+#ifndef traceENTER_xBroadcastCreate
+    #define traceENTER_xBroadcastCreate( uxLength, uxItemSize, uxMaxSubscribers )
+#endif
+
+#ifndef traceRETURN_xBroadcastCreate
+    #define traceRETURN_xBroadcastCreate( xReturn )
+#endif
+
+#ifndef traceENTER_vBroadcastDelete
+    #define traceENTER_vBroadcastDelete( xChannel )
+#endif
+
+#ifndef traceRETURN_vBroadcastDelete
+    #define traceRETURN_vBroadcastDelete()
+#endif
+
+#ifndef traceENTER_xBroadcastSubscribe
+    #define traceENTER_xBroadcastSubscribe( xChannel )
+#endif
+
+#ifndef traceRETURN_xBroadcastSubscribe
+    #define traceRETURN_xBroadcastSubscribe( xReturn )
+#endif
+
+#ifndef traceENTER_vBroadcastUnsubscribe
+    #define traceENTER_vBroadcastUnsubscribe( xSubscriber )
+#endif
+
+#ifndef traceRETURN_vBroadcastUnsubscribe
+    #define traceRETURN_vBroadcastUnsubscribe()
+#endif
+
+#ifndef traceENTER_vBroadcastPublish
+    #define traceENTER_vBroadcastPublish( xChannel, pvItem )
+#endif
+
+#ifndef traceRETURN_vBroadcastPublish
+    #define traceRETURN_vBroadcastPublish()
+#endif
+
+#ifndef traceENTER_vBroadcastPublishFromISR
+    #define traceENTER_vBroadcastPublishFromISR( xChannel, pvItem, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_vBroadcastPublishFromISR
+    #define traceRETURN_vBroadcastPublishFromISR()
+#endif
+
+#ifndef traceENTER_xBroadcastReceive
+    #define traceENTER_xBroadcastReceive( xSubscriber, pvBuffer, pulMissed, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xBroadcastReceive
+    #define traceRETURN_xBroadcastReceive( xReturn )
+#endif
+
+#ifndef traceENTER_xDeferredWorkCreate
+    #define traceENTER_xDeferredWorkCreate( pcName, uxLevels, uxStackDepth, uxLowestPriority )
+#endif
+
+#ifndef traceRETURN_xDeferredWorkCreate
+    #define traceRETURN_xDeferredWorkCreate( pxService )
+#endif
+
+#ifndef traceENTER_xDeferredWorkRegister
+    #define traceENTER_xDeferredWorkRegister( xService, uxLevel, pxFunction, pvArgument, pxSource )
+#endif
+
+#ifndef traceRETURN_xDeferredWorkRegister
+    #define traceRETURN_xDeferredWorkRegister( xReturn )
+#endif
+
+#ifndef traceENTER_xDeferredWorkPend
+    #define traceENTER_xDeferredWorkPend( xService, xSource )
+#endif
+
+#ifndef traceRETURN_xDeferredWorkPend
+    #define traceRETURN_xDeferredWorkPend( xReturn )
+#endif
+
+#ifndef traceENTER_xDeferredWorkPendFromISR
+    #define traceENTER_xDeferredWorkPendFromISR( xService, xSource, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xDeferredWorkPendFromISR
+    #define traceRETURN_xDeferredWorkPendFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_vDeferredWorkGetStats
+    #define traceENTER_vDeferredWorkGetStats( xService, uxLevel, pxStats )
+#endif
+
+#ifndef traceRETURN_vDeferredWorkGetStats
+    #define traceRETURN_vDeferredWorkGetStats()
+#endif
+
 #ifndef traceENTER_vListInitialise
     #define traceENTER_vListInitialise( pxList )
 #endif
@@ -2802,6 +3519,34 @@
     #error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
 #endif
 
+#if ( ( configUSE_TASK_POOL == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_TASK_POOL requires configUSE_TASK_NOTIFICATIONS to be set to 1 as the workers are signalled with task notifications.
+#endif
+
+#if ( ( configUSE_SPSC_QUEUES == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_SPSC_QUEUES requires configUSE_TASK_NOTIFICATIONS to be set to 1 as a blocked consumer is woken with a task notification.
+#endif
+
+#if ( ( configUSE_BROADCAST_CHANNELS == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_BROADCAST_CHANNELS requires configUSE_TASK_NOTIFICATIONS to be set to 1 as blocked subscribers are woken with task notifications.
+#endif
+
+#if ( ( configUSE_DEFERRED_WORK == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_DEFERRED_WORK requires configUSE_TASK_NOTIFICATIONS to be set to 1 as pending sources are held in the notification values of the workers.
+#endif
+
+#if ( ( configUSE_DEFERRED_WORK == 1 ) && ( ( configDEFERRED_WORK_SOURCES_PER_LEVEL < 1 ) || ( configDEFERRED_WORK_SOURCES_PER_LEVEL > 32 ) ) )
+    #error configDEFERRED_WORK_SOURCES_PER_LEVEL must be between 1 and 32 as each source is one bit of a notification value.
+#endif
+
+#if ( ( configUSE_WAIT_ANY == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_WAIT_ANY requires configUSE_TASK_NOTIFICATIONS to be set to 1 as stream buffers and notifications are waited on through the notification state.
+#endif
+
+#if ( ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 ) && ( ( configUSE_EVENT_GROUPS != 1 ) || ( configUSE_TIMERS != 1 ) || ( INCLUDE_xTimerPendFunctionCall != 1 ) ) )
+    #error configEVENT_GROUP_ISR_MAX_WAITERS requires configUSE_EVENT_GROUPS, configUSE_TIMERS and INCLUDE_xTimerPendFunctionCall to be set to 1 as xEventGroupSetBitsFromISR() defers to the timer task when too many tasks are waiting.
+#endif
+
 #ifndef configUSE_POSIX_ERRNO
     #define configUSE_POSIX_ERRNO    0
 #endif
@@ -2812,6 +3557,14 @@
     #define configUSE_SB_COMPLETED_CALLBACK    0
 #endif
 
+#ifndef configUSE_STREAM_BUFFER_ZERO_COPY
+    #define configUSE_STREAM_BUFFER_ZERO_COPY    0
+#endif
+
+#ifndef configUSE_STREAM_BUFFER_MULTI_WRITER
+    #define configUSE_STREAM_BUFFER_MULTI_WRITER    0
+#endif
+
 #ifndef portTICK_TYPE_IS_ATOMIC
     #define portTICK_TYPE_IS_ATOMIC    0
 #endif
@@ -2834,6 +3587,10 @@
     #error configUSE_STATS_FORMATTING_FUNCTIONS cannot be used without dynamic allocation, but configSUPPORT_DYNAMIC_ALLOCATION is not set to 1.
 #endif
 
+#if ( ( configTASK_RECYCLE_CACHE_DEPTH > 0 ) && ( ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) || ( INCLUDE_vTaskDelete != 1 ) ) )
+    #error configTASK_RECYCLE_CACHE_DEPTH can only be greater than 0 if both configSUPPORT_DYNAMIC_ALLOCATION and INCLUDE_vTaskDelete are set to 1.
+#endif
+
 #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
     #if ( ( configUSE_TRACE_FACILITY != 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
         #error configUSE_STATS_FORMATTING_FUNCTIONS is 1 but the functions it enables are not used because neither configUSE_TRACE_FACILITY or configGENERATE_RUN_TIME_STATS are 1.  Set configUSE_STATS_FORMATTING_FUNCTIONS to 0 in FreeRTOSConfig.h.
@@ -2876,6 +3633,22 @@
     #error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
 
+#if ( ( configUSE_FAST_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_MUTEXES must be set to 1 to use fast mutexes
+#endif
+
+#if ( ( configUSE_RW_LOCKS == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_MUTEXES must be set to 1 to use reader-writer locks
+#endif
+
+#if ( ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 ) && ( configUSE_STREAM_BUFFERS != 1 ) )
+    #error configUSE_STREAM_BUFFERS must be set to 1 to use zero-copy stream buffer windows
+#endif
+
+#if ( ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 ) && ( configUSE_STREAM_BUFFERS != 1 ) )
+    #error configUSE_STREAM_BUFFERS must be set to 1 to use multi-writer stream buffers
+#endif
+
 #if ( ( configRUN_MULTIPLE_PRIORITIES == 0 ) && ( configUSE_TASK_PREEMPTION_DISABLE != 0 ) )
     #error configRUN_MULTIPLE_PRIORITIES must be set to 1 to use task preemption disable
 #endif
@@ -2892,6 +3665,14 @@
     #error configUSE_CORE_AFFINITY is not supported in single core FreeRTOS
 #endif
 
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SCHEDULING != 0 ) )
+    #error configUSE_EDF_SCHEDULING is not supported in SMP FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_TASK_CPU_BUDGET != 0 ) )
+    #error configUSE_TASK_CPU_BUDGET is not supported in SMP FreeRTOS
+#endif
+
 #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_PORT_OPTIMISED_TASK_SELECTION != 0 ) )
     #error configUSE_PORT_OPTIMISED_TASK_SELECTION is not supported in SMP FreeRTOS
 #endif
@@ -3096,6 +3877,14 @@
     ( ( ( portUSING_MPU_WRAPPERS == 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) || \
       ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) )
 
+/* An event group stores the bits a blocked task is waiting for, and later the
+ * bits that unblocked it, in the task's event list item.  If
+ * configUSE_64_BIT_EVENT_BITS makes event bits wider than TickType_t they no
+ * longer fit in a list item value, and a member of the TCB is used instead.
+ * tskEVENT_ITEM_VALUE_IN_TCB is only true when that is the case. */
+#define tskEVENT_ITEM_VALUE_IN_TCB \
+    ( ( configUSE_64_BIT_EVENT_BITS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+
 /*
  * In line with software engineering best practice, FreeRTOS implements a strict
  * data hiding policy, so the real structures used by FreeRTOS to maintain the
@@ -3219,6 +4008,29 @@ typedef struct xSTATIC_TCB
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iDummy22;
     #endif
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        TickType_t xDummy29[ 5 ];
+        UBaseType_t uxDummy30[ 2 ];
+        BaseType_t xDummy39;
+    #endif
+    #if ( configUSE_TASK_CPU_BUDGET == 1 )
+        configRUN_TIME_COUNTER_TYPE ulDummy31[ 2 ];
+        TickType_t xDummy32[ 2 ];
+        UBaseType_t uxDummy33;
+    #endif
+    #if ( configTASK_RECYCLE_CACHE_DEPTH > 0 )
+        configSTACK_DEPTH_TYPE uxDummy34;
+    #endif
+    #if ( configUSE_WAIT_ANY == 1 )
+        void * pvDummy35;
+        UBaseType_t uxDummy36;
+    #endif
+    #if ( tskEVENT_ITEM_VALUE_IN_TCB != 0 )
+        uint64_t uxDummy37;
+    #endif
+    #if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+        UBaseType_t uxDummy38;
+    #endif
 } StaticTask_t;
 
 /*
@@ -3261,6 +4073,19 @@ typedef struct xSTATIC_QUEUE
         UBaseType_t uxDummy8;
         uint8_t ucDummy9;
     #endif
+
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        uint8_t ucDummy10;
+    #endif
+
+    #if ( configUSE_QUEUE_SIZED_COPY == 1 )
+        uint8_t ucDummy11;
+    #endif
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        uint8_t ucDummy12;
+        UBaseType_t uxDummy13;
+    #endif
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
@@ -3280,9 +4105,27 @@ typedef StaticQueue_t StaticSemaphore_t;
  */
 typedef struct xSTATIC_EVENT_GROUP
 {
-    TickType_t xDummy1;
+    #if ( configUSE_64_BIT_EVENT_BITS == 1 )
+        uint64_t xDummy1;
+    #else
+        TickType_t xDummy1;
+    #endif
     StaticList_t xDummy2;
 
+    #if ( ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 ) && ( configUSE_64_BIT_EVENT_BITS == 1 ) )
+        StaticList_t xDummy5[ ( sizeof( uint64_t ) * ( size_t ) 8 ) - ( size_t ) 8 ];
+    #elif ( configUSE_EVENT_GROUP_WAITER_INDEX == 1 )
+        StaticList_t xDummy5[ ( sizeof( TickType_t ) * ( size_t ) 8 ) - ( size_t ) 8 ];
+    #endif
+
+    #if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+        UBaseType_t uxDummy6;
+    #endif
+
+    #if ( configUSE_64_BIT_EVENT_BITS == 1 )
+        uint64_t xDummy7[ 2 ];
+    #endif
+
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy3;
     #endif
@@ -3345,6 +4188,10 @@ typedef struct xSTATIC_STREAM_BUFFER
         void * pvDummy5[ 2 ];
     #endif
     UBaseType_t uxDummy6;
+    #if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+        uint32_t ulDummy7;
+        StaticList_t xDummy8;
+    #endif
 } StaticStreamBuffer_t;
 
 /* Message buffers are built on stream buffers. */
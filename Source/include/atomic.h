@@ -67,7 +67,17 @@
  * ATOMIC_ENTER_CRITICAL().
  *
  */
-#if ( portHAS_NESTED_INTERRUPTS == 1 )
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* Masking interrupts only protects against the core doing the masking, so
+ * the ISR lock must also be taken to exclude the other cores. */
+    #define ATOMIC_ENTER_CRITICAL() \
+    UBaseType_t uxCriticalSectionType = portENTER_CRITICAL_FROM_ISR()
+
+    #define ATOMIC_EXIT_CRITICAL() \
+    portEXIT_CRITICAL_FROM_ISR( uxCriticalSectionType )
+
+#elif ( portHAS_NESTED_INTERRUPTS == 1 )
 
 /* Nested interrupt scheme is supported in this port. */
     #define ATOMIC_ENTER_CRITICAL() \
@@ -84,15 +94,43 @@
 
 #endif /* portSET_INTERRUPT_MASK_FROM_ISR() */
 
+/*
+ * Port specific definition -- use the compiler's atomic builtins.
+ * In SMP builds the critical section above takes the ISR lock, which is shared
+ * by every core, so every atomic operation in the system would serialise on
+ * it.  When the compiler provides lock-free __atomic builtins for 32-bit and
+ * pointer sized values they are used instead.  A port can set
+ * portATOMIC_USE_COMPILER_BUILTINS to 0 in portmacro.h to keep the critical
+ * section, or to 1 to force the builtins.  Targets such as Cortex-M0+ have no
+ * exclusive access instructions, so the compiler does not report the builtins
+ * as lock-free and the critical section is kept.
+ */
+#ifndef portATOMIC_USE_COMPILER_BUILTINS
+    #if ( configNUMBER_OF_CORES > 1 ) && defined( __GCC_ATOMIC_INT_LOCK_FREE ) && defined( __GCC_ATOMIC_POINTER_LOCK_FREE )
+        #if ( __GCC_ATOMIC_INT_LOCK_FREE == 2 ) && ( __GCC_ATOMIC_POINTER_LOCK_FREE == 2 )
+            #define portATOMIC_USE_COMPILER_BUILTINS    1
+        #endif
+    #endif
+#endif
+
+#ifndef portATOMIC_USE_COMPILER_BUILTINS
+    #define portATOMIC_USE_COMPILER_BUILTINS    0
+#endif
+
 /*
  * Port specific definition -- "always inline".
  * Inline is compiler specific, and may not always get inlined depending on your
  * optimization level.  Also, inline is considered as performance optimization
  * for atomic.  Thus, if portFORCE_INLINE is not provided by portmacro.h,
- * instead of resulting error, simply define it away.
+ * instead of resulting error, simply define it away.  The __atomic builtins are
+ * only used with GCC compatible compilers, which always accept __inline__.
  */
 #ifndef portFORCE_INLINE
-    #define portFORCE_INLINE
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
+        #define portFORCE_INLINE    __inline__
+    #else
+        #define portFORCE_INLINE
+    #endif
 #endif
 
 #define ATOMIC_COMPARE_AND_SWAP_SUCCESS    0x1U     /**< Compare and swap succeeded, swapped. */
@@ -121,11 +159,10 @@ static portFORCE_INLINE uint32_t Atomic_CompareAndSwap_u32( uint32_t volatile *
 {
     uint32_t ulReturnValue;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
     {
-        if( *pulDestination == ulComparand )
+        if( __atomic_compare_exchange_n( pulDestination, &ulComparand, ulExchange, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) )
         {
-            *pulDestination = ulExchange;
             ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
         }
         else
@@ -133,7 +170,23 @@ static portFORCE_INLINE uint32_t Atomic_CompareAndSwap_u32( uint32_t volatile *
             ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
         }
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            if( *pulDestination == ulComparand )
+            {
+                *pulDestination = ulExchange;
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
+            else
+            {
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+            }
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulReturnValue;
 }
@@ -156,12 +209,20 @@ static portFORCE_INLINE void * Atomic_SwapPointers_p32( void * volatile * ppvDes
 {
     void * pReturnValue;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
     {
-        pReturnValue = *ppvDestination;
-        *ppvDestination = pvExchange;
+        pReturnValue = __atomic_exchange_n( ppvDestination, pvExchange, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            pReturnValue = *ppvDestination;
+            *ppvDestination = pvExchange;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return pReturnValue;
 }
@@ -189,15 +250,26 @@ static portFORCE_INLINE uint32_t Atomic_CompareAndSwapPointers_p32( void * volat
 {
     uint32_t ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
     {
-        if( *ppvDestination == pvComparand )
+        if( __atomic_compare_exchange_n( ppvDestination, &pvComparand, pvExchange, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) )
         {
-            *ppvDestination = pvExchange;
             ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
         }
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            if( *ppvDestination == pvComparand )
+            {
+                *ppvDestination = pvExchange;
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulReturnValue;
 }
@@ -221,12 +293,20 @@ static portFORCE_INLINE uint32_t Atomic_Add_u32( uint32_t volatile * pulAddend,
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
     {
-        ulCurrent = *pulAddend;
-        *pulAddend += ulCount;
+        ulCurrent = __atomic_fetch_add( pulAddend, ulCount, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend += ulCount;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -249,12 +329,20 @@ static portFORCE_INLINE uint32_t Atomic_Subtract_u32( uint32_t volatile * pulAdd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
     {
-        ulCurrent = *pulAddend;
-        *pulAddend -= ulCount;
+        ulCurrent = __atomic_fetch_sub( pulAddend, ulCount, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend -= ulCount;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulCurrent;
 }
@@ -274,12 +362,20 @@ static portFORCE_INLINE uint32_t Atomic_Increment_u32( uint32_t volatile * pulAd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
     {
-        ulCurrent = *pulAddend;
-        *pulAddend += 1;
+        ulCurrent = __atomic_fetch_add( pulAddend, 1U, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend += 1;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -299,12 +395,20 @@ static portFORCE_INLINE uint32_t Atomic_Decrement_u32( uint32_t volatile * pulAd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
     {
-        ulCurrent = *pulAddend;
-        *pulAddend -= 1;
+        ulCurrent = __atomic_fetch_sub( pulAddend, 1U, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend -= 1;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulCurrent;
 }
@@ -327,12 +431,20 @@ static portFORCE_INLINE uint32_t Atomic_OR_u32( uint32_t volatile * pulDestinati
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
+    {
+        ulCurrent = __atomic_fetch_or( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+    }
+    #else
     {
-        ulCurrent = *pulDestination;
-        *pulDestination |= ulValue;
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination |= ulValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -354,12 +466,20 @@ static portFORCE_INLINE uint32_t Atomic_AND_u32( uint32_t volatile * pulDestinat
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
     {
-        ulCurrent = *pulDestination;
-        *pulDestination &= ulValue;
+        ulCurrent = __atomic_fetch_and( pulDestination, ulValue, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination &= ulValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulCurrent;
 }
@@ -381,12 +501,20 @@ static portFORCE_INLINE uint32_t Atomic_NAND_u32( uint32_t volatile * pulDestina
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
+    {
+        ulCurrent = __atomic_fetch_nand( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+    }
+    #else
     {
-        ulCurrent = *pulDestination;
-        *pulDestination = ~( ulCurrent & ulValue );
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination = ~( ulCurrent & ulValue );
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -408,12 +536,20 @@ static portFORCE_INLINE uint32_t Atomic_XOR_u32( uint32_t volatile * pulDestinat
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( portATOMIC_USE_COMPILER_BUILTINS == 1 )
     {
-        ulCurrent = *pulDestination;
-        *pulDestination ^= ulValue;
+        ulCurrent = __atomic_fetch_xor( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination ^= ulValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
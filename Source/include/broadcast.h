@@ -0,0 +1,290 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef BROADCAST_H
+#define BROADCAST_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include broadcast.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A broadcast channel passes every item written by a single publisher to any
+ * number of subscriber tasks.  Each item is copied into the channel once, and
+ * each subscriber reads it through its own cursor, so receiving an item does
+ * not remove it for the other subscribers.
+ *
+ * The channel holds the most recent uxLength items.  The publisher never
+ * blocks: when the channel is full the oldest item is overwritten, and a
+ * subscriber that has fallen more than uxLength items behind skips to the
+ * oldest item still held and is told how many items it missed.
+ *
+ * Publishing and receiving do not use critical sections.  A subscriber that
+ * finds no new item blocks on a task notification, and the publisher only
+ * notifies subscribers that are blocked or about to block.  The publisher can
+ * be a task or an interrupt service routine, but there must only be one
+ * publisher.
+ *
+ * The configUSE_BROADCAST_CHANNELS configuration constant must be set to 1 for
+ * the broadcast channel API to be available.
+ *
+ * \defgroup BroadcastHandle_t BroadcastHandle_t
+ * \ingroup BroadcastChannel
+ */
+struct BroadcastDef_t;
+typedef struct BroadcastDef_t * BroadcastHandle_t;
+
+/**
+ * A subscription to a broadcast channel, returned by xBroadcastSubscribe().
+ *
+ * \defgroup BroadcastSubscriberHandle_t BroadcastSubscriberHandle_t
+ * \ingroup BroadcastChannel
+ */
+struct BroadcastSubscriberDef_t;
+typedef struct BroadcastSubscriberDef_t * BroadcastSubscriberHandle_t;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * BroadcastHandle_t xBroadcastCreate( UBaseType_t uxLength,
+ *                                     UBaseType_t uxItemSize,
+ *                                     UBaseType_t uxMaxSubscribers );
+ * @endcode
+ *
+ * Create a broadcast channel.  The channel structure, the subscriptions and
+ * the storage area are allocated from the FreeRTOS heap in a single block.
+ *
+ * @param uxLength The number of most recent items the channel holds.  Must be
+ * a power of two.
+ *
+ * @param uxItemSize The size, in bytes, of each item.
+ *
+ * @param uxMaxSubscribers The maximum number of subscriptions the channel can
+ * have at the same time.
+ *
+ * @return A handle to the created channel, or NULL if there was insufficient
+ * FreeRTOS heap available to create it.
+ *
+ * Example usage:
+ * @code{c}
+ * static BroadcastHandle_t xReadings;
+ *
+ * void vProducerTask( void * pvParameters )
+ * {
+ * Reading_t xReading;
+ *
+ *  for( ;; )
+ *  {
+ *      vTakeReading( &xReading );
+ *      vBroadcastPublish( xReadings, &xReading );
+ *  }
+ * }
+ *
+ * // Any number of instances of this task.
+ * void vConsumerTask( void * pvParameters )
+ * {
+ * BroadcastSubscriberHandle_t xSubscriber = xBroadcastSubscribe( xReadings );
+ * Reading_t xReading;
+ * uint32_t ulMissed;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xBroadcastReceive( xSubscriber, &xReading, &ulMissed, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          vUseReading( &xReading, ulMissed );
+ *      }
+ *  }
+ * }
+ *
+ * void vSetup( void )
+ * {
+ *  xReadings = xBroadcastCreate( 8, sizeof( Reading_t ), 2 );
+ * }
+ * @endcode
+ * \defgroup xBroadcastCreate xBroadcastCreate
+ * \ingroup BroadcastChannel
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    BroadcastHandle_t xBroadcastCreate( UBaseType_t uxLength,
+                                        UBaseType_t uxItemSize,
+                                        UBaseType_t uxMaxSubscribers ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * broadcast.h
+ * @code{c}
+ * void vBroadcastDelete( BroadcastHandle_t xChannel );
+ * @endcode
+ *
+ * Delete a broadcast channel and free its memory.  The channel must not be
+ * used by any task or interrupt once it has been deleted.
+ *
+ * @param xChannel The channel to delete.
+ *
+ * \defgroup vBroadcastDelete vBroadcastDelete
+ * \ingroup BroadcastChannel
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    void vBroadcastDelete( BroadcastHandle_t xChannel ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * broadcast.h
+ * @code{c}
+ * BroadcastSubscriberHandle_t xBroadcastSubscribe( BroadcastHandle_t xChannel );
+ * @endcode
+ *
+ * Subscribe the calling task to a broadcast channel.  The subscription starts
+ * at the next item published, and can only be used by the task that created
+ * it.
+ *
+ * @param xChannel The channel to subscribe to.
+ *
+ * @return A handle to the subscription, or NULL if the channel already has
+ * uxMaxSubscribers subscriptions.
+ *
+ * \defgroup xBroadcastSubscribe xBroadcastSubscribe
+ * \ingroup BroadcastChannel
+ */
+BroadcastSubscriberHandle_t xBroadcastSubscribe( BroadcastHandle_t xChannel ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * void vBroadcastUnsubscribe( BroadcastSubscriberHandle_t xSubscriber );
+ * @endcode
+ *
+ * End a subscription so that it can be reused by another task.
+ *
+ * @param xSubscriber The subscription to end.
+ *
+ * \defgroup vBroadcastUnsubscribe vBroadcastUnsubscribe
+ * \ingroup BroadcastChannel
+ */
+void vBroadcastUnsubscribe( BroadcastSubscriberHandle_t xSubscriber ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * void vBroadcastPublish( BroadcastHandle_t xChannel,
+ *                         const void * pvItem );
+ * @endcode
+ *
+ * Copy an item into a broadcast channel, overwriting the oldest item if the
+ * channel is full, and unblock every subscriber that is waiting for an item.
+ *
+ * @param xChannel The channel to publish to.
+ *
+ * @param pvItem A pointer to the item to copy into the channel.
+ *
+ * \defgroup vBroadcastPublish vBroadcastPublish
+ * \ingroup BroadcastChannel
+ */
+void vBroadcastPublish( BroadcastHandle_t xChannel,
+                        const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * void vBroadcastPublishFromISR( BroadcastHandle_t xChannel,
+ *                                const void * pvItem,
+ *                                BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of vBroadcastPublish() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xChannel The channel to publish to.
+ *
+ * @param pvItem A pointer to the item to copy into the channel.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if unblocking a subscriber
+ * caused a task to leave the Blocked state that has a priority above the
+ * currently running task, in which case a context switch should be requested
+ * before the interrupt is exited.
+ *
+ * \defgroup vBroadcastPublishFromISR vBroadcastPublishFromISR
+ * \ingroup BroadcastChannel
+ */
+void vBroadcastPublishFromISR( BroadcastHandle_t xChannel,
+                               const void * pvItem,
+                               BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * BaseType_t xBroadcastReceive( BroadcastSubscriberHandle_t xSubscriber,
+ *                               void * pvBuffer,
+ *                               uint32_t * pulMissed,
+ *                               TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Copy the next item of a subscription into pvBuffer, blocking if no item has
+ * been published since the last one received.  Items that were overwritten
+ * before they were received are skipped.
+ *
+ * This function must only be called by the task that created the
+ * subscription, and must not be called from an interrupt service routine.
+ *
+ * @param xSubscriber The subscription to receive from.
+ *
+ * @param pvBuffer Pointer to the buffer into which the item is copied.
+ *
+ * @param pulMissed Set to the number of items skipped because they were
+ * overwritten before this subscriber received them.  Can be NULL.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state waiting for an item.
+ *
+ * @return pdPASS if an item was received, or errQUEUE_EMPTY if no item was
+ * published before the block time expired.
+ *
+ * \defgroup xBroadcastReceive xBroadcastReceive
+ * \ingroup BroadcastChannel
+ */
+BaseType_t xBroadcastReceive( BroadcastSubscriberHandle_t xSubscriber,
+                              void * pvBuffer,
+                              uint32_t * pulMissed,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* BROADCAST_H */
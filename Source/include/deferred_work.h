@@ -0,0 +1,281 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef DEFERRED_WORK_H
+#define DEFERRED_WORK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include deferred_work.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A deferred work service moves interrupt processing out of interrupt service
+ * routines and into tasks.  Each interrupt source that defers work registers a
+ * handler with the service, and the interrupt then pends that source instead
+ * of posting a function and argument to a queue, as
+ * xTimerPendFunctionCallFromISR() does.
+ *
+ * Each source has one pending bit in the notification value of a worker task,
+ * so pending a source never fails and never needs queue space.  A source that
+ * is pended again before its handler has run is coalesced with the earlier
+ * pend, and the handler runs once for both.  Handlers must therefore process
+ * everything the interrupt has made available, not one event per run.
+ *
+ * The sources are grouped into levels.  Each level has its own worker task,
+ * and the worker of a higher level runs at a higher priority, so urgent work
+ * is not delayed behind long-running work that was deferred earlier.  Within
+ * a level, pending handlers run in the order in which they were registered.
+ *
+ * The configUSE_DEFERRED_WORK configuration constant must be set to 1 for the
+ * deferred work API to be available.  Each level can hold up to
+ * configDEFERRED_WORK_SOURCES_PER_LEVEL sources, which cannot exceed 32.
+ *
+ * \defgroup DeferredWorkHandle_t DeferredWorkHandle_t
+ * \ingroup DeferredWork
+ */
+struct DeferredWorkDef_t;
+typedef struct DeferredWorkDef_t * DeferredWorkHandle_t;
+
+/*
+ * Identifies a source registered with xDeferredWorkRegister().
+ */
+typedef UBaseType_t DeferredWorkSource_t;
+
+/*
+ * Defines the prototype to which deferred work handlers must conform.
+ */
+typedef void (* DeferredWorkFunction_t)( void * pvArgument );
+
+/*
+ * Counters kept for each level of a deferred work service, as returned by
+ * vDeferredWorkGetStats().
+ */
+typedef struct xDEFERRED_WORK_STATS
+{
+    uint32_t ulPends;         /**< The number of times a source of the level was pended. */
+    uint32_t ulCoalesced;     /**< The number of pends that found the source already pending, so did not cause another run. */
+    uint32_t ulRuns;          /**< The number of times a handler of the level ran. */
+    uint32_t ulWakes;         /**< The number of times the worker of the level woke to run handlers. */
+    UBaseType_t uxMaxPending; /**< The largest number of sources of the level found pending at once by the worker. */
+} DeferredWorkStats_t;
+
+/**
+ * deferred_work.h
+ * @code{c}
+ * DeferredWorkHandle_t xDeferredWorkCreate( const char * const pcName,
+ *                                           UBaseType_t uxLevels,
+ *                                           configSTACK_DEPTH_TYPE uxStackDepth,
+ *                                           UBaseType_t uxLowestPriority );
+ * @endcode
+ *
+ * Create a deferred work service.  The service structure and one worker task
+ * per level are allocated from the FreeRTOS heap.
+ *
+ * @param pcName A descriptive name given to each worker task.
+ *
+ * @param uxLevels The number of levels.  Level 0 is the least urgent.
+ *
+ * @param uxStackDepth The stack depth of each worker task.  Handlers execute
+ * on this stack.
+ *
+ * @param uxLowestPriority The priority of the worker for level 0.  The worker
+ * for level n runs at priority uxLowestPriority + n, which must be less than
+ * configMAX_PRIORITIES.
+ *
+ * @return A handle to the created service, or NULL if there was insufficient
+ * FreeRTOS heap available to create it.
+ *
+ * Example usage:
+ * @code{c}
+ * static DeferredWorkHandle_t xService;
+ * static DeferredWorkSource_t xRxSource;
+ *
+ * static void prvProcessRx( void * pvArgument )
+ * {
+ *  // Empty the receive buffer filled by the interrupt.
+ * }
+ *
+ * void vRxISR( void )
+ * {
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *  // Move the received data into a buffer and clear the interrupt, then
+ *  // leave the rest to prvProcessRx().
+ *  xDeferredWorkPendFromISR( xService, xRxSource, &xHigherPriorityTaskWoken );
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ *
+ * void vAFunction( void )
+ * {
+ *  // Two levels, with workers at priorities 2 and 3.
+ *  xService = xDeferredWorkCreate( "Defer", 2, configMINIMAL_STACK_SIZE, tskIDLE_PRIORITY + 2 );
+ *
+ *  xDeferredWorkRegister( xService, 1, prvProcessRx, NULL, &xRxSource );
+ * }
+ * @endcode
+ * \defgroup xDeferredWorkCreate xDeferredWorkCreate
+ * \ingroup DeferredWork
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    DeferredWorkHandle_t xDeferredWorkCreate( const char * const pcName,
+                                              UBaseType_t uxLevels,
+                                              configSTACK_DEPTH_TYPE uxStackDepth,
+                                              UBaseType_t uxLowestPriority ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * deferred_work.h
+ * @code{c}
+ * BaseType_t xDeferredWorkRegister( DeferredWorkHandle_t xService,
+ *                                   UBaseType_t uxLevel,
+ *                                   DeferredWorkFunction_t pxFunction,
+ *                                   void * pvArgument,
+ *                                   DeferredWorkSource_t * pxSource );
+ * @endcode
+ *
+ * Register a source with a deferred work service.  Sources cannot be removed,
+ * so they are normally registered when the application starts, before the
+ * interrupts that pend them are enabled.
+ *
+ * @param xService The service with which to register the source.
+ *
+ * @param uxLevel The level whose worker runs the handler.
+ *
+ * @param pxFunction The handler run each time the source is pended.
+ *
+ * @param pvArgument The value passed into pxFunction.
+ *
+ * @param pxSource Used to pass out the identifier of the source, which is
+ * then passed to xDeferredWorkPend() or xDeferredWorkPendFromISR().
+ *
+ * @return pdPASS if the source was registered, or pdFAIL if the level already
+ * has configDEFERRED_WORK_SOURCES_PER_LEVEL sources.
+ *
+ * \defgroup xDeferredWorkRegister xDeferredWorkRegister
+ * \ingroup DeferredWork
+ */
+BaseType_t xDeferredWorkRegister( DeferredWorkHandle_t xService,
+                                  UBaseType_t uxLevel,
+                                  DeferredWorkFunction_t pxFunction,
+                                  void * pvArgument,
+                                  DeferredWorkSource_t * pxSource ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_work.h
+ * @code{c}
+ * BaseType_t xDeferredWorkPend( DeferredWorkHandle_t xService,
+ *                               DeferredWorkSource_t xSource );
+ * @endcode
+ *
+ * Request that the handler of a source runs.  The handler runs once however
+ * many times the source is pended before the worker gets to it.  Never blocks.
+ *
+ * @param xService The service with which the source was registered.
+ *
+ * @param xSource The source to pend.
+ *
+ * @return pdTRUE if the source was not already pending, or pdFALSE if the
+ * pend was coalesced with an earlier one.
+ *
+ * \defgroup xDeferredWorkPend xDeferredWorkPend
+ * \ingroup DeferredWork
+ */
+BaseType_t xDeferredWorkPend( DeferredWorkHandle_t xService,
+                              DeferredWorkSource_t xSource ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_work.h
+ * @code{c}
+ * BaseType_t xDeferredWorkPendFromISR( DeferredWorkHandle_t xService,
+ *                                      DeferredWorkSource_t xSource,
+ *                                      BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xDeferredWorkPend() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xService The service with which the source was registered.
+ *
+ * @param xSource The source to pend.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if pending the source
+ * unblocked a worker with a priority above that of the interrupted task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @return pdTRUE if the source was not already pending, or pdFALSE if the
+ * pend was coalesced with an earlier one.
+ *
+ * \defgroup xDeferredWorkPendFromISR xDeferredWorkPendFromISR
+ * \ingroup DeferredWork
+ */
+BaseType_t xDeferredWorkPendFromISR( DeferredWorkHandle_t xService,
+                                     DeferredWorkSource_t xSource,
+                                     BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_work.h
+ * @code{c}
+ * void vDeferredWorkGetStats( DeferredWorkHandle_t xService,
+ *                             UBaseType_t uxLevel,
+ *                             DeferredWorkStats_t * pxStats );
+ * @endcode
+ *
+ * Obtain the counters kept for one level of a deferred work service.  A large
+ * ulCoalesced count relative to ulPends shows the worker of the level is slow
+ * to respond, and uxMaxPending shows how much work built up at once.
+ *
+ * @param xService The service to query.
+ *
+ * @param uxLevel The level to query.
+ *
+ * @param pxStats Used to pass out a copy of the counters.
+ *
+ * \defgroup vDeferredWorkGetStats vDeferredWorkGetStats
+ * \ingroup DeferredWork
+ */
+void vDeferredWorkGetStats( DeferredWorkHandle_t xService,
+                            UBaseType_t uxLevel,
+                            DeferredWorkStats_t * pxStats ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* DEFERRED_WORK_H */
@@ -39,7 +39,12 @@
 /* The following bit fields convey control information in a task's event list
  * item value.  It is important they don't clash with the
  * taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
-#if ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS )
+#if ( configUSE_64_BIT_EVENT_BITS == 1 ) || ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_64_BITS )
+    #define eventCLEAR_EVENTS_ON_EXIT_BIT    ( ( uint64_t ) 0x0100000000000000U )
+    #define eventUNBLOCKED_DUE_TO_BIT_SET    ( ( uint64_t ) 0x0200000000000000U )
+    #define eventWAIT_FOR_ALL_BITS           ( ( uint64_t ) 0x0400000000000000U )
+    #define eventEVENT_BITS_CONTROL_BYTES    ( ( uint64_t ) 0xff00000000000000U )
+#elif ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS )
     #define eventCLEAR_EVENTS_ON_EXIT_BIT    ( ( uint16_t ) 0x0100U )
     #define eventUNBLOCKED_DUE_TO_BIT_SET    ( ( uint16_t ) 0x0200U )
     #define eventWAIT_FOR_ALL_BITS           ( ( uint16_t ) 0x0400U )
@@ -49,12 +54,7 @@
     #define eventUNBLOCKED_DUE_TO_BIT_SET    ( ( uint32_t ) 0x02000000U )
     #define eventWAIT_FOR_ALL_BITS           ( ( uint32_t ) 0x04000000U )
     #define eventEVENT_BITS_CONTROL_BYTES    ( ( uint32_t ) 0xff000000U )
-#elif ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_64_BITS )
-    #define eventCLEAR_EVENTS_ON_EXIT_BIT    ( ( uint64_t ) 0x0100000000000000U )
-    #define eventUNBLOCKED_DUE_TO_BIT_SET    ( ( uint64_t ) 0x0200000000000000U )
-    #define eventWAIT_FOR_ALL_BITS           ( ( uint64_t ) 0x0400000000000000U )
-    #define eventEVENT_BITS_CONTROL_BYTES    ( ( uint64_t ) 0xff00000000000000U )
-#endif /* if ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS ) */
+#endif /* if ( configUSE_64_BIT_EVENT_BITS == 1 ) || ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_64_BITS ) */
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
@@ -103,14 +103,19 @@ struct EventGroupDef_t;
 typedef struct EventGroupDef_t   * EventGroupHandle_t;
 
 /*
- * The type that holds event bits always matches TickType_t - therefore the
+ * The type that holds event bits matches TickType_t - therefore the
  * number of bits it holds is set by configTICK_TYPE_WIDTH_IN_BITS (16 bits if set to 0,
- * 32 bits if set to 1, 64 bits if set to 2.
+ * 32 bits if set to 1, 64 bits if set to 2 - unless configUSE_64_BIT_EVENT_BITS
+ * is set to 1, in which case it is always 64 bits.
  *
  * \defgroup EventBits_t EventBits_t
  * \ingroup EventGroup
  */
-typedef TickType_t               EventBits_t;
+#if ( configUSE_64_BIT_EVENT_BITS == 1 )
+    typedef uint64_t             EventBits_t;
+#else
+    typedef TickType_t           EventBits_t;
+#endif
 
 /**
  * event_groups.h
@@ -136,7 +141,9 @@ typedef TickType_t               EventBits_t;
  * configTICK_TYPE_WIDTH_IN_BITS is 0 then each event group contains 8 usable bits (bit
  * 0 to bit 7).  If configTICK_TYPE_WIDTH_IN_BITS is set to 1 then each event group has
  * 24 usable bits (bit 0 to bit 23).  If configTICK_TYPE_WIDTH_IN_BITS is set to 2 then
- * each event group has 56 usable bits (bit 0 to bit 53). The EventBits_t type
+ * each event group has 56 usable bits (bit 0 to bit 53).  Setting
+ * configUSE_64_BIT_EVENT_BITS to 1 gives each event group 56 usable bits
+ * whatever the tick type width.  The EventBits_t type
  * is used to store event bits within an event group.
  *
  * The configUSE_EVENT_GROUPS configuration constant must be set to 1 for xEventGroupCreate()
@@ -196,7 +203,9 @@ typedef TickType_t               EventBits_t;
  * configTICK_TYPE_WIDTH_IN_BITS is 0 then each event group contains 8 usable bits (bit
  * 0 to bit 7).  If configTICK_TYPE_WIDTH_IN_BITS is set to 1 then each event group has
  * 24 usable bits (bit 0 to bit 23).  If configTICK_TYPE_WIDTH_IN_BITS is set to 2 then
- * each event group has 56 usable bits (bit 0 to bit 53).  The EventBits_t type
+ * each event group has 56 usable bits (bit 0 to bit 53).  Setting
+ * configUSE_64_BIT_EVENT_BITS to 1 gives each event group 56 usable bits
+ * whatever the tick type width.  The EventBits_t type
  * is used to store event bits within an event group.
  *
  * The configUSE_EVENT_GROUPS configuration constant must be set to 1 for xEventGroupCreateStatic()
@@ -410,6 +419,12 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  * timer task to have the clear operation performed in the context of the timer
  * task.
  *
+ * If configUSE_64_BIT_EVENT_BITS is set to 1 the bits to clear are held in
+ * the event group until the timer task clears them, and only one message is
+ * sent to the timer task however many operations an interrupt defers before
+ * the timer task runs.  Bits that are both set and cleared before then are
+ * left as the last operation on them requested.
+ *
  * @note If this function returns pdPASS then the timer task is ready to run
  * and a portYIELD_FROM_ISR(pdTRUE) should be executed to perform the needed
  * clear on the event group.  This behavior is different from
@@ -452,7 +467,7 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  * \defgroup xEventGroupClearBitsFromISR xEventGroupClearBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_BITS == 1 ) )
     BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
                                             const EventBits_t uxBitsToClear ) PRIVILEGED_FUNCTION;
 #else
@@ -473,6 +488,14 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  * Setting bits in an event group will automatically unblock tasks that are
  * blocked waiting for the bits.
  *
+ * Normally every task blocked on the event group is checked each time bits are
+ * set, so the time taken grows with the number of waiting tasks.  If
+ * configUSE_EVENT_GROUP_WAITER_INDEX is set to 1 in FreeRTOSConfig.h then tasks
+ * waiting for a single bit, or for all of several bits, are held in a separate
+ * list for each bit, and only the lists for the bits being set are checked.
+ * Tasks waiting for any one of several bits are still checked every time.
+ * This costs one list per event bit in each event group.
+ *
  * The configUSE_EVENT_GROUPS configuration constant must be set to 1 for xEventGroupSetBits()
  * to be available.
  *
@@ -551,6 +574,29 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * context of the timer task - where a scheduler lock is used in place of a
  * critical section.
  *
+ * If configEVENT_GROUP_ISR_MAX_WAITERS is set to a value greater than 0 in
+ * FreeRTOSConfig.h then, provided no more than that many tasks are waiting on
+ * the event group, the bits are set and the waiting tasks unblocked directly
+ * by xEventGroupSetBitsFromISR(), without the round trip through the timer
+ * task.  The time spent in the interrupt is then bounded by
+ * configEVENT_GROUP_ISR_MAX_WAITERS.  If more tasks are waiting the operation
+ * is deferred to the timer task as normal.  The operation is also deferred
+ * if the interrupt occurs while a task is using the list of tasks waiting on
+ * the event group, so tasks still walk the list with only the scheduler
+ * suspended and interrupts are only masked for short periods.  Note that bits
+ * set directly take effect before any operation an interrupt has already
+ * deferred to the timer task, such as an earlier call to
+ * xEventGroupClearBitsFromISR().
+ *
+ * If configUSE_64_BIT_EVENT_BITS is set to 1 the bits to set are held in the
+ * event group until the timer task sets them all at once, and only one message
+ * is sent to the timer task however many operations an interrupt defers before
+ * the timer task runs.  Bits that are both set and cleared before then are
+ * left as the last operation on them requested, so a task waiting for a bit
+ * that is set and then cleared again may not be unblocked.  Bits are not set
+ * directly, as described above, while such deferred operations are
+ * outstanding.
+ *
  * @param xEventGroup The event group in which the bits are to be set.
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
@@ -558,18 +604,18 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * and bit 0 set uxBitsToSet to 0x09.
  *
  * @param pxHigherPriorityTaskWoken As mentioned above, calling this function
- * will result in a message being sent to the timer daemon task.  If the
- * priority of the timer daemon task is higher than the priority of the
- * currently running task (the task the interrupt interrupted) then
- * *pxHigherPriorityTaskWoken will be set to pdTRUE by
- * xEventGroupSetBitsFromISR(), indicating that a context switch should be
+ * may result in a message being sent to the timer daemon task.  If the
+ * priority of the timer daemon task, or of a task unblocked directly, is
+ * higher than the priority of the currently running task (the task the
+ * interrupt interrupted) then *pxHigherPriorityTaskWoken will be set to pdTRUE
+ * by xEventGroupSetBitsFromISR(), indicating that a context switch should be
  * requested before the interrupt exits.  For that reason
  * *pxHigherPriorityTaskWoken must be initialised to pdFALSE.  See the
  * example code below.
  *
- * @return If the request to execute the function was posted successfully then
- * pdPASS is returned, otherwise pdFALSE is returned.  pdFALSE will be returned
- * if the timer service queue was full.
+ * @return If the bits were set directly, or the request to execute the
+ * function was posted successfully, then pdPASS is returned, otherwise pdFALSE
+ * is returned.  pdFALSE will be returned if the timer service queue was full.
  *
  * Example usage:
  * @code{c}
@@ -607,7 +653,7 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 ) || ( configUSE_64_BIT_EVENT_BITS == 1 ) )
     BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
                                           const EventBits_t uxBitsToSet,
                                           BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
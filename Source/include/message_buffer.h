@@ -85,6 +85,20 @@
  */
 typedef StreamBufferHandle_t MessageBufferHandle_t;
 
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+/**
+ * Describes one piece of a message sent with xMessageBufferSendV().
+ */
+    typedef StreamBufferSegment_t MessageBufferSegment_t;
+
+/**
+ * Describes where a message peeked with xMessageBufferPeek() is held.
+ */
+    typedef StreamBufferWindow_t MessageBufferWindow_t;
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+
 /*-----------------------------------------------------------*/
 
 /**
@@ -871,6 +885,182 @@ typedef StreamBufferHandle_t MessageBufferHandle_t;
 #define xMessageBufferNextLengthBytes( xMessageBuffer ) \
     xStreamBufferNextMessageLengthBytes( xMessageBuffer )
 
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferSendV( MessageBufferHandle_t xMessageBuffer,
+ *                             const MessageBufferSegment_t * pxSegments,
+ *                             size_t xSegmentCount,
+ *                             TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Sends a single message made up of the xSegmentCount pieces of data described
+ * by pxSegments, copying each piece straight into the message buffer.  A
+ * message held in separate places, such as a header, a payload and a
+ * checksum, can therefore be sent without first assembling it in a temporary
+ * buffer.  The length of the message is the total length of the segments, and
+ * either the whole message is written or nothing is written.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xMessageBufferSendV() to be available.
+ *
+ * @param xMessageBuffer The handle of the message buffer to which the message
+ * is being sent.
+ *
+ * @param pxSegments An array of xSegmentCount segments, each holding a pointer
+ * to a piece of the message and the length of that piece in bytes.
+ *
+ * @param xSegmentCount The number of segments in pxSegments.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for enough space to become available in
+ * the message buffer.  See xMessageBufferSend().
+ *
+ * @return The length of the message written to the message buffer, or 0 if
+ * there was not enough space for it.
+ *
+ * \defgroup xMessageBufferSendV xMessageBufferSendV
+ * \ingroup MessageBufferManagement
+ */
+    #define xMessageBufferSendV( xMessageBuffer, pxSegments, xSegmentCount, xTicksToWait ) \
+    xStreamBufferSendV( ( xMessageBuffer ), ( pxSegments ), ( xSegmentCount ), ( xTicksToWait ) )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferSendVFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                    const MessageBufferSegment_t * pxSegments,
+ *                                    size_t xSegmentCount,
+ *                                    BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xMessageBufferSendV().
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xMessageBufferSendVFromISR() to be available.
+ *
+ * @param xMessageBuffer The handle of the message buffer to which the message
+ * is being sent.
+ *
+ * @param pxSegments An array of xSegmentCount segments to send.
+ *
+ * @param xSegmentCount The number of segments in pxSegments.
+ *
+ * @param pxHigherPriorityTaskWoken See xMessageBufferSendFromISR().
+ *
+ * @return The length of the message written to the message buffer, or 0 if
+ * there was not enough space for it.
+ *
+ * \defgroup xMessageBufferSendVFromISR xMessageBufferSendVFromISR
+ * \ingroup MessageBufferManagement
+ */
+    #define xMessageBufferSendVFromISR( xMessageBuffer, pxSegments, xSegmentCount, pxHigherPriorityTaskWoken ) \
+    xStreamBufferSendVFromISR( ( xMessageBuffer ), ( pxSegments ), ( xSegmentCount ), ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferPeek( MessageBufferHandle_t xMessageBuffer,
+ *                            MessageBufferWindow_t * const pxWindow,
+ *                            TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Describes where the next message is held in the message buffer's storage
+ * area without copying it out or removing it.  A message that wraps past the
+ * end of the storage area is described as two segments, pxWindow->pucFirst and
+ * pxWindow->pucSecond.  Once the message has been processed in place it is
+ * removed with xMessageBufferDiscard().  The message buffer's single reader
+ * must not receive or discard messages while it is using the window.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xMessageBufferPeek() to be available.
+ *
+ * @param xMessageBuffer The handle of the message buffer being peeked.
+ *
+ * @param pxWindow Set to the one or two segments that hold the message.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for a message, should the message buffer
+ * be empty.  See xMessageBufferReceive().
+ *
+ * @return The length of the message in bytes, or 0 if the message buffer is
+ * empty.
+ *
+ * \defgroup xMessageBufferPeek xMessageBufferPeek
+ * \ingroup MessageBufferManagement
+ */
+    #define xMessageBufferPeek( xMessageBuffer, pxWindow, xTicksToWait ) \
+    xStreamBufferPeekMessage( ( xMessageBuffer ), ( pxWindow ), ( xTicksToWait ) )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferPeekFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                   MessageBufferWindow_t * const pxWindow );
+ * @endcode
+ *
+ * Interrupt safe version of xMessageBufferPeek().
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xMessageBufferPeekFromISR() to be available.
+ *
+ * \defgroup xMessageBufferPeekFromISR xMessageBufferPeekFromISR
+ * \ingroup MessageBufferManagement
+ */
+    #define xMessageBufferPeekFromISR( xMessageBuffer, pxWindow ) \
+    xStreamBufferPeekMessageFromISR( ( xMessageBuffer ), ( pxWindow ) )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xMessageBufferDiscard( MessageBufferHandle_t xMessageBuffer );
+ * @endcode
+ *
+ * Removes the next message from the message buffer without copying it,
+ * unblocking a task waiting for space exactly as xMessageBufferReceive() would.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xMessageBufferDiscard() to be available.
+ *
+ * @param xMessageBuffer The handle of the message buffer.
+ *
+ * @return pdPASS if a message was removed, or pdFAIL if the message buffer
+ * was empty.
+ *
+ * \defgroup xMessageBufferDiscard xMessageBufferDiscard
+ * \ingroup MessageBufferManagement
+ */
+    #define xMessageBufferDiscard( xMessageBuffer ) \
+    xStreamBufferDiscardMessage( xMessageBuffer )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xMessageBufferDiscardFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                          BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xMessageBufferDiscard().
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xMessageBufferDiscardFromISR() to be available.
+ *
+ * \defgroup xMessageBufferDiscardFromISR xMessageBufferDiscardFromISR
+ * \ingroup MessageBufferManagement
+ */
+    #define xMessageBufferDiscardFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) \
+    xStreamBufferDiscardMessageFromISR( ( xMessageBuffer ), ( pxHigherPriorityTaskWoken ) )
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+
 /**
  * message_buffer.h
  *
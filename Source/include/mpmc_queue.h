@@ -0,0 +1,233 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include mpmc_queue.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A multiple producer multiple consumer (MPMC) queue is a fixed length queue
+ * of fixed size items that any number of tasks can send to and receive from,
+ * designed for SMP systems where many tasks on different cores send to the
+ * same queue.
+ *
+ * A normal queue serialises every operation on the kernel critical section,
+ * which on an SMP system is a lock shared by all cores.  An MPMC queue instead
+ * gives each slot a sequence number, and a sender or receiver claims a slot by
+ * advancing the queue's send or receive position with a single
+ * compare-and-swap from atomic.h.  Copying the item into or out of the slot
+ * is then done outside any lock, so tasks on different cores copy items in
+ * parallel.  The kernel is only entered to block when the queue is full or
+ * empty, and to unblock a waiting task, so an MPMC queue is only as cheap as
+ * a normal queue when tasks rarely wait on it.
+ *
+ * Unlike a normal queue, an MPMC queue must have a length that is a power of
+ * two, cannot be used from an interrupt service routine, and cannot be a
+ * member of a queue set.  Items are not guaranteed to be received in the
+ * order they were sent if they were sent at the same time by tasks running on
+ * different cores.
+ *
+ * The generic atomic.h implements compare-and-swap with a short critical
+ * section.  The send and receive positions are only free of locks on ports
+ * that provide an atomic.h implementation using atomic instructions.
+ *
+ * The configUSE_MPMC_QUEUES configuration constant must be set to 1 for the
+ * MPMC queue API to be available.
+ *
+ * \defgroup MpmcQueueHandle_t MpmcQueueHandle_t
+ * \ingroup MpmcQueue
+ */
+struct MpmcQueueDef_t;
+typedef struct MpmcQueueDef_t * MpmcQueueHandle_t;
+
+/**
+ * mpmc_queue.h
+ * @code{c}
+ * MpmcQueueHandle_t xMpmcQueueCreate( UBaseType_t uxLength,
+ *                                     UBaseType_t uxItemSize );
+ * @endcode
+ *
+ * Create an MPMC queue.  The queue structure, the slot sequence numbers and
+ * the storage area are allocated from the FreeRTOS heap in a single block.
+ *
+ * @param uxLength The maximum number of items the queue can hold.  Must be a
+ * power of two, and at least 2.
+ *
+ * @param uxItemSize The size, in bytes, of each item.
+ *
+ * @return A handle to the created queue, or NULL if there was insufficient
+ * FreeRTOS heap available to create it.
+ *
+ * Example usage:
+ * @code{c}
+ * static MpmcQueueHandle_t xEventQueue;
+ *
+ * // Any number of instances of this task, on any core.
+ * void vSensorTask( void * pvParameters )
+ * {
+ * SensorEvent_t xEvent;
+ *
+ *  for( ;; )
+ *  {
+ *      vReadSensor( &xEvent );
+ *      xMpmcQueueSend( xEventQueue, &xEvent, portMAX_DELAY );
+ *  }
+ * }
+ *
+ * void vSetup( void )
+ * {
+ *  xEventQueue = xMpmcQueueCreate( 64, sizeof( SensorEvent_t ) );
+ * }
+ * @endcode
+ * \defgroup xMpmcQueueCreate xMpmcQueueCreate
+ * \ingroup MpmcQueue
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    MpmcQueueHandle_t xMpmcQueueCreate( UBaseType_t uxLength,
+                                        UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * mpmc_queue.h
+ * @code{c}
+ * void vMpmcQueueDelete( MpmcQueueHandle_t xQueue );
+ * @endcode
+ *
+ * Delete an MPMC queue and free its memory.  No task may be using or blocked
+ * on the queue when it is deleted.
+ *
+ * @param xQueue The queue to delete.
+ *
+ * \defgroup vMpmcQueueDelete vMpmcQueueDelete
+ * \ingroup MpmcQueue
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    void vMpmcQueueDelete( MpmcQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * mpmc_queue.h
+ * @code{c}
+ * BaseType_t xMpmcQueueSend( MpmcQueueHandle_t xQueue,
+ *                            const void * pvItem,
+ *                            TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Copy an item to the back of an MPMC queue, blocking if the queue is full.
+ * If a task is blocked waiting to receive from the queue then the highest
+ * priority such task is unblocked.
+ *
+ * This function must not be called from an interrupt service routine.
+ *
+ * @param xQueue The queue to which the item is sent.
+ *
+ * @param pvItem A pointer to the item to copy into the queue.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state waiting for space should the queue be full.
+ *
+ * @return pdPASS if the item was sent, or errQUEUE_FULL if the queue was
+ * still full when the block time expired.
+ *
+ * \defgroup xMpmcQueueSend xMpmcQueueSend
+ * \ingroup MpmcQueue
+ */
+BaseType_t xMpmcQueueSend( MpmcQueueHandle_t xQueue,
+                           const void * pvItem,
+                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * mpmc_queue.h
+ * @code{c}
+ * BaseType_t xMpmcQueueReceive( MpmcQueueHandle_t xQueue,
+ *                               void * pvBuffer,
+ *                               TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Copy the item at the front of an MPMC queue into pvBuffer and remove it
+ * from the queue, blocking if the queue is empty.  If a task is blocked
+ * waiting to send to the queue then the highest priority such task is
+ * unblocked.
+ *
+ * This function must not be called from an interrupt service routine.
+ *
+ * @param xQueue The queue from which the item is received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the item is copied.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state waiting for an item should the queue be empty.
+ *
+ * @return pdPASS if an item was received, or errQUEUE_EMPTY if the queue was
+ * still empty when the block time expired.
+ *
+ * \defgroup xMpmcQueueReceive xMpmcQueueReceive
+ * \ingroup MpmcQueue
+ */
+BaseType_t xMpmcQueueReceive( MpmcQueueHandle_t xQueue,
+                              void * pvBuffer,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * mpmc_queue.h
+ * @code{c}
+ * UBaseType_t uxMpmcQueueMessagesWaiting( MpmcQueueHandle_t xQueue );
+ * @endcode
+ *
+ * Return the number of items in an MPMC queue.  The value is only a snapshot,
+ * as other tasks can send and receive at any time, and it includes items that
+ * are still being copied into or out of the queue.
+ *
+ * @param xQueue The queue being queried.
+ *
+ * @return The number of items in the queue.
+ *
+ * \defgroup uxMpmcQueueMessagesWaiting uxMpmcQueueMessagesWaiting
+ * \ingroup MpmcQueue
+ */
+UBaseType_t uxMpmcQueueMessagesWaiting( MpmcQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* MPMC_QUEUE_H */
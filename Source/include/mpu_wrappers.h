@@ -70,6 +70,7 @@
         #define xTaskGenericNotify                    MPU_xTaskGenericNotify
         #define xTaskGenericNotifyWait                MPU_xTaskGenericNotifyWait
         #define ulTaskGenericNotifyTake               MPU_ulTaskGenericNotifyTake
+        #define ulTaskGenericNotifyTakeUpTo           MPU_ulTaskGenericNotifyTakeUpTo
         #define xTaskGenericNotifyStateClear          MPU_xTaskGenericNotifyStateClear
         #define ulTaskGenericNotifyValueClear         MPU_ulTaskGenericNotifyValueClear
         #define vTaskSetTimeOutState                  MPU_vTaskSetTimeOutState
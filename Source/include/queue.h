@@ -69,6 +69,25 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
 #define queueSEND_TO_FRONT                    ( ( BaseType_t ) 1 )
 #define queueOVERWRITE                        ( ( BaseType_t ) 2 )
 
+/* The highest priority an item sent to a priority queue can have.  Higher
+ * priorities cannot be carried in a BaseType_t copy position. */
+#define queueMAX_ITEM_PRIORITY                ( ( ( ( UBaseType_t ) ~( ( UBaseType_t ) 0U ) ) >> 1 ) - ( UBaseType_t ) 3U )
+
+/* For internal use only.  Positions above queueOVERWRITE carry the priority of
+ * an item sent to a priority queue.  A priority above queueMAX_ITEM_PRIORITY
+ * gives queueSEND_WITH_INVALID_PRIORITY, which the send functions reject,
+ * rather than overflowing into another position. */
+#define queueSEND_WITH_INVALID_PRIORITY       ( ( BaseType_t ) -1 )
+#define queueSEND_WITH_PRIORITY( uxPriority )                          \
+    ( ( ( UBaseType_t ) ( uxPriority ) <= queueMAX_ITEM_PRIORITY ) ? \
+      ( ( BaseType_t ) 3 + ( BaseType_t ) ( uxPriority ) ) :         \
+      queueSEND_WITH_INVALID_PRIORITY )
+
+/* For internal use only.  Each item in a priority queue is stored with its
+ * priority and a sequence number. */
+#define queuePRIORITY_QUEUE_KEY_SIZE                   ( ( UBaseType_t ) ( 2U * sizeof( UBaseType_t ) ) )
+#define queuePRIORITY_QUEUE_ITEM_SIZE( uxItemSize )    ( ( UBaseType_t ) ( uxItemSize ) + queuePRIORITY_QUEUE_KEY_SIZE )
+
 /* For internal use only.  These definitions *must* match those in queue.c. */
 #define queueQUEUE_TYPE_BASE                  ( ( uint8_t ) 0U )
 #define queueQUEUE_TYPE_MUTEX                 ( ( uint8_t ) 1U )
@@ -76,6 +95,8 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
 #define queueQUEUE_TYPE_BINARY_SEMAPHORE      ( ( uint8_t ) 3U )
 #define queueQUEUE_TYPE_RECURSIVE_MUTEX       ( ( uint8_t ) 4U )
 #define queueQUEUE_TYPE_SET                   ( ( uint8_t ) 5U )
+#define queueQUEUE_TYPE_FAST_MUTEX            ( ( uint8_t ) 6U )
+#define queueQUEUE_TYPE_PRIORITY              ( ( uint8_t ) 7U )
 
 /**
  * queue. h
@@ -523,7 +544,8 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
  * @endcode
  *
  * Only for use with queues that have a length of one - so the queue is either
- * empty or full.
+ * empty or full.  Must not be used on a queue that is also used with
+ * xQueueReserve() or xQueueAcquire().
  *
  * Post an item on a queue.  If the queue is already full then overwrite the
  * value held in the queue.  The item is queued by copy, not by reference.
@@ -914,6 +936,639 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                           void * const pvBuffer,
                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReserve(
+ *                           QueueHandle_t xQueue,
+ *                           void **ppvSlot,
+ *                           TickType_t xTicksToWait
+ *                         );
+ * @endcode
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xQueueReserve() to be available.
+ *
+ * Reserve the next free slot at the back of a queue and obtain a pointer to
+ * it, so the item can be written directly into the queue storage area instead
+ * of being built in a separate buffer and then copied into the queue.  The
+ * item becomes visible to readers of the queue when xQueueCommit() is
+ * called.  A queue can have only one reserved slot at a time.  While a slot
+ * is reserved, writers sending to the back of the queue block as if the
+ * queue were full, so the reservation should be held for as short a time as
+ * possible.  Writers sending to the front of the queue can still use any
+ * other free slot.  A queue used with xQueueReserve() or xQueueAcquire() must
+ * not also be used with xQueueOverwrite(), which would overwrite the reserved
+ * slot or the acquired item.  configASSERT() fails if the two are mixed.
+ *
+ * The slot is uxItemSize bytes, and is aligned only as far as the queue
+ * storage area and the item size allow.
+ *
+ * This function must not be used in an interrupt service routine.
+ *
+ * @param xQueue The handle to the queue in which the slot is reserved.
+ *
+ * @param ppvSlot Used to return a pointer to the reserved slot.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a slot to become free should the queue be full, or already
+ * have a reserved slot, at the time of the call.
+ *
+ * @return pdPASS if a slot was reserved, otherwise errQUEUE_FULL.
+ *
+ * Example usage:
+ * @code{c}
+ * void vProducerTask( void *pvParameters )
+ * {
+ * SampleFrame_t *pxFrame;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xQueueReserve( xFrameQueue, ( void ** ) &pxFrame, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          // Fill the frame in place, then make it available to the reader.
+ *          vFillFrame( pxFrame );
+ *          xQueueCommit( xFrameQueue );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueReserve xQueueReserve
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueReserve( QueueHandle_t xQueue,
+                              void ** ppvSlot,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueCommit( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xQueueCommit() to be available.
+ *
+ * Add the item written into the slot reserved by xQueueReserve() to the back
+ * of the queue.  Tasks waiting to receive from the queue, and any queue set
+ * that contains the queue, are notified exactly as if the item had been sent
+ * with xQueueSendToBack().  The pointer returned by xQueueReserve() must not
+ * be used after this call.
+ *
+ * @param xQueue The handle to the queue in which a slot was reserved.
+ *
+ * @return pdPASS if the reserved slot was added to the queue, or pdFAIL if
+ * the queue did not have a reserved slot.
+ *
+ * \defgroup xQueueCommit xQueueCommit
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueCommit( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueAcquire(
+ *                           QueueHandle_t xQueue,
+ *                           void **ppvItem,
+ *                           TickType_t xTicksToWait
+ *                         );
+ * @endcode
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xQueueAcquire() to be available.
+ *
+ * Obtain a pointer to the item at the front of a queue, so the item can be
+ * processed in the queue storage area instead of being copied out of the
+ * queue first.  The item remains in the queue until xQueueRelease() is
+ * called.  A queue can have only one acquired item at a time, and while an
+ * item is acquired other readers treat the queue as empty and writers cannot
+ * send to the front of the queue, so the item should be released as soon as
+ * it has been processed.
+ *
+ * This function must not be used in an interrupt service routine.
+ *
+ * @param xQueue The handle to the queue from which the item is acquired.
+ *
+ * @param ppvItem Used to return a pointer to the acquired item.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item should the queue be empty, or already have an acquired
+ * item, at the time of the call.
+ *
+ * @return pdPASS if an item was acquired, otherwise errQUEUE_EMPTY.
+ *
+ * Example usage:
+ * @code{c}
+ * void vConsumerTask( void *pvParameters )
+ * {
+ * const SampleFrame_t *pxFrame;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xQueueAcquire( xFrameQueue, ( void ** ) &pxFrame, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          // Process the frame in place, then free its slot.
+ *          vProcessFrame( pxFrame );
+ *          xQueueRelease( xFrameQueue );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueAcquire xQueueAcquire
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueAcquire( QueueHandle_t xQueue,
+                              void ** ppvItem,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueRelease( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xQueueRelease() to be available.
+ *
+ * Remove the item obtained by xQueueAcquire() from the queue.  Tasks waiting
+ * to send to the queue are unblocked exactly as if the item had been received
+ * with xQueueReceive().  The pointer returned by xQueueAcquire() must not be
+ * used after this call.
+ *
+ * @param xQueue The handle to the queue from which an item was acquired.
+ *
+ * @return pdPASS if the acquired item was removed from the queue, or pdFAIL
+ * if the queue did not have an acquired item.
+ *
+ * \defgroup xQueueRelease xQueueRelease
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    BaseType_t xQueueRelease( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t xQueueSendMultiple(
+ *                                 QueueHandle_t xQueue,
+ *                                 const void *pvItems,
+ *                                 UBaseType_t uxMinItems,
+ *                                 UBaseType_t uxMaxItems,
+ *                                 TickType_t xTicksToWait
+ *                               );
+ * @endcode
+ *
+ * configUSE_QUEUE_BATCH_TRANSFER must be set to 1 in FreeRTOSConfig.h for
+ * xQueueSendMultiple() to be available.
+ *
+ * Post up to uxMaxItems items to the back of a queue in a single operation.
+ * The items are copied into the queue inside one critical section using at
+ * most two memory copies, and waiting receivers are unblocked once for the
+ * whole batch rather than once per item, so sending N items this way is
+ * considerably cheaper than calling xQueueSend() N times.
+ *
+ * The calling task blocks, for at most xTicksToWait ticks, until the queue
+ * has space for at least uxMinItems items.  It then sends as many of the
+ * items as there is space for, up to uxMaxItems.  If the block time expires
+ * first then as many items as there is space for at that time are sent,
+ * which may be fewer than uxMinItems.  Items are always sent in order
+ * starting from the first item in pvItems.
+ *
+ * Tasks that wait for different numbers of items on the same queue can be
+ * unblocked and then find there is still not enough space, in which case they
+ * block again for the remainder of their block time.
+ *
+ * This function must not be used in an interrupt service routine.  See
+ * xQueueSendMultipleFromISR() for an alternative which may be used in an ISR.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to an array of items, each the size the queue was
+ * defined to hold when it was created.
+ *
+ * @param uxMinItems The number of items there must be space for before the
+ * items are sent.  Must not be greater than uxMaxItems or the length of the
+ * queue.  Zero means send whatever fits without blocking.
+ *
+ * @param uxMaxItems The number of items in pvItems.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space for uxMinItems items.
+ *
+ * @return The number of items that were sent.  This is less than uxMinItems
+ * only if the block time expired.
+ *
+ * Example usage:
+ * @code{c}
+ * void vADCTask( void *pvParameters )
+ * {
+ * uint16_t usSamples[ 16 ];
+ * UBaseType_t uxSent;
+ *
+ *  for( ;; )
+ *  {
+ *      vReadSamples( usSamples, 16 );
+ *
+ *      // Send all 16 samples, waiting as long as necessary whenever the
+ *      // queue is full.
+ *      uxSent = 0;
+ *
+ *      while( uxSent < 16 )
+ *      {
+ *          uxSent += xQueueSendMultiple( xSampleQueue, &( usSamples[ uxSent ] ), 1, 16 - uxSent, portMAX_DELAY );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+    UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue,
+                                    const void * pvItems,
+                                    UBaseType_t uxMinItems,
+                                    UBaseType_t uxMaxItems,
+                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t xQueueSendMultipleFromISR(
+ *                                        QueueHandle_t xQueue,
+ *                                        const void *pvItems,
+ *                                        UBaseType_t uxMaxItems,
+ *                                        BaseType_t *pxHigherPriorityTaskWoken
+ *                                      );
+ * @endcode
+ *
+ * configUSE_QUEUE_BATCH_TRANSFER must be set to 1 in FreeRTOSConfig.h for
+ * xQueueSendMultipleFromISR() to be available.
+ *
+ * A version of xQueueSendMultiple() that can be called from an interrupt
+ * service routine.  As many of the items as there is space for, up to
+ * uxMaxItems, are sent without blocking.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to an array of items, each the size the queue was
+ * defined to hold when it was created.
+ *
+ * @param uxMaxItems The number of items in pvItems.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSendMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if sending the items caused a task to
+ * unblock, and the unblocked task has a priority higher than the currently
+ * running task.  If xQueueSendMultipleFromISR() sets this value to pdTRUE
+ * then a context switch should be requested before the interrupt is exited.
+ *
+ * @return The number of items that were sent.
+ *
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+    UBaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue,
+                                           const void * pvItems,
+                                           UBaseType_t uxMaxItems,
+                                           BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t xQueueReceiveMultiple(
+ *                                    QueueHandle_t xQueue,
+ *                                    void *pvBuffer,
+ *                                    UBaseType_t uxMinItems,
+ *                                    UBaseType_t uxMaxItems,
+ *                                    TickType_t xTicksToWait
+ *                                  );
+ * @endcode
+ *
+ * configUSE_QUEUE_BATCH_TRANSFER must be set to 1 in FreeRTOSConfig.h for
+ * xQueueReceiveMultiple() to be available.
+ *
+ * Receive up to uxMaxItems items from the front of a queue in a single
+ * operation.  The items are copied out of the queue inside one critical
+ * section using at most two memory copies, and waiting senders are unblocked
+ * once for the whole batch rather than once per item.
+ *
+ * The calling task blocks, for at most xTicksToWait ticks, until the queue
+ * holds at least uxMinItems items.  It then receives as many items as the
+ * queue holds, up to uxMaxItems.  If the block time expires first then the
+ * items the queue holds at that time are received, which may be fewer than
+ * uxMinItems.
+ *
+ * Tasks that wait for different numbers of items on the same queue can be
+ * unblocked and then find there are still not enough items, in which case
+ * they block again for the remainder of their block time.
+ *
+ * This function must not be used in an interrupt service routine.  See
+ * xQueueReceiveMultipleFromISR() for an alternative which may be used in an
+ * ISR.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will be
+ * copied.  The buffer must be large enough to hold uxMaxItems items.
+ *
+ * @param uxMinItems The number of items the queue must hold before any are
+ * received.  Must not be greater than uxMaxItems or the length of the queue.
+ * Zero means receive whatever the queue holds without blocking.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for uxMinItems items.
+ *
+ * @return The number of items that were received.  This is less than
+ * uxMinItems only if the block time expired.
+ *
+ * Example usage:
+ * @code{c}
+ * void vLoggerTask( void *pvParameters )
+ * {
+ * LogEntry_t xEntries[ 8 ];
+ * UBaseType_t uxReceived, ux;
+ *
+ *  for( ;; )
+ *  {
+ *      // Wait for at least one entry, then take up to eight at once.
+ *      uxReceived = xQueueReceiveMultiple( xLogQueue, xEntries, 1, 8, portMAX_DELAY );
+ *
+ *      for( ux = 0; ux < uxReceived; ux++ )
+ *      {
+ *          vWriteEntry( &( xEntries[ ux ] ) );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+    UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue,
+                                       void * pvBuffer,
+                                       UBaseType_t uxMinItems,
+                                       UBaseType_t uxMaxItems,
+                                       TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t xQueueReceiveMultipleFromISR(
+ *                                           QueueHandle_t xQueue,
+ *                                           void *pvBuffer,
+ *                                           UBaseType_t uxMaxItems,
+ *                                           BaseType_t *pxHigherPriorityTaskWoken
+ *                                         );
+ * @endcode
+ *
+ * configUSE_QUEUE_BATCH_TRANSFER must be set to 1 in FreeRTOSConfig.h for
+ * xQueueReceiveMultipleFromISR() to be available.
+ *
+ * A version of xQueueReceiveMultiple() that can be called from an interrupt
+ * service routine.  As many items as the queue holds, up to uxMaxItems, are
+ * received without blocking.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will be
+ * copied.  The buffer must be large enough to hold uxMaxItems items.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueReceiveMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if receiving the items caused a task
+ * to unblock, and the unblocked task has a priority higher than the currently
+ * running task.  If xQueueReceiveMultipleFromISR() sets this value to pdTRUE
+ * then a context switch should be requested before the interrupt is exited.
+ *
+ * @return The number of items that were received.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+    UBaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue,
+                                              void * pvBuffer,
+                                              UBaseType_t uxMaxItems,
+                                              BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * QueueHandle_t xQueueCreatePriority(
+ *                                    UBaseType_t uxQueueLength,
+ *                                    UBaseType_t uxItemSize
+ *                                  );
+ * @endcode
+ *
+ * configUSE_PRIORITY_QUEUES must be set to 1 in FreeRTOSConfig.h for
+ * xQueueCreatePriority() to be available.
+ *
+ * Creates a queue that delivers items in priority order rather than in the
+ * order they were sent.  Each item is sent with a priority using
+ * xQueueSendWithPriority() or xQueueSendWithPriorityFromISR(), and
+ * xQueueReceive(), xQueuePeek() and their FromISR versions always return the
+ * highest priority item in the queue.  Items of equal priority are received in
+ * the order they were sent.  Items sent with xQueueSend() or
+ * xQueueSendFromISR() have priority 0, the lowest priority.
+ *
+ * The items are held in a binary heap in the queue storage area, so sending
+ * and receiving take time proportional to the logarithm of the number of items
+ * in the queue.  Blocking, block times and queue sets work exactly as for
+ * other queues.
+ *
+ * Items cannot be sent to the front of a priority queue or overwritten, and
+ * the zero copy, batch transfer and co-routine functions cannot be used with
+ * priority queues.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ *
+ * @return If the queue is successfully created then a handle to the newly
+ * created queue is returned.  If the queue cannot be created then NULL is
+ * returned.
+ *
+ * Example usage:
+ * @code{c}
+ * #define sensorPRIORITY_SAMPLE    0
+ * #define sensorPRIORITY_ALARM     1
+ *
+ * QueueHandle_t xSensorQueue;
+ *
+ * void vSensorTask( void *pvParameters )
+ * {
+ * SensorEvent_t xEvent;
+ *
+ *  // Create a queue that can hold 16 sensor events.
+ *  xSensorQueue = xQueueCreatePriority( 16, sizeof( SensorEvent_t ) );
+ *
+ *  for( ;; )
+ *  {
+ *      vReadSensor( &xEvent );
+ *
+ *      // Alarms are received before any routine samples already queued.
+ *      if( xEvent.xIsAlarm != pdFALSE )
+ *      {
+ *          xQueueSendWithPriority( xSensorQueue, &xEvent, sensorPRIORITY_ALARM, portMAX_DELAY );
+ *      }
+ *      else
+ *      {
+ *          xQueueSendWithPriority( xSensorQueue, &xEvent, sensorPRIORITY_SAMPLE, portMAX_DELAY );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueCreatePriority xQueueCreatePriority
+ * \ingroup QueueManagement
+ */
+#if ( ( configUSE_PRIORITY_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    #define xQueueCreatePriority( uxQueueLength, uxItemSize )    xQueueGenericCreate( ( uxQueueLength ), queuePRIORITY_QUEUE_ITEM_SIZE( uxItemSize ), ( queueQUEUE_TYPE_PRIORITY ) )
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * QueueHandle_t xQueueCreatePriorityStatic(
+ *                                          UBaseType_t uxQueueLength,
+ *                                          UBaseType_t uxItemSize,
+ *                                          uint8_t *pucQueueStorage,
+ *                                          StaticQueue_t *pxQueueBuffer
+ *                                        );
+ * @endcode
+ *
+ * configUSE_PRIORITY_QUEUES must be set to 1 in FreeRTOSConfig.h for
+ * xQueueCreatePriorityStatic() to be available.
+ *
+ * Creates a priority queue using memory provided by the application writer.
+ * See xQueueCreatePriority() and xQueueCreateStatic().
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ *
+ * @param pucQueueStorage Must point to a uint8_t array that is at least
+ * ( uxQueueLength * queuePRIORITY_QUEUE_ITEM_SIZE( uxItemSize ) ) bytes long,
+ * as the priority of each item is stored with it.
+ *
+ * @param pxQueueBuffer Must point to a variable of type StaticQueue_t, which
+ * will be used to hold the queue's data structure.
+ *
+ * @return If pxQueueBuffer is not NULL, a handle to the created queue is
+ * returned.  If pxQueueBuffer is NULL then NULL is returned.
+ *
+ * \defgroup xQueueCreatePriorityStatic xQueueCreatePriorityStatic
+ * \ingroup QueueManagement
+ */
+#if ( ( configUSE_PRIORITY_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    #define xQueueCreatePriorityStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer )    xQueueGenericCreateStatic( ( uxQueueLength ), queuePRIORITY_QUEUE_ITEM_SIZE( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_PRIORITY ) )
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueSendWithPriority(
+ *                                    QueueHandle_t xQueue,
+ *                                    const void *pvItemToQueue,
+ *                                    UBaseType_t uxPriority,
+ *                                    TickType_t xTicksToWait
+ *                                  );
+ * @endcode
+ *
+ * configUSE_PRIORITY_QUEUES must be set to 1 in FreeRTOSConfig.h for
+ * xQueueSendWithPriority() to be available.
+ *
+ * Post an item with a priority to a queue created by xQueueCreatePriority().
+ * The item is received before every item in the queue that has a lower
+ * priority, and after every item that has the same or a higher priority.
+ *
+ * This function must not be called from an interrupt service routine.
+ * See xQueueSendWithPriorityFromISR() for an alternative which may be used
+ * in an ISR.
+ *
+ * @param xQueue The handle to the priority queue on which the item is to be
+ * posted.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the
+ * queue.
+ *
+ * @param uxPriority The priority of the item.  0 is the lowest priority and
+ * queueMAX_ITEM_PRIORITY, which is half the range of a UBaseType_t less 3, is
+ * the highest.  A higher value fails a configASSERT().
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it already
+ * be full.
+ *
+ * @return pdTRUE if the item was successfully posted, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xQueueSendWithPriority xQueueSendWithPriority
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+    #define xQueueSendWithPriority( xQueue, pvItemToQueue, uxPriority, xTicksToWait ) \
+    xQueueGenericSend( ( xQueue ), ( pvItemToQueue ), ( xTicksToWait ), queueSEND_WITH_PRIORITY( uxPriority ) )
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueSendWithPriorityFromISR(
+ *                                           QueueHandle_t xQueue,
+ *                                           const void *pvItemToQueue,
+ *                                           UBaseType_t uxPriority,
+ *                                           BaseType_t *pxHigherPriorityTaskWoken
+ *                                         );
+ * @endcode
+ *
+ * configUSE_PRIORITY_QUEUES must be set to 1 in FreeRTOSConfig.h for
+ * xQueueSendWithPriorityFromISR() to be available.
+ *
+ * A version of xQueueSendWithPriority() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xQueue The handle to the priority queue on which the item is to be
+ * posted.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the
+ * queue.
+ *
+ * @param uxPriority The priority of the item.  0 is the lowest priority and
+ * queueMAX_ITEM_PRIORITY, which is half the range of a UBaseType_t less 3, is
+ * the highest.  A higher value fails a configASSERT().
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSendWithPriorityFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if sending to the queue caused a task
+ * to unblock, and the unblocked task has a priority higher than the currently
+ * running task.  If xQueueSendWithPriorityFromISR() sets this value to pdTRUE
+ * then a context switch should be requested before the interrupt is exited.
+ *
+ * @return pdTRUE if the item was successfully posted, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xQueueSendWithPriorityFromISR xQueueSendWithPriorityFromISR
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+    #define xQueueSendWithPriorityFromISR( xQueue, pvItemToQueue, uxPriority, pxHigherPriorityTaskWoken ) \
+    xQueueGenericSendFromISR( ( xQueue ), ( pvItemToQueue ), ( pxHigherPriorityTaskWoken ), queueSEND_WITH_PRIORITY( uxPriority ) )
+#endif
+
 /**
  * queue. h
  * @code{c}
@@ -1123,7 +1778,8 @@ void vQueueDelete( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
  * routine (ISR).
  *
  * Only for use with queues that can hold a single item - so the queue is either
- * empty or full.
+ * empty or full.  Must not be used on a queue that is also used with
+ * xQueueReserve() or xQueueAcquire().
  *
  * Post an item on a queue.  If the queue is already full then overwrite the
  * value held in the queue.  The item is queued by copy, not by reference.
@@ -1529,6 +2185,16 @@ BaseType_t xQueueTakeMutexRecursive( QueueHandle_t xMutex,
                                      TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Use xSemaphoreTakeFast() or xSemaphoreGiveFast()
+ * instead of calling these functions directly.
+ */
+#if ( configUSE_FAST_MUTEXES == 1 )
+    BaseType_t xQueueTakeFastMutex( QueueHandle_t xMutex,
+                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    BaseType_t xQueueGiveFastMutex( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Reset a queue back to its original empty state.  The return value is now
  * obsolete and is always set to pdPASS.
@@ -1845,6 +2511,14 @@ void vQueueWaitForMessageRestricted( QueueHandle_t xQueue,
 BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
                                BaseType_t xNewQueue ) PRIVILEGED_FUNCTION;
 
+/*
+ * Used by xTaskWaitAny().  Returns NULL if the queue holds an item, otherwise
+ * the list of tasks waiting to receive from the queue.
+ */
+#if ( configUSE_WAIT_ANY == 1 )
+    List_t * pxQueueGetWaitAnyListRestricted( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_TRACE_FACILITY == 1 )
     void vQueueSetQueueNumber( QueueHandle_t xQueue,
                                UBaseType_t uxQueueNumber ) PRIVILEGED_FUNCTION;
@@ -0,0 +1,250 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef RW_LOCK_H
+#define RW_LOCK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include rw_lock.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A reader-writer lock can be held by up to a fixed number of reader tasks at
+ * the same time, or by a single writer task.  It suits data that is read
+ * often and written rarely, such as configuration or calibration tables,
+ * where a mutex would needlessly serialise the readers.
+ *
+ * Taking and giving an uncontended reader-writer lock costs somewhat more
+ * than taking and giving a mutex, so the lock only pays off when readers
+ * hold it for long enough to overlap, for example across a blocking call or,
+ * in an SMP system, while running on different cores.
+ *
+ * Writers are preferred: once a writer is waiting no new reader is granted
+ * the lock, so a steady stream of readers cannot starve the writer.  When the
+ * lock is released it is handed to the highest priority waiting writer, or,
+ * if no writer is waiting, to as many of the waiting readers as are allowed.
+ *
+ * As with a mutex, a task that blocks on the lock causes every task that
+ * holds the lock to inherit its priority, and the inherited priority is
+ * disinherited when the lock is released or the blocked task times out.
+ * Each read or write hold counts as a held mutex for the purposes of priority
+ * inheritance.
+ *
+ * A task must not take the lock again, for reading or writing, while it
+ * already holds it.  Reader-writer locks cannot be used from interrupt
+ * service routines.
+ *
+ * The configUSE_RW_LOCKS configuration constant must be set to 1 for the
+ * reader-writer lock API to be available.
+ *
+ * \defgroup RwLockHandle_t RwLockHandle_t
+ * \ingroup RwLock
+ */
+struct RwLockDef_t;
+typedef struct RwLockDef_t * RwLockHandle_t;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * RwLockHandle_t xRwLockCreate( UBaseType_t uxMaxReaders );
+ * @endcode
+ *
+ * Create a reader-writer lock.  The lock structure and the table of reader
+ * tasks are allocated from the FreeRTOS heap in a single block.
+ *
+ * @param uxMaxReaders The maximum number of tasks that can hold the lock for
+ * reading at the same time.  A task that tries to take the lock for reading
+ * when this many tasks already hold it blocks as if a writer held the lock.
+ *
+ * @return A handle to the created lock, or NULL if there was insufficient
+ * FreeRTOS heap available to create it.
+ *
+ * Example usage:
+ * @code{c}
+ * static RwLockHandle_t xTableLock;
+ * static CalibrationTable_t xTable;
+ *
+ * // Any number of instances of this task.
+ * void vReaderTask( void * pvParameters )
+ * {
+ *  for( ;; )
+ *  {
+ *      if( xRwLockTakeRead( xTableLock, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          vUseTable( &xTable );
+ *          xRwLockGiveRead( xTableLock );
+ *      }
+ *  }
+ * }
+ *
+ * void vRecalibrate( void )
+ * {
+ *  if( xRwLockTakeWrite( xTableLock, pdMS_TO_TICKS( 100 ) ) == pdPASS )
+ *  {
+ *      vUpdateTable( &xTable );
+ *      xRwLockGiveWrite( xTableLock );
+ *  }
+ * }
+ *
+ * void vSetup( void )
+ * {
+ *  xTableLock = xRwLockCreate( 4 );
+ * }
+ * @endcode
+ * \defgroup xRwLockCreate xRwLockCreate
+ * \ingroup RwLock
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    RwLockHandle_t xRwLockCreate( UBaseType_t uxMaxReaders ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * void vRwLockDelete( RwLockHandle_t xRwLock );
+ * @endcode
+ *
+ * Delete a reader-writer lock and free its memory.  No task may hold or be
+ * blocked on the lock when it is deleted.
+ *
+ * @param xRwLock The lock to delete.
+ *
+ * \defgroup vRwLockDelete vRwLockDelete
+ * \ingroup RwLock
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    void vRwLockDelete( RwLockHandle_t xRwLock ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRwLockTakeRead( RwLockHandle_t xRwLock,
+ *                             TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Take a reader-writer lock for reading.  The lock is granted immediately if
+ * no writer holds it, no writer is waiting for it, and fewer than the
+ * maximum number of readers hold it.  Otherwise the calling task blocks until
+ * the lock is handed to it or xTicksToWait expires.
+ *
+ * @param xRwLock The lock to take.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state waiting for the lock.
+ *
+ * @return pdPASS if the lock was taken for reading, or pdFAIL if the block
+ * time expired first.
+ *
+ * \defgroup xRwLockTakeRead xRwLockTakeRead
+ * \ingroup RwLock
+ */
+BaseType_t xRwLockTakeRead( RwLockHandle_t xRwLock,
+                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRwLockGiveRead( RwLockHandle_t xRwLock );
+ * @endcode
+ *
+ * Release a reader-writer lock that the calling task took for reading.  If
+ * this was the last reader, the lock is handed to a waiting writer, if any.
+ *
+ * @param xRwLock The lock to release.
+ *
+ * @return pdPASS if the lock was released, or pdFAIL if the calling task did
+ * not hold it for reading.
+ *
+ * \defgroup xRwLockGiveRead xRwLockGiveRead
+ * \ingroup RwLock
+ */
+BaseType_t xRwLockGiveRead( RwLockHandle_t xRwLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRwLockTakeWrite( RwLockHandle_t xRwLock,
+ *                              TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Take a reader-writer lock for writing.  The lock is granted immediately if
+ * no task holds it.  Otherwise the calling task blocks until the lock is
+ * handed to it or xTicksToWait expires.  While the task is waiting no new
+ * reader is granted the lock.
+ *
+ * @param xRwLock The lock to take.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state waiting for the lock.
+ *
+ * @return pdPASS if the lock was taken for writing, or pdFAIL if the block
+ * time expired first.
+ *
+ * \defgroup xRwLockTakeWrite xRwLockTakeWrite
+ * \ingroup RwLock
+ */
+BaseType_t xRwLockTakeWrite( RwLockHandle_t xRwLock,
+                             TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRwLockGiveWrite( RwLockHandle_t xRwLock );
+ * @endcode
+ *
+ * Release a reader-writer lock that the calling task took for writing.  The
+ * lock is handed to the highest priority waiting writer if there is one, or
+ * otherwise to the waiting readers.
+ *
+ * @param xRwLock The lock to release.
+ *
+ * @return pdPASS if the lock was released, or pdFAIL if the calling task did
+ * not hold it for writing.
+ *
+ * \defgroup xRwLockGiveWrite xRwLockGiveWrite
+ * \ingroup RwLock
+ */
+BaseType_t xRwLockGiveWrite( RwLockHandle_t xRwLock ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* RW_LOCK_H */
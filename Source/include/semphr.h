@@ -943,6 +943,157 @@ typedef QueueHandle_t SemaphoreHandle_t;
     #define xSemaphoreCreateRecursiveMutexStatic( pxStaticSemaphore )    xQueueCreateMutexStatic( queueQUEUE_TYPE_RECURSIVE_MUTEX, ( pxStaticSemaphore ) )
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * semphr. h
+ * @code{c}
+ * SemaphoreHandle_t xSemaphoreCreateFastMutex( void );
+ * @endcode
+ *
+ * Creates a new fast mutex type semaphore instance, and returns a handle by
+ * which the new fast mutex can be referenced.
+ *
+ * A fast mutex is taken and given by a single compare-and-swap on the word
+ * that records the mutex holder, without entering a critical section, as
+ * long as no other task is trying to take the mutex at the same time.  Only
+ * when a task has to wait for the mutex is the kernel entered, and then the
+ * waiting task blocks and the holder inherits its priority exactly as for a
+ * mutex created using xSemaphoreCreateMutex().
+ *
+ * configUSE_FAST_MUTEXES must be set to 1 in FreeRTOSConfig.h for this macro
+ * to be available.
+ *
+ * Mutexes created using this macro can be accessed using the
+ * xSemaphoreTakeFast() and xSemaphoreGiveFast() macros.  The xSemaphoreTake(),
+ * xSemaphoreGive(), xSemaphoreTakeRecursive() and xSemaphoreGiveRecursive()
+ * macros must not be used, and uxSemaphoreGetCount() does not return a
+ * meaningful value.  Fast mutexes cannot be taken recursively.
+ *
+ * This type of semaphore uses a priority inheritance mechanism so a task
+ * 'taking' a semaphore MUST ALWAYS 'give' the semaphore back once the
+ * semaphore it is no longer required.
+ *
+ * Mutex type semaphores cannot be used from within interrupt service routines.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * semaphore is returned.  If there was not enough heap to allocate the mutex
+ * data structures then NULL is returned.
+ *
+ * \defgroup xSemaphoreCreateFastMutex xSemaphoreCreateFastMutex
+ * \ingroup Semaphores
+ */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_FAST_MUTEXES == 1 ) )
+    #define xSemaphoreCreateFastMutex()    xQueueCreateMutex( queueQUEUE_TYPE_FAST_MUTEX )
+#endif
+
+/**
+ * semphr. h
+ * @code{c}
+ * SemaphoreHandle_t xSemaphoreCreateFastMutexStatic( StaticSemaphore_t *pxMutexBuffer );
+ * @endcode
+ *
+ * Creates a new fast mutex type semaphore instance using memory provided by the
+ * application writer.  See xSemaphoreCreateFastMutex() for the behaviour of
+ * fast mutexes.
+ *
+ * @param pxMutexBuffer Must point to a variable of type StaticSemaphore_t,
+ * which will be used to hold the mutex's data structure, removing the need for
+ * the memory to be allocated dynamically.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * mutex is returned.  If pxMutexBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xSemaphoreCreateFastMutexStatic xSemaphoreCreateFastMutexStatic
+ * \ingroup Semaphores
+ */
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_FAST_MUTEXES == 1 ) )
+    #define xSemaphoreCreateFastMutexStatic( pxMutexBuffer )    xQueueCreateMutexStatic( queueQUEUE_TYPE_FAST_MUTEX, ( pxMutexBuffer ) )
+#endif
+
+/**
+ * semphr. h
+ * @code{c}
+ * xSemaphoreTakeFast(
+ *                   SemaphoreHandle_t xMutex,
+ *                   TickType_t xBlockTime
+ *                );
+ * @endcode
+ *
+ * Macro to obtain a fast mutex.  The mutex must have previously been created
+ * using a call to xSemaphoreCreateFastMutex() or
+ * xSemaphoreCreateFastMutexStatic().
+ *
+ * @param xMutex A handle to the mutex being obtained.
+ *
+ * @param xBlockTime The time in ticks to wait for the mutex to become
+ * available.  The macro portTICK_PERIOD_MS can be used to convert this to a
+ * real time.  A block time of zero can be used to poll the mutex.
+ *
+ * @return pdTRUE if the mutex was obtained.  pdFALSE if xBlockTime expired
+ * without the mutex becoming available.
+ *
+ * Example usage:
+ * @code{c}
+ * SemaphoreHandle_t xMutex = NULL;
+ *
+ * // A task that creates a fast mutex.
+ * void vATask( void * pvParameters )
+ * {
+ *  // Create the mutex to guard a shared resource.
+ *  xMutex = xSemaphoreCreateFastMutex();
+ * }
+ *
+ * // A task that uses the mutex.
+ * void vAnotherTask( void * pvParameters )
+ * {
+ *  // ... Do other things.
+ *
+ *  if( xMutex != NULL )
+ *  {
+ *      // See if we can obtain the mutex.  If the mutex is not available
+ *      // wait 10 ticks to see if it becomes free.
+ *      if( xSemaphoreTakeFast( xMutex, ( TickType_t ) 10 ) == pdTRUE )
+ *      {
+ *          // We were able to obtain the mutex and can now access the
+ *          // shared resource.
+ *
+ *          // ...
+ *
+ *          // We have finished accessing the shared resource.  Release the
+ *          // mutex.
+ *          xSemaphoreGiveFast( xMutex );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xSemaphoreTakeFast xSemaphoreTakeFast
+ * \ingroup Semaphores
+ */
+#if ( configUSE_FAST_MUTEXES == 1 )
+    #define xSemaphoreTakeFast( xMutex, xBlockTime )    xQueueTakeFastMutex( ( xMutex ), ( xBlockTime ) )
+#endif
+
+/**
+ * semphr. h
+ * @code{c}
+ * xSemaphoreGiveFast( SemaphoreHandle_t xMutex );
+ * @endcode
+ *
+ * Macro to release a fast mutex.  The mutex must have previously been created
+ * using a call to xSemaphoreCreateFastMutex() or
+ * xSemaphoreCreateFastMutexStatic(), and obtained using xSemaphoreTakeFast().
+ *
+ * @param xMutex A handle to the mutex being released.
+ *
+ * @return pdTRUE if the mutex was released.  pdFALSE if the calling task is
+ * not the mutex holder.
+ *
+ * \defgroup xSemaphoreGiveFast xSemaphoreGiveFast
+ * \ingroup Semaphores
+ */
+#if ( configUSE_FAST_MUTEXES == 1 )
+    #define xSemaphoreGiveFast( xMutex )    xQueueGiveFastMutex( ( xMutex ) )
+#endif
+
 /**
  * semphr. h
  * @code{c}
@@ -0,0 +1,281 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include spsc_queue.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A single producer single consumer (SPSC) queue is a fixed length queue of
+ * fixed size items that is written by exactly one producer and read by
+ * exactly one task.  The producer can be a task or an interrupt service
+ * routine.
+ *
+ * Because each index into the queue storage area is only ever written by one
+ * side, sending and receiving do not need a critical section.  The consumer
+ * registers itself only when it is about to block, and the producer notifies
+ * it only when it is registered, so in the common case an item is passed
+ * from an interrupt to a task without masking interrupts or accessing any
+ * kernel list.  A producer task can block on a full queue in the same way,
+ * and is notified by the consumer when a slot is freed.
+ *
+ * Items are copied into and out of the queue, as with a normal queue.  Unlike
+ * a normal queue, an SPSC queue cannot be used by more than one writer or
+ * more than one reader, and cannot be a member of a queue set.  That makes it
+ * a lighter weight alternative to a queue for a fixed hand-off between one
+ * producer and one known consumer.
+ *
+ * The producer and consumer indexes are separated by configCACHE_LINE_SIZE
+ * bytes.  On multi-core systems portMEMORY_BARRIER() must order earlier
+ * memory accesses before later ones on the executing core.
+ *
+ * The configUSE_SPSC_QUEUES configuration constant must be set to 1 for the
+ * SPSC queue API to be available.
+ *
+ * \defgroup SpscQueueHandle_t SpscQueueHandle_t
+ * \ingroup SpscQueue
+ */
+struct SpscQueueDef_t;
+typedef struct SpscQueueDef_t * SpscQueueHandle_t;
+
+/**
+ * spsc_queue.h
+ * @code{c}
+ * SpscQueueHandle_t xSpscQueueCreate( UBaseType_t uxLength,
+ *                                     UBaseType_t uxItemSize );
+ * @endcode
+ *
+ * Create an SPSC queue.  The queue structure and its storage area are
+ * allocated from the FreeRTOS heap in a single block.
+ *
+ * @param uxLength The maximum number of items the queue can hold.
+ *
+ * @param uxItemSize The size, in bytes, of each item.
+ *
+ * @return A handle to the created queue, or NULL if there was insufficient
+ * FreeRTOS heap available to create it.
+ *
+ * Example usage:
+ * @code{c}
+ * static SpscQueueHandle_t xRxQueue;
+ *
+ * void vUARTInterruptHandler( void )
+ * {
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ * char cByte;
+ *
+ *  while( xUARTHasData() != pdFALSE )
+ *  {
+ *      cByte = cUARTReadByte();
+ *
+ *      // There is only one writer, so no interrupt masking is needed.
+ *      xSpscQueueSendFromISR( xRxQueue, &cByte, &xHigherPriorityTaskWoken );
+ *  }
+ *
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ *
+ * void vRxTask( void * pvParameters )
+ * {
+ * char cByte;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xSpscQueueReceive( xRxQueue, &cByte, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          vProcessByte( cByte );
+ *      }
+ *  }
+ * }
+ *
+ * void vSetup( void )
+ * {
+ *  xRxQueue = xSpscQueueCreate( 32, sizeof( char ) );
+ * }
+ * @endcode
+ * \defgroup xSpscQueueCreate xSpscQueueCreate
+ * \ingroup SpscQueue
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    SpscQueueHandle_t xSpscQueueCreate( UBaseType_t uxLength,
+                                        UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * spsc_queue.h
+ * @code{c}
+ * void vSpscQueueDelete( SpscQueueHandle_t xQueue );
+ * @endcode
+ *
+ * Delete an SPSC queue and free its memory.  Neither the producer nor the
+ * consumer may be using the queue when it is deleted.
+ *
+ * @param xQueue The queue to delete.
+ *
+ * \defgroup vSpscQueueDelete vSpscQueueDelete
+ * \ingroup SpscQueue
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    void vSpscQueueDelete( SpscQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * spsc_queue.h
+ * @code{c}
+ * BaseType_t xSpscQueueSend( SpscQueueHandle_t xQueue,
+ *                            const void * pvItem,
+ *                            TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Copy an item to the back of an SPSC queue from the producer task, blocking
+ * if the queue is full.  If the consumer is blocked waiting for an item it is
+ * notified.  The calling task waits on notification index
+ * configSPSC_QUEUE_NOTIFICATION_INDEX, so that index must not be used for
+ * other purposes by the producer task.
+ *
+ * This function must only be called by the queue's single producer, and must
+ * not be called from an interrupt service routine.  See
+ * xSpscQueueSendFromISR() for an alternative which may be used in an ISR.
+ *
+ * @param xQueue The queue to which the item is sent.
+ *
+ * @param pvItem A pointer to the item to copy into the queue.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state waiting for a free slot should the queue be full.
+ *
+ * @return pdPASS if the item was sent, or errQUEUE_FULL if the queue was
+ * still full when the block time expired.
+ *
+ * \defgroup xSpscQueueSend xSpscQueueSend
+ * \ingroup SpscQueue
+ */
+BaseType_t xSpscQueueSend( SpscQueueHandle_t xQueue,
+                           const void * pvItem,
+                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_queue.h
+ * @code{c}
+ * BaseType_t xSpscQueueSendFromISR( SpscQueueHandle_t xQueue,
+ *                                   const void * pvItem,
+ *                                   BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xSpscQueueSend() that can be called from an interrupt service
+ * routine.  Interrupts are only masked if the consumer has to be notified.
+ *
+ * @param xQueue The queue to which the item is sent.
+ *
+ * @param pvItem A pointer to the item to copy into the queue.
+ *
+ * @param pxHigherPriorityTaskWoken *pxHigherPriorityTaskWoken is set to pdTRUE
+ * if sending the item unblocked the consumer and the consumer has a priority
+ * higher than the currently running task.  If it is set to pdTRUE then a
+ * context switch should be requested before the interrupt is exited.
+ *
+ * @return pdPASS if the item was sent, or errQUEUE_FULL if the queue was
+ * full.
+ *
+ * \defgroup xSpscQueueSendFromISR xSpscQueueSendFromISR
+ * \ingroup SpscQueue
+ */
+BaseType_t xSpscQueueSendFromISR( SpscQueueHandle_t xQueue,
+                                  const void * pvItem,
+                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_queue.h
+ * @code{c}
+ * BaseType_t xSpscQueueReceive( SpscQueueHandle_t xQueue,
+ *                               void * pvBuffer,
+ *                               TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Copy the item at the front of an SPSC queue into pvBuffer and remove it
+ * from the queue, blocking if the queue is empty.  The calling task waits on
+ * notification index configSPSC_QUEUE_NOTIFICATION_INDEX, so that index must
+ * not be used for other purposes by the consumer task.
+ *
+ * This function must only be called by the queue's single consumer task.
+ *
+ * @param xQueue The queue from which the item is received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the item is copied.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state waiting for an item should the queue be empty.
+ *
+ * @return pdPASS if an item was received, or errQUEUE_EMPTY if the queue was
+ * still empty when the block time expired.
+ *
+ * \defgroup xSpscQueueReceive xSpscQueueReceive
+ * \ingroup SpscQueue
+ */
+BaseType_t xSpscQueueReceive( SpscQueueHandle_t xQueue,
+                              void * pvBuffer,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_queue.h
+ * @code{c}
+ * UBaseType_t uxSpscQueueMessagesWaiting( SpscQueueHandle_t xQueue );
+ * @endcode
+ *
+ * Return the number of items in an SPSC queue.  The value is only a snapshot
+ * if called by a task other than the consumer, as the producer can add items
+ * at any time.
+ *
+ * @param xQueue The queue being queried.
+ *
+ * @return The number of items in the queue.
+ *
+ * \defgroup uxSpscQueueMessagesWaiting uxSpscQueueMessagesWaiting
+ * \ingroup SpscQueue
+ */
+UBaseType_t uxSpscQueueMessagesWaiting( SpscQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* SPSC_QUEUE_H */
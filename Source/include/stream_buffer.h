@@ -45,7 +45,9 @@
  * different readers then the application writer must serialize calls to reading
  * API functions (such as xStreamBufferReceive()).  One way to achieve such
  * serialization in single core or SMP kernel is to place each API call inside a
- * critical section and use a block time of 0.
+ * critical section and use a block time of 0.  Alternatively, a stream buffer
+ * created using xStreamMultiWriterBufferCreate() can have multiple different
+ * writers without serialization.
  *
  */
 
@@ -65,9 +67,10 @@
 /**
  * Type of stream buffer. For internal use only.
  */
-#define sbTYPE_STREAM_BUFFER             ( ( BaseType_t ) 0 )
-#define sbTYPE_MESSAGE_BUFFER            ( ( BaseType_t ) 1 )
-#define sbTYPE_STREAM_BATCHING_BUFFER    ( ( BaseType_t ) 2 )
+#define sbTYPE_STREAM_BUFFER                 ( ( BaseType_t ) 0 )
+#define sbTYPE_MESSAGE_BUFFER                ( ( BaseType_t ) 1 )
+#define sbTYPE_STREAM_BATCHING_BUFFER        ( ( BaseType_t ) 2 )
+#define sbTYPE_STREAM_MULTI_WRITER_BUFFER    ( ( BaseType_t ) 3 )
 
 /**
  * Type by which stream buffers are referenced.  For example, a call to
@@ -85,6 +88,36 @@ typedef void (* StreamBufferCallbackFunction_t)( StreamBufferHandle_t xStreamBuf
                                                  BaseType_t xIsInsideISR,
                                                  BaseType_t * const pxHigherPriorityTaskWoken );
 
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+/**
+ * Describes a region of a stream buffer's storage area that can be accessed
+ * in place.  A region that wraps past the end of the storage area is described
+ * as two contiguous parts: pucFirst runs from the start of the region to, at
+ * most, the end of the storage area, and pucSecond continues from the start of
+ * the storage area.  pucSecond is NULL, and xSecondLength is 0, if the region
+ * does not wrap.
+ */
+    typedef struct StreamBufferWindow
+    {
+        uint8_t * pucFirst;
+        size_t xFirstLength;
+        uint8_t * pucSecond;
+        size_t xSecondLength;
+    } StreamBufferWindow_t;
+
+/**
+ * Describes one of the pieces of data that xStreamBufferSendV() gathers into
+ * a stream or message buffer.
+ */
+    typedef struct StreamBufferSegment
+    {
+        const void * pvData;
+        size_t xLength;
+    } StreamBufferSegment_t;
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+
 /**
  * stream_buffer.h
  *
@@ -459,6 +492,105 @@ typedef void (* StreamBufferCallbackFunction_t)( StreamBufferHandle_t xStreamBuf
     xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), sbTYPE_STREAM_BATCHING_BUFFER, ( pucStreamBufferStorageArea ), ( pxStaticStreamBuffer ), ( pxSendCompletedCallback ), ( pxReceiveCompletedCallback ) )
 #endif
 
+#if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * StreamBufferHandle_t xStreamMultiWriterBufferCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes );
+ * @endcode
+ *
+ * Creates a new stream buffer that any number of tasks and interrupts can write
+ * to at the same time, using dynamically allocated memory.  See
+ * xStreamMultiWriterBufferCreateStatic() for a version that uses statically
+ * allocated memory.
+ *
+ * A normal stream buffer must only have one writer, so several tasks writing to
+ * it, for example to log to a UART, must take a mutex around
+ * xStreamBufferSend().  Writers to a multi-writer stream buffer instead reserve
+ * space using a compare and swap, then copy their bytes into it at the same
+ * time as other writers copy theirs.  The bytes written by one call are never
+ * interleaved with the bytes written by another.  There must still be only one
+ * reader.
+ *
+ * Bytes become visible to the reader in the order the space was reserved, once
+ * every writer that reserved space before them has finished copying.  A writer
+ * that is preempted while copying therefore delays the bytes of writers that
+ * reserved space after it, but never blocks them.  There is no priority
+ * inheritance and no bound on the delay: if a low priority task is preempted
+ * between reserving and copying, the data of every later writer, including
+ * high priority tasks and interrupts, stays invisible to the reader until the
+ * low priority task runs again.  Their calls still return, but the space they
+ * used is not freed until the reader can read it, so they may then block, or
+ * fail, for lack of space.  Where the latency of data from high priority
+ * writers matters, either give every writer the same priority or have the
+ * high priority writers use their own stream buffer.
+ *
+ * configUSE_STREAM_BUFFER_MULTI_WRITER and configSUPPORT_DYNAMIC_ALLOCATION
+ * must be set to 1 in FreeRTOSConfig.h for xStreamMultiWriterBufferCreate() to
+ * be available.  The windows provided by configUSE_STREAM_BUFFER_ZERO_COPY
+ * can be used to read from, but not write to, a multi-writer stream buffer.
+ *
+ * @param xBufferSizeBytes The total number of bytes the stream buffer will be
+ * able to hold at any one time.  Must be less than 16MB.
+ *
+ * @param xTriggerLevelBytes The number of bytes that must be in the stream
+ * buffer before a task that is blocked on the stream buffer to wait for data is
+ * moved out of the blocked state.
+ *
+ * @return The handle of the created stream buffer, or NULL if there was
+ * insufficient heap memory available to create it.
+ *
+ * Example use:
+ * @code{c}
+ * StreamBufferHandle_t xLogBuffer;
+ *
+ * void vLogInit( void )
+ * {
+ *  xLogBuffer = xStreamMultiWriterBufferCreate( 1024, 1 );
+ * }
+ *
+ * // Called by any number of tasks without a mutex.  Each line reaches the
+ * // UART whole.
+ * void vLog( const char * pcLine )
+ * {
+ *  xStreamBufferSend( xLogBuffer, pcLine, strlen( pcLine ), portMAX_DELAY );
+ * }
+ * @endcode
+ * \defgroup xStreamMultiWriterBufferCreate xStreamMultiWriterBufferCreate
+ * \ingroup StreamBufferManagement
+ */
+    #define xStreamMultiWriterBufferCreate( xBufferSizeBytes, xTriggerLevelBytes ) \
+    xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), sbTYPE_STREAM_MULTI_WRITER_BUFFER, NULL, NULL )
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * StreamBufferHandle_t xStreamMultiWriterBufferCreateStatic( size_t xBufferSizeBytes,
+ *                                                            size_t xTriggerLevelBytes,
+ *                                                            uint8_t *pucStreamBufferStorageArea,
+ *                                                            StaticStreamBuffer_t *pxStaticStreamBuffer );
+ * @endcode
+ *
+ * Creates a new multi-writer stream buffer using statically allocated memory.
+ * See xStreamMultiWriterBufferCreate() for a description of multi-writer stream
+ * buffers, and xStreamBufferCreateStatic() for a description of the
+ * parameters.
+ *
+ * configUSE_STREAM_BUFFER_MULTI_WRITER and configSUPPORT_STATIC_ALLOCATION must
+ * be set to 1 in FreeRTOSConfig.h for xStreamMultiWriterBufferCreateStatic() to
+ * be available.
+ *
+ * \defgroup xStreamMultiWriterBufferCreateStatic xStreamMultiWriterBufferCreateStatic
+ * \ingroup StreamBufferManagement
+ */
+    #define xStreamMultiWriterBufferCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, pucStreamBufferStorageArea, pxStaticStreamBuffer ) \
+    xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), sbTYPE_STREAM_MULTI_WRITER_BUFFER, ( pucStreamBufferStorageArea ), ( pxStaticStreamBuffer ), NULL, NULL )
+
+#endif /* configUSE_STREAM_BUFFER_MULTI_WRITER */
+
 /**
  * stream_buffer.h
  *
@@ -879,6 +1011,607 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
                                     size_t xBufferLengthBytes,
                                     BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferGetWriteWindow( StreamBufferHandle_t xStreamBuffer,
+ *                                     StreamBufferWindow_t * const pxWindow,
+ *                                     TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Obtains the free space in a stream buffer so it can be written to in place,
+ * avoiding the copy made by xStreamBufferSend().  For example, a driver can
+ * give the window to a DMA controller, or decode directly into it.  Nothing
+ * becomes visible to the reader until xStreamBufferCommitWrite() is called.
+ *
+ * The free space starts at the stream buffer's write position and may wrap
+ * past the end of the storage area, in which case it is returned as two
+ * regions.  The first region should be filled before the second.
+ *
+ * The same restrictions apply as to xStreamBufferSend(): there must only be
+ * one writer, and the writer must not call xStreamBufferSend() between
+ * obtaining a window and committing to it.  Windows cannot be used with
+ * message buffers as each message is stored with its length.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferGetWriteWindow() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write to.
+ *
+ * @param pxWindow Set to describe the free space in the stream buffer.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for space to become available if the stream buffer is
+ * full.
+ *
+ * @return The total number of bytes that can be written, which is the sum of
+ * pxWindow->xFirstLength and pxWindow->xSecondLength.  0 if the stream buffer
+ * was still full when the block time expired.
+ *
+ * Example use:
+ * @code{c}
+ * void vAFunction( StreamBufferHandle_t xStreamBuffer )
+ * {
+ * StreamBufferWindow_t xWindow;
+ * size_t xWritten;
+ *
+ *  // Wait up to 100ms for space in the stream buffer.
+ *  if( xStreamBufferGetWriteWindow( xStreamBuffer, &xWindow, pdMS_TO_TICKS( 100 ) ) > 0 )
+ *  {
+ *      // Generate data directly into the first region.  A real application
+ *      // would continue into the second region if the first was filled.
+ *      xWritten = xGenerateData( xWindow.pucFirst, xWindow.xFirstLength );
+ *
+ *      // Make the data available to the reader.
+ *      xStreamBufferCommitWrite( xStreamBuffer, xWritten );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferGetWriteWindow xStreamBufferGetWriteWindow
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferGetWriteWindow( StreamBufferHandle_t xStreamBuffer,
+                                        StreamBufferWindow_t * const pxWindow,
+                                        TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferGetWriteWindowFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                            StreamBufferWindow_t * const pxWindow );
+ * @endcode
+ *
+ * A version of xStreamBufferGetWriteWindow() that can be called from an
+ * interrupt service routine (ISR).  It never blocks.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferGetWriteWindowFromISR() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write to.
+ *
+ * @param pxWindow Set to describe the free space in the stream buffer.
+ *
+ * @return The total number of bytes that can be written, which is 0 if the
+ * stream buffer is full.
+ *
+ * Example use:
+ * @code{c}
+ * // A stream buffer that has already been created.
+ * StreamBufferHandle_t xStreamBuffer;
+ *
+ * void vUARTInterruptHandler( void )
+ * {
+ * StreamBufferWindow_t xWindow;
+ * size_t xSpace, xWritten = 0;
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *  xSpace = xStreamBufferGetWriteWindowFromISR( xStreamBuffer, &xWindow );
+ *
+ *  // Drain the UART FIFO straight into the stream buffer.
+ *  while( ( xWritten < xSpace ) && ( UART_RX_READY() != 0 ) )
+ *  {
+ *      if( xWritten < xWindow.xFirstLength )
+ *      {
+ *          xWindow.pucFirst[ xWritten ] = UART_READ();
+ *      }
+ *      else
+ *      {
+ *          xWindow.pucSecond[ xWritten - xWindow.xFirstLength ] = UART_READ();
+ *      }
+ *
+ *      xWritten++;
+ *  }
+ *
+ *  if( xWritten > 0 )
+ *  {
+ *      xStreamBufferCommitWriteFromISR( xStreamBuffer, xWritten, &xHigherPriorityTaskWoken );
+ *  }
+ *
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ * @endcode
+ * \defgroup xStreamBufferGetWriteWindowFromISR xStreamBufferGetWriteWindowFromISR
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferGetWriteWindowFromISR( StreamBufferHandle_t xStreamBuffer,
+                                               StreamBufferWindow_t * const pxWindow ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+ *                                      size_t xBytesWritten );
+ * @endcode
+ *
+ * Makes bytes written into a window obtained from
+ * xStreamBufferGetWriteWindow() available to the reader.  A task blocked
+ * reading from the stream buffer is unblocked if the number of bytes in the
+ * stream buffer reaches its trigger level, exactly as if the bytes had been
+ * sent using xStreamBufferSend().
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferCommitWrite() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer that was written to.
+ *
+ * @param xBytesWritten The number of bytes written, counting from the start of
+ * the window's first region.  Must not be more than the size of the window.
+ *
+ * @return pdPASS if the bytes were committed.  pdFAIL if xBytesWritten was 0 or
+ * more than the free space in the stream buffer.
+ *
+ * \defgroup xStreamBufferCommitWrite xStreamBufferCommitWrite
+ * \ingroup StreamBufferManagement
+ */
+    BaseType_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+                                         size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                             size_t xBytesWritten,
+ *                                             BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xStreamBufferCommitWrite() that can be called from an interrupt
+ * service routine (ISR).
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferCommitWriteFromISR() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer that was written to.
+ *
+ * @param xBytesWritten The number of bytes written.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if committing the bytes
+ * unblocked a task that has a priority above the task that was interrupted, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.  See xStreamBufferSendFromISR().
+ *
+ * @return pdPASS if the bytes were committed, otherwise pdFAIL.
+ *
+ * \defgroup xStreamBufferCommitWriteFromISR xStreamBufferCommitWriteFromISR
+ * \ingroup StreamBufferManagement
+ */
+    BaseType_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                size_t xBytesWritten,
+                                                BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferGetReadWindow( StreamBufferHandle_t xStreamBuffer,
+ *                                    StreamBufferWindow_t * const pxWindow,
+ *                                    TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Obtains the bytes held in a stream buffer so they can be read in place,
+ * avoiding the copy made by xStreamBufferReceive().  The bytes remain in the
+ * stream buffer until xStreamBufferConsume() is called, so a parser can, for
+ * example, look for a complete frame and only consume it once one is found.
+ *
+ * The data starts at the stream buffer's read position and may wrap past the
+ * end of the storage area, in which case it is returned as two regions.  The
+ * first region holds the oldest data.
+ *
+ * The same restrictions apply as to xStreamBufferReceive(): there must only be
+ * one reader.  Windows cannot be used with message buffers.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferGetReadWindow() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param pxWindow Set to describe the bytes held in the stream buffer.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data if the stream buffer is empty.  As with
+ * xStreamBufferReceive(), the task is unblocked when the number of bytes in the
+ * stream buffer reaches the trigger level (or, for a batching buffer, exceeds
+ * it) or the block time expires.
+ *
+ * @return The total number of bytes that can be read, which is the sum of
+ * pxWindow->xFirstLength and pxWindow->xSecondLength.
+ *
+ * Example use:
+ * @code{c}
+ * void vAFunction( StreamBufferHandle_t xStreamBuffer )
+ * {
+ * StreamBufferWindow_t xWindow;
+ * size_t xUsed;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xStreamBufferGetReadWindow( xStreamBuffer, &xWindow, portMAX_DELAY ) > 0 )
+ *      {
+ *          // Parse as much as possible without copying.  xParse() returns
+ *          // the number of bytes that made up complete frames, leaving any
+ *          // partial frame in the stream buffer until more data arrives.
+ *          xUsed = xParse( xWindow.pucFirst, xWindow.xFirstLength,
+ *                          xWindow.pucSecond, xWindow.xSecondLength );
+ *
+ *          if( xUsed > 0 )
+ *          {
+ *              xStreamBufferConsume( xStreamBuffer, xUsed );
+ *          }
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferGetReadWindow xStreamBufferGetReadWindow
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferGetReadWindow( StreamBufferHandle_t xStreamBuffer,
+                                       StreamBufferWindow_t * const pxWindow,
+                                       TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferGetReadWindowFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                           StreamBufferWindow_t * const pxWindow );
+ * @endcode
+ *
+ * A version of xStreamBufferGetReadWindow() that can be called from an
+ * interrupt service routine (ISR).  It never blocks.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferGetReadWindowFromISR() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param pxWindow Set to describe the bytes held in the stream buffer.
+ *
+ * @return The total number of bytes that can be read, which is 0 if the stream
+ * buffer is empty.
+ *
+ * \defgroup xStreamBufferGetReadWindowFromISR xStreamBufferGetReadWindowFromISR
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferGetReadWindowFromISR( StreamBufferHandle_t xStreamBuffer,
+                                              StreamBufferWindow_t * const pxWindow ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+ *                                  size_t xBytesConsumed );
+ * @endcode
+ *
+ * Removes bytes read from a window obtained from xStreamBufferGetReadWindow()
+ * from the stream buffer, making the space available to the writer.  A task
+ * blocked writing to the stream buffer is unblocked, exactly as if the bytes
+ * had been read using xStreamBufferReceive().
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferConsume() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer that was read from.
+ *
+ * @param xBytesConsumed The number of bytes to remove, counting from the start
+ * of the window's first region.
+ *
+ * @return pdPASS if the bytes were removed.  pdFAIL if xBytesConsumed was 0 or
+ * more than the number of bytes in the stream buffer.
+ *
+ * \defgroup xStreamBufferConsume xStreamBufferConsume
+ * \ingroup StreamBufferManagement
+ */
+    BaseType_t xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xBytesConsumed ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         size_t xBytesConsumed,
+ *                                         BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xStreamBufferConsume() that can be called from an interrupt
+ * service routine (ISR).
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferConsumeFromISR() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer that was read from.
+ *
+ * @param xBytesConsumed The number of bytes to remove.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if removing the bytes
+ * unblocked a task that has a priority above the task that was interrupted, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.  See xStreamBufferReceiveFromISR().
+ *
+ * @return pdPASS if the bytes were removed, otherwise pdFAIL.
+ *
+ * \defgroup xStreamBufferConsumeFromISR xStreamBufferConsumeFromISR
+ * \ingroup StreamBufferManagement
+ */
+    BaseType_t xStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            size_t xBytesConsumed,
+                                            BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+ *                            const StreamBufferSegment_t * pxSegments,
+ *                            size_t xSegmentCount,
+ *                            TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Sends the xSegmentCount pieces of data described by pxSegments to a stream
+ * or message buffer as if they were one contiguous block, copying each piece
+ * straight into the buffer's storage area.  Data that is held in separate
+ * places, such as a header, a payload and a checksum, can therefore be sent
+ * without first assembling it in a temporary buffer.
+ *
+ * A message buffer stores the segments as a single message whose length is the
+ * total length of the segments.  A stream buffer writes as many of the leading
+ * bytes as there is space for, exactly as xStreamBufferSend() does.  The reader
+ * never sees part of a write.
+ *
+ * xStreamBufferSendV() cannot be used with a multi-writer stream buffer.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferSendV() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream or message buffer to which the
+ * data is being sent.
+ *
+ * @param pxSegments An array of xSegmentCount segments, each holding a pointer
+ * to a piece of the data and the length of that piece in bytes.
+ *
+ * @param xSegmentCount The number of segments in pxSegments.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for enough space to become available.
+ * See xStreamBufferSend().
+ *
+ * @return The number of bytes written to the buffer, not including the bytes
+ * used to store a message's length.
+ *
+ * Example use:
+ * @code{c}
+ * void vSendFrame( MessageBufferHandle_t xMessageBuffer,
+ *                  const FrameHeader_t * pxHeader,
+ *                  const uint8_t * pucPayload,
+ *                  size_t xPayloadLength )
+ * {
+ * uint16_t usCRC = usCalculateCRC( pxHeader, pucPayload, xPayloadLength );
+ * StreamBufferSegment_t xSegments[ 3 ];
+ *
+ *  xSegments[ 0 ].pvData = pxHeader;
+ *  xSegments[ 0 ].xLength = sizeof( FrameHeader_t );
+ *  xSegments[ 1 ].pvData = pucPayload;
+ *  xSegments[ 1 ].xLength = xPayloadLength;
+ *  xSegments[ 2 ].pvData = &usCRC;
+ *  xSegments[ 2 ].xLength = sizeof( usCRC );
+ *
+ *  // Send the frame as one message without copying it into a local buffer.
+ *  xStreamBufferSendV( xMessageBuffer, xSegments, 3, pdMS_TO_TICKS( 100 ) );
+ * }
+ * @endcode
+ * \defgroup xStreamBufferSendV xStreamBufferSendV
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+                               const StreamBufferSegment_t * pxSegments,
+                               size_t xSegmentCount,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                   const StreamBufferSegment_t * pxSegments,
+ *                                   size_t xSegmentCount,
+ *                                   BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xStreamBufferSendV() that can be called from an interrupt
+ * service routine (ISR).
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferSendVFromISR() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream or message buffer to which the
+ * data is being sent.
+ *
+ * @param pxSegments An array of xSegmentCount segments to send.
+ *
+ * @param xSegmentCount The number of segments in pxSegments.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if sending the data unblocked
+ * a task that has a priority above the task that was interrupted, in which case
+ * a context switch should be requested before the interrupt is exited.  See
+ * xStreamBufferSendFromISR().
+ *
+ * @return The number of bytes written to the buffer.
+ *
+ * \defgroup xStreamBufferSendVFromISR xStreamBufferSendVFromISR
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                      const StreamBufferSegment_t * pxSegments,
+                                      size_t xSegmentCount,
+                                      BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferPeekMessage( StreamBufferHandle_t xStreamBuffer,
+ *                                  StreamBufferWindow_t * const pxWindow,
+ *                                  TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Describes the next message in a message buffer in pxWindow without copying
+ * it out of, or removing it from, the message buffer.  The message is read in
+ * place through the window, then removed with xStreamBufferDiscardMessage(),
+ * or left in the buffer to be received later.
+ *
+ * The message buffer must have a single reader, which must not receive from
+ * or discard messages from the buffer while it is using the window.
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferPeekMessage() to be available.
+ *
+ * @param xStreamBuffer The handle of the message buffer being peeked.
+ *
+ * @param pxWindow Set to the one or two regions of the buffer's storage area
+ * that hold the message.  Both regions are empty if the buffer is empty.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for a message, should the message buffer
+ * be empty.  See xStreamBufferReceive().
+ *
+ * @return The length of the message in bytes, which is the total length of the
+ * window, or 0 if the message buffer is empty.
+ *
+ * Example use:
+ * @code{c}
+ * void vProcessFrames( MessageBufferHandle_t xMessageBuffer )
+ * {
+ * StreamBufferWindow_t xWindow;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xStreamBufferPeekMessage( xMessageBuffer, &xWindow, portMAX_DELAY ) > 0 )
+ *      {
+ *          // Parse the frame where it is, then free its space.
+ *          vParseFrame( xWindow.pucFirst, xWindow.xFirstLength,
+ *                       xWindow.pucSecond, xWindow.xSecondLength );
+ *          xStreamBufferDiscardMessage( xMessageBuffer );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferPeekMessage xStreamBufferPeekMessage
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferPeekMessage( StreamBufferHandle_t xStreamBuffer,
+                                     StreamBufferWindow_t * const pxWindow,
+                                     TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferPeekMessageFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         StreamBufferWindow_t * const pxWindow );
+ * @endcode
+ *
+ * A version of xStreamBufferPeekMessage() that can be called from an interrupt
+ * service routine (ISR).
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferPeekMessageFromISR() to be available.
+ *
+ * @param xStreamBuffer The handle of the message buffer being peeked.
+ *
+ * @param pxWindow Set to the regions of the buffer that hold the next message.
+ *
+ * @return The length of the next message in bytes, or 0 if the message buffer
+ * is empty.
+ *
+ * \defgroup xStreamBufferPeekMessageFromISR xStreamBufferPeekMessageFromISR
+ * \ingroup StreamBufferManagement
+ */
+    size_t xStreamBufferPeekMessageFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            StreamBufferWindow_t * const pxWindow ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferDiscardMessage( StreamBufferHandle_t xStreamBuffer );
+ * @endcode
+ *
+ * Removes the next message from a message buffer without copying it, making
+ * its space available to the writer.  Normally used to remove a message that
+ * was read in place using xStreamBufferPeekMessage().  A task blocked writing
+ * to the message buffer is unblocked, exactly as if the message had been read
+ * using xStreamBufferReceive().
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferDiscardMessage() to be available.
+ *
+ * @param xStreamBuffer The handle of the message buffer.
+ *
+ * @return pdPASS if a message was removed.  pdFAIL if the message buffer was
+ * empty.
+ *
+ * \defgroup xStreamBufferDiscardMessage xStreamBufferDiscardMessage
+ * \ingroup StreamBufferManagement
+ */
+    BaseType_t xStreamBufferDiscardMessage( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferDiscardMessageFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                                BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xStreamBufferDiscardMessage() that can be called from an
+ * interrupt service routine (ISR).
+ *
+ * configUSE_STREAM_BUFFER_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferDiscardMessageFromISR() to be available.
+ *
+ * @param xStreamBuffer The handle of the message buffer.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if removing the message
+ * unblocked a task that has a priority above the task that was interrupted, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.  See xStreamBufferReceiveFromISR().
+ *
+ * @return pdPASS if a message was removed, otherwise pdFAIL.
+ *
+ * \defgroup xStreamBufferDiscardMessageFromISR xStreamBufferDiscardMessageFromISR
+ * \ingroup StreamBufferManagement
+ */
+    BaseType_t xStreamBufferDiscardMessageFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+
 /**
  * stream_buffer.h
  *
@@ -1264,6 +1997,11 @@ StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
 
 size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_WAIT_ANY == 1 )
+    UBaseType_t uxStreamBufferSetWaitingReceiverRestricted( StreamBufferHandle_t xStreamBuffer,
+                                                            TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_TRACE_FACILITY == 1 )
     void vStreamBufferSetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer,
                                              UBaseType_t uxStreamBufferNumber ) PRIVILEGED_FUNCTION;
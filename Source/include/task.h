@@ -115,13 +115,31 @@ typedef enum
 /* Actions that can be performed when vTaskNotify() is called. */
 typedef enum
 {
-    eNoAction = 0,            /* Notify the task without updating its notify value. */
-    eSetBits,                 /* Set bits in the task's notification value. */
-    eIncrement,               /* Increment the task's notification value. */
-    eSetValueWithOverwrite,   /* Set the task's notification value to a specific value even if the previous value has not yet been read by the task. */
-    eSetValueWithoutOverwrite /* Set the task's notification value if the previous value has been read by the task. */
+    eNoAction = 0,             /* Notify the task without updating its notify value. */
+    eSetBits,                  /* Set bits in the task's notification value. */
+    eIncrement,                /* Increment the task's notification value. */
+    eSetValueWithOverwrite,    /* Set the task's notification value to a specific value even if the previous value has not yet been read by the task. */
+    eSetValueWithoutOverwrite, /* Set the task's notification value if the previous value has been read by the task. */
+    eIncrementBy               /* Add a value to the task's notification value. */
 } eNotifyAction;
 
+/* Kinds of object that xTaskWaitAny() can wait on. */
+typedef enum
+{
+    eWaitAnyQueue = 0,    /* A queue or semaphore that holds an item. */
+    eWaitAnyStreamBuffer, /* A stream or message buffer that holds data. */
+    eWaitAnyNotification  /* A notification pending at an index of the calling task's notification array. */
+} eWaitAnyObjectType;
+
+/* An object passed to xTaskWaitAny().  xListItem is used internally only. */
+typedef struct xWAIT_ANY_OBJECT
+{
+    eWaitAnyObjectType eType;
+    void * pvObject;      /* The queue, semaphore or stream buffer handle.  Not used for notifications. */
+    UBaseType_t uxIndex;  /* The notification index.  Only used for notifications. */
+    ListItem_t xListItem; /* Placed in the queue's list of waiting tasks while the calling task is blocked. */
+} WaitAnyObject_t;
+
 /*
  * Used internally only.
  */
@@ -178,6 +196,13 @@ typedef struct xTASK_STATUS
     #if ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
         UBaseType_t uxCoreAffinityMask;           /* The core affinity mask for the task */
     #endif
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        TickType_t xAbsoluteDeadline;             /* The absolute deadline of the task's current job.  Only valid for tasks created with xTaskCreateEdf(). */
+        UBaseType_t uxDeadlineMisses;             /* The number of jobs that completed after their deadline.  Only valid for tasks created with xTaskCreateEdf(). */
+    #endif
+    #if ( configUSE_TASK_CPU_BUDGET == 1 )
+        UBaseType_t uxBudgetThrottleCount;        /* The number of times the task has been throttled because it used all of its processor time budget. */
+    #endif
 } TaskStatus_t;
 
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
@@ -280,6 +305,9 @@ typedef enum
 #define taskSCHEDULER_NOT_STARTED    ( ( BaseType_t ) 1 )
 #define taskSCHEDULER_RUNNING        ( ( BaseType_t ) 2 )
 
+/* Returned by xTaskWaitAny() when no object became ready in time. */
+#define taskWAIT_ANY_TIMEOUT    ( ( BaseType_t ) -1 )
+
 /* Checks if core ID is valid. */
 #define taskVALID_CORE_ID( xCoreID )    ( ( ( ( ( BaseType_t ) 0 <= ( xCoreID ) ) && ( ( xCoreID ) < ( BaseType_t ) configNUMBER_OF_CORES ) ) ) ? ( pdTRUE ) : ( pdFALSE ) )
 
@@ -400,6 +428,111 @@ typedef enum
                                        TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskCreateEdf( TaskFunction_t pxTaskCode,
+ *                            const char * const pcName,
+ *                            const configSTACK_DEPTH_TYPE uxStackDepth,
+ *                            void * const pvParameters,
+ *                            TickType_t xPeriod,
+ *                            TickType_t xRelativeDeadline,
+ *                            TickType_t xWorstCaseExecutionTime,
+ *                            TaskHandle_t * const pxCreatedTask );
+ * @endcode
+ *
+ * Create a periodic task that is scheduled by Earliest Deadline First rather
+ * than by fixed priority.  configUSE_EDF_SCHEDULING must be set to 1 in
+ * FreeRTOSConfig.h for this function to be available.
+ *
+ * EDF tasks all run at configEDF_PRIORITY.  Within that priority the ready
+ * task whose current job has the earliest absolute deadline always runs, so
+ * tasks above configEDF_PRIORITY still preempt the EDF tasks and tasks below
+ * it only run when no EDF job is ready.  Tasks that are not created with this
+ * function should not be given configEDF_PRIORITY.
+ *
+ * When an EDF task blocks on a mutex, the mutex holder inherits the deadline
+ * of the blocked task if it is earlier than its own, along with the priority,
+ * and keeps it until it no longer holds any mutexes.  A holder that inherits
+ * configEDF_PRIORITY from a task without a deadline is scheduled after all EDF
+ * jobs.  A task that is unblocked by a give, a notification or a resume
+ * preempts the running EDF task immediately if its deadline is earlier.
+ * An inherited deadline is not dropped if the blocked task times out.
+ *
+ * The first job is released when the task is created.  Each job ends with a
+ * call to vTaskEdfWaitForNextPeriod(), which blocks the task until the next
+ * release, one period after the previous one.  The absolute deadline of a job
+ * is its release time plus xRelativeDeadline.
+ *
+ * A task is only admitted if the sum of the densities ( WCET divided by the
+ * lesser of the deadline and the period ) of all EDF tasks, including the new
+ * task, does not exceed 1.  This guarantees every deadline is met provided no
+ * job runs for longer than its declared worst case execution time.
+ *
+ * Tasks of equal priority do not preempt each other when they become ready,
+ * so a job released with an earlier deadline than the running job preempts it
+ * at the next tick interrupt.
+ *
+ * @param pxTaskCode Pointer to the task entry function.
+ *
+ * @param pcName A descriptive name for the task.
+ *
+ * @param uxStackDepth The size of the task stack specified as the number of
+ * variables the stack can hold - not the number of bytes.
+ *
+ * @param pvParameters Pointer that will be used as the parameter for the task
+ * being created.
+ *
+ * @param xPeriod The time, in ticks, between the releases of two consecutive
+ * jobs.
+ *
+ * @param xRelativeDeadline The time, in ticks, after its release by which each
+ * job must complete.
+ *
+ * @param xWorstCaseExecutionTime The longest time, in ticks, that a single job
+ * can execute for.  Used for admission control only.
+ *
+ * @param pxCreatedTask Used to pass back a handle by which the created task
+ * can be referenced.
+ *
+ * @return pdPASS if the task was admitted and created, pdFAIL if admitting
+ * the task would overload the processor, or
+ * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY if the task could not be allocated.
+ *
+ * Example usage:
+ * @code{c}
+ * void vSampleTask( void * pvParameters )
+ * {
+ *   for( ;; )
+ *   {
+ *       // Do the work of one job, then wait for the next release.
+ *       vTaskEdfWaitForNextPeriod();
+ *   }
+ * }
+ *
+ * void vOtherFunction( void )
+ * {
+ *   // Release a job every 100ms that must complete within 50ms and never
+ *   // runs for longer than 5ms.
+ *   xTaskCreateEdf( vSampleTask, "Sample", STACK_SIZE, NULL,
+ *                   pdMS_TO_TICKS( 100 ), pdMS_TO_TICKS( 50 ),
+ *                   pdMS_TO_TICKS( 5 ), NULL );
+ * }
+ * @endcode
+ * \defgroup xTaskCreateEdf xTaskCreateEdf
+ * \ingroup Tasks
+ */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULING == 1 ) )
+    BaseType_t xTaskCreateEdf( TaskFunction_t pxTaskCode,
+                               const char * const pcName,
+                               const configSTACK_DEPTH_TYPE uxStackDepth,
+                               void * const pvParameters,
+                               TickType_t xPeriod,
+                               TickType_t xRelativeDeadline,
+                               TickType_t xWorstCaseExecutionTime,
+                               TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -804,6 +937,60 @@ typedef enum
  */
 void vTaskDelete( TaskHandle_t xTaskToDelete ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetRecycleCacheStats( UBaseType_t * puxHits, UBaseType_t * puxMisses );
+ * @endcode
+ *
+ * configTASK_RECYCLE_CACHE_DEPTH must be set to a value greater than 0 for
+ * this function to be available.
+ *
+ * When a task that was created with xTaskCreate() is deleted, its TCB and
+ * stack are kept in a cache of up to configTASK_RECYCLE_CACHE_DEPTH entries
+ * instead of being returned to the heap.  A later call to xTaskCreate() that
+ * requests the same stack depth reuses a cached TCB and stack without calling
+ * pvPortMalloc(), which avoids heap fragmentation in applications that create
+ * and delete short lived tasks.  The cache is filled as tasks are deleted, so
+ * the memory is reclaimed by the idle task when a task deletes itself.
+ *
+ * vTaskGetRecycleCacheStats() returns the number of dynamic task creations
+ * that reused a cached TCB and stack, and the number that had to allocate
+ * from the heap.
+ *
+ * @param puxHits Used to return the number of creations served from the
+ * cache.  Can be NULL.
+ *
+ * @param puxMisses Used to return the number of creations that allocated
+ * memory from the heap.  Can be NULL.
+ *
+ * \defgroup vTaskGetRecycleCacheStats vTaskGetRecycleCacheStats
+ * \ingroup Tasks
+ */
+#if ( configTASK_RECYCLE_CACHE_DEPTH > 0 )
+    void vTaskGetRecycleCacheStats( UBaseType_t * puxHits,
+                                    UBaseType_t * puxMisses ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskFlushRecycleCache( void );
+ * @endcode
+ *
+ * configTASK_RECYCLE_CACHE_DEPTH must be set to a value greater than 0 for
+ * this function to be available.
+ *
+ * Return the memory of every TCB and stack held in the recycle cache to the
+ * heap, for example before allocating a large block that needs the memory.
+ *
+ * \defgroup vTaskFlushRecycleCache vTaskFlushRecycleCache
+ * \ingroup Tasks
+ */
+#if ( configTASK_RECYCLE_CACHE_DEPTH > 0 )
+    void vTaskFlushRecycleCache( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /*-----------------------------------------------------------
 * TASK CONTROL API
 *----------------------------------------------------------*/
@@ -936,6 +1123,29 @@ BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
     } while( 0 )
 
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskEdfWaitForNextPeriod( void );
+ * @endcode
+ *
+ * Called by a task created with xTaskCreateEdf() when its current job is
+ * complete.  If the job completed after its absolute deadline the task's
+ * deadline miss count, reported by uxTaskGetSystemState() and vTaskGetInfo(),
+ * is incremented.  The task then blocks until its next job is released, or
+ * continues immediately with the next job if that release time has already
+ * passed.
+ *
+ * configUSE_EDF_SCHEDULING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * \defgroup vTaskEdfWaitForNextPeriod vTaskEdfWaitForNextPeriod
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    void vTaskEdfWaitForNextPeriod( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -1190,6 +1400,65 @@ UBaseType_t uxTaskBasePriorityGetFromISR( const TaskHandle_t xTask ) PRIVILEGED_
 void vTaskPrioritySet( TaskHandle_t xTask,
                        UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetCpuBudget( TaskHandle_t xTask, configRUN_TIME_COUNTER_TYPE ulBudget, TickType_t xPeriod );
+ * @endcode
+ *
+ * configUSE_TASK_CPU_BUDGET must be defined as 1 for this function to be
+ * available.  configUSE_TASK_CPU_BUDGET requires configGENERATE_RUN_TIME_STATS
+ * to also be set to 1.  See the configuration section for more information.
+ *
+ * Limit the processor time a task can use in each period, so a task can be
+ * given a high priority for responsiveness without being able to starve lower
+ * priority tasks for more than its budget.
+ *
+ * Execution time is measured with the run time stats counter.  When the task
+ * has consumed ulBudget in the current period it is throttled at the next
+ * tick or context switch.  A throttled task stays in the Ready state, but is
+ * not selected to run until the tick interrupt at which the period ends
+ * replenishes its budget.  It cannot be released early by xTaskAbortDelay()
+ * or vTaskResume().  Periods follow on from each other at a fixed interval
+ * from when the budget was set, and setting a new budget releases a throttled
+ * task straight away.  A task that holds a mutex is not throttled until it
+ * has released the mutex, so the budget cannot extend the time a higher
+ * priority task is blocked by priority inversion.  The budget is only enforced
+ * at tick granularity.
+ *
+ * @param xTask Handle to the task for which the budget is being set.  Passing
+ * a NULL handle results in the budget of the calling task being set.
+ *
+ * @param ulBudget The amount of processor time the task can use in each
+ * period, in the units of the run time stats counter.  Passing 0 removes the
+ * budget.
+ *
+ * @param xPeriod The length of the replenishment period in ticks.  Must be
+ * no more than half of portMAX_DELAY.
+ *
+ * Example usage:
+ * @code{c}
+ * void vAFunction( void )
+ * {
+ * TaskHandle_t xHandle;
+ *
+ *   // Create a logging task at a high priority.
+ *   xTaskCreate( vLoggingTask, "LOG", STACK_SIZE, NULL, tskIDLE_PRIORITY + 3, &xHandle );
+ *
+ *   // Allow it at most 2000 run time counter units of processor time in each
+ *   // 100 ms.
+ *   vTaskSetCpuBudget( xHandle, 2000, pdMS_TO_TICKS( 100 ) );
+ * }
+ * @endcode
+ * \defgroup vTaskSetCpuBudget vTaskSetCpuBudget
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_CPU_BUDGET == 1 )
+    void vTaskSetCpuBudget( TaskHandle_t xTask,
+                            configRUN_TIME_COUNTER_TYPE ulBudget,
+                            TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -2594,6 +2863,11 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
  * The target notification value is incremented.  ulValue is not used and
  * xTaskNotifyIndexed() always returns pdPASS in this case.
  *
+ * eIncrementBy -
+ * ulValue is added to the target notification value.  If ulValue is 0 the
+ * call has no effect - the task is not notified, so it is not unblocked.
+ * xTaskNotifyIndexed() always returns pdPASS in this case.
+ *
  * eSetValueWithOverwrite -
  * The target notification value is set to the value of ulValue, even if the
  * task being notified had not yet processed the previous notification at the
@@ -2742,6 +3016,11 @@ BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify,
  * The task's notification value is incremented.  ulValue is not used and
  * xTaskNotify() always returns pdPASS in this case.
  *
+ * eIncrementBy -
+ * ulValue is added to the task's notification value.  If ulValue is 0 the
+ * call has no effect - the task is not notified, so it is not unblocked.
+ * xTaskNotify() always returns pdPASS in this case.
+ *
  * eSetValueWithOverwrite -
  * The task's notification value is set to the value of ulValue, even if the
  * task being notified had not yet processed the previous notification (the
@@ -3005,6 +3284,44 @@ BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn,
 #define xTaskNotifyGiveIndexed( xTaskToNotify, uxIndexToNotify ) \
     xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( 0 ), eIncrement, NULL )
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskNotifyGiveNIndexed( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulCount );
+ * BaseType_t xTaskNotifyGiveN( TaskHandle_t xTaskToNotify, uint32_t ulCount );
+ * @endcode
+ *
+ * A version of xTaskNotifyGiveIndexed() that gives ulCount at once, as if
+ * xTaskNotifyGiveIndexed() had been called ulCount times but with only one
+ * critical section and at most one context switch.  Use it when a batch of
+ * items becomes ready together, and ulTaskNotifyTakeUpToIndexed() to claim a
+ * bounded batch in the receiving task.
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this macro
+ * to be available.
+ *
+ * @param xTaskToNotify The handle of the task being notified.
+ *
+ * @param uxIndexToNotify The index within the target task's array of
+ * notification values to which the notification is to be sent.  uxIndexToNotify
+ * must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES.  xTaskNotifyGiveN()
+ * does not have this parameter and always sends notifications to index 0.
+ *
+ * @param ulCount The amount to add to the notification value.  If ulCount is 0
+ * nothing is given and the task is not unblocked.  As with xTaskNotifyGive(),
+ * the count wraps if it overflows.
+ *
+ * @return xTaskNotifyGiveN() is a macro that calls xTaskNotify() with the
+ * eAction parameter set to eIncrementBy - so pdPASS is always returned.
+ *
+ * \defgroup xTaskNotifyGiveNIndexed xTaskNotifyGiveNIndexed
+ * \ingroup TaskNotifications
+ */
+#define xTaskNotifyGiveN( xTaskToNotify, ulCount ) \
+    xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulCount ), eIncrementBy, NULL )
+#define xTaskNotifyGiveNIndexed( xTaskToNotify, uxIndexToNotify, ulCount ) \
+    xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulCount ), eIncrementBy, NULL )
+
 /**
  * task. h
  * @code{c}
@@ -3092,6 +3409,41 @@ void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify,
 #define vTaskNotifyGiveIndexedFromISR( xTaskToNotify, uxIndexToNotify, pxHigherPriorityTaskWoken ) \
     vTaskGenericNotifyGiveFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( pxHigherPriorityTaskWoken ) )
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskNotifyGiveNIndexedFromISR( TaskHandle_t xTaskHandle, UBaseType_t uxIndexToNotify, uint32_t ulCount, BaseType_t *pxHigherPriorityTaskWoken );
+ * void vTaskNotifyGiveNFromISR( TaskHandle_t xTaskHandle, uint32_t ulCount, BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xTaskNotifyGiveNIndexed() that can be called from an interrupt
+ * service routine (ISR).  An interrupt that has made several items ready can
+ * signal them all with one call.
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this macro
+ * to be available.
+ *
+ * @param xTaskToNotify The handle of the task being notified.
+ *
+ * @param uxIndexToNotify The index within the target task's array of
+ * notification values to which the notification is to be sent.  uxIndexToNotify
+ * must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ * vTaskNotifyGiveNFromISR() does not have this parameter and always sends
+ * notifications to index 0.
+ *
+ * @param ulCount The amount to add to the notification value.  If ulCount is 0
+ * nothing is given and the task is not unblocked.
+ *
+ * @param pxHigherPriorityTaskWoken As for vTaskNotifyGiveIndexedFromISR().
+ *
+ * \defgroup vTaskNotifyGiveNIndexedFromISR vTaskNotifyGiveNIndexedFromISR
+ * \ingroup TaskNotifications
+ */
+#define vTaskNotifyGiveNFromISR( xTaskToNotify, ulCount, pxHigherPriorityTaskWoken ) \
+    ( ( void ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulCount ), eIncrementBy, NULL, ( pxHigherPriorityTaskWoken ) ) )
+#define vTaskNotifyGiveNIndexedFromISR( xTaskToNotify, uxIndexToNotify, ulCount, pxHigherPriorityTaskWoken ) \
+    ( ( void ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulCount ), eIncrementBy, NULL, ( pxHigherPriorityTaskWoken ) ) )
+
 /**
  * task. h
  * @code{c}
@@ -3198,6 +3550,51 @@ uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn,
 #define ulTaskNotifyTakeIndexed( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait ) \
     ulTaskGenericNotifyTake( ( uxIndexToWaitOn ), ( xClearCountOnExit ), ( xTicksToWait ) )
 
+/**
+ * task. h
+ * @code{c}
+ * uint32_t ulTaskNotifyTakeUpToIndexed( UBaseType_t uxIndexToWaitOn, uint32_t ulMaxCount, TickType_t xTicksToWait );
+ *
+ * uint32_t ulTaskNotifyTakeUpTo( uint32_t ulMaxCount, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * A version of ulTaskNotifyTakeIndexed() that claims a bounded batch.  The
+ * calling task waits, as ulTaskNotifyTakeIndexed() does, for its notification
+ * value to be non-zero, then subtracts whichever is smaller of the notification
+ * value and ulMaxCount from it, and returns the amount subtracted.  Whatever is
+ * left stays pending for the next call.
+ *
+ * ulTaskNotifyTakeUpToIndexed( uxIndex, 1, xTicksToWait ) takes one count, like
+ * ulTaskNotifyTakeIndexed( uxIndex, pdFALSE, xTicksToWait ), but returns 1 rather
+ * than the count before it was decremented.
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * function to be available.
+ *
+ * @param uxIndexToWaitOn The index within the calling task's array of
+ * notification values on which the calling task will wait.  uxIndexToWaitOn
+ * must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ * ulTaskNotifyTakeUpTo() does not have this parameter and always waits on index
+ * 0.
+ *
+ * @param ulMaxCount The most that will be taken.  Must not be 0.
+ *
+ * @param xTicksToWait The maximum amount of time that the task should wait in
+ * the Blocked state for the task's notification value to be greater than zero.
+ *
+ * @return The amount taken, which is 0 only if the block time expired.
+ *
+ * \defgroup ulTaskNotifyTakeUpToIndexed ulTaskNotifyTakeUpToIndexed
+ * \ingroup TaskNotifications
+ */
+uint32_t ulTaskGenericNotifyTakeUpTo( UBaseType_t uxIndexToWaitOn,
+                                      uint32_t ulMaxCount,
+                                      TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define ulTaskNotifyTakeUpTo( ulMaxCount, xTicksToWait ) \
+    ulTaskGenericNotifyTakeUpTo( ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulMaxCount ), ( xTicksToWait ) )
+#define ulTaskNotifyTakeUpToIndexed( uxIndexToWaitOn, ulMaxCount, xTicksToWait ) \
+    ulTaskGenericNotifyTakeUpTo( ( uxIndexToWaitOn ), ( ulMaxCount ), ( xTicksToWait ) )
+
 /**
  * task. h
  * @code{c}
@@ -3328,6 +3725,95 @@ uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask,
 #define ulTaskNotifyValueClearIndexed( xTask, uxIndexToClear, ulBitsToClear ) \
     ulTaskGenericNotifyValueClear( ( xTask ), ( uxIndexToClear ), ( ulBitsToClear ) )
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskWaitAny( WaitAnyObject_t * const pxObjects,
+ *                          UBaseType_t uxObjectCount,
+ *                          TickType_t xTicksToWait );
+ * @endcode
+ *
+ * configUSE_WAIT_ANY must be defined as 1 for this function to be available.
+ *
+ * Block the calling task until any one of a set of objects is ready:  a queue
+ * or semaphore holds an item, a stream or message buffer holds data, or a
+ * notification is pending at an index of the calling task's notification
+ * array.  Nothing is read from the object - the task reads it with a zero
+ * block time once xTaskWaitAny() returns.
+ *
+ * Unlike a queue set, nothing has to be created and the objects do not have to
+ * be added to anything in advance, so sending to a queue costs nothing extra.
+ * While the task is blocked, pxObjects[ x ].xListItem is placed in the list of
+ * tasks waiting to receive from each queue, and the task is registered as the
+ * reader of each stream buffer, so pxObjects must remain valid until the
+ * function returns.
+ *
+ * A queue must not also be a member of a queue set, and the task must be the
+ * only reader of any stream or message buffer it waits on.  Waiting on a mutex
+ * does not cause priority inheritance, and fast mutexes cannot be waited on.
+ *
+ * Stream and message buffers wake the task with a notification at their
+ * notification index, which is cleared when xTaskWaitAny() returns, as it is
+ * by xStreamBufferReceive().  Notifications waited on with
+ * eWaitAnyNotification should therefore use a different index.
+ *
+ * @param pxObjects An array describing the objects to wait on.  Set eType and
+ * pvObject for queues, semaphores and stream buffers, and eType and uxIndex for
+ * notifications.
+ *
+ * @param uxObjectCount The number of entries in pxObjects.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state for an object to become ready.
+ *
+ * @return The index in pxObjects of the first ready object, or
+ * taskWAIT_ANY_TIMEOUT if no object became ready before the block time
+ * expired.
+ *
+ * Example usage:
+ * @code{c}
+ * void vTask( void * pvParameters )
+ * {
+ * WaitAnyObject_t xObjects[ 3 ];
+ * Command_t xCommand;
+ * uint8_t ucBytes[ 16 ];
+ *
+ *  xObjects[ 0 ].eType = eWaitAnyQueue;
+ *  xObjects[ 0 ].pvObject = xCommandQueue;
+ *  xObjects[ 1 ].eType = eWaitAnyStreamBuffer;
+ *  xObjects[ 1 ].pvObject = xSerialStream;
+ *  xObjects[ 2 ].eType = eWaitAnyNotification;
+ *  xObjects[ 2 ].uxIndex = 1;
+ *
+ *  for( ;; )
+ *  {
+ *      switch( xTaskWaitAny( xObjects, 3, portMAX_DELAY ) )
+ *      {
+ *          case 0:
+ *              xQueueReceive( xCommandQueue, &xCommand, 0 );
+ *              vProcessCommand( &xCommand );
+ *              break;
+ *
+ *          case 1:
+ *              vProcessBytes( ucBytes, xStreamBufferReceive( xSerialStream, ucBytes, sizeof( ucBytes ), 0 ) );
+ *              break;
+ *
+ *          case 2:
+ *              vProcessEvents( ulTaskNotifyTakeIndexed( 1, pdTRUE, 0 ) );
+ *              break;
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xTaskWaitAny xTaskWaitAny
+ * \ingroup TaskNotifications
+ */
+#if ( configUSE_WAIT_ANY == 1 )
+    BaseType_t xTaskWaitAny( WaitAnyObject_t * const pxObjects,
+                             UBaseType_t uxObjectCount,
+                             TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task.h
  * @code{c}
@@ -3500,6 +3986,17 @@ void vTaskResetState( void ) PRIVILEGED_FUNCTION;
  */
 BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * The type of the value an event group stores in the event list item of a
+ * task blocked on it - the bits the task is waiting for, and then the bits
+ * that unblocked it.  It must be as wide as EventBits_t.
+ */
+#if ( configUSE_64_BIT_EVENT_BITS == 1 )
+    typedef uint64_t TaskEventItemValue_t;
+#else
+    typedef TickType_t TaskEventItemValue_t;
+#endif
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
  * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
@@ -3534,9 +4031,26 @@ BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
 void vTaskPlaceOnEventList( List_t * const pxEventList,
                             const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
-                                     const TickType_t xItemValue,
+                                     const TaskEventItemValue_t xItemValue,
                                      const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED WITH INTERRUPTS DISABLED.
+ *
+ * A version of vTaskPlaceOnEventList() used by the queue batch transfer
+ * functions.  Also records that the task is waiting for uxItemsNeeded items or
+ * spaces, so xTaskRemoveFromEventListForBatch() only unblocks it once that
+ * many are available.
+ */
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+    void vTaskPlaceOnEventListForBatch( List_t * const pxEventList,
+                                        UBaseType_t uxItemsNeeded,
+                                        const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
  * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
@@ -3578,7 +4092,48 @@ void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
  */
 BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
-                                        const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+                                        const TaskEventItemValue_t xItemValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED WITH INTERRUPTS DISABLED.
+ *
+ * Used in place of xTaskRemoveFromEventList() on queues when batch transfers
+ * are enabled, as a task waiting in xQueueSendMultiple() or
+ * xQueueReceiveMultiple() can need more than one item or space.  Unblocks the
+ * tasks on the event list, in priority order, whose needs can be met from the
+ * uxAvailable items or spaces, skipping any that need more, until the uxAdded
+ * items or spaces just made available are accounted for.
+ *
+ * @return pdTRUE if a task that was unblocked has a higher priority than the
+ * task making the call, otherwise pdFALSE.
+ */
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+    BaseType_t xTaskRemoveFromEventListForBatch( const List_t * const pxEventList,
+                                                 UBaseType_t uxAvailable,
+                                                 UBaseType_t uxAdded ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED WITH INTERRUPTS DISABLED.
+ *
+ * A version of vTaskRemoveFromUnorderedEventList() that can be called from a
+ * critical section, including a critical section within an ISR, whether or not
+ * the scheduler is suspended.  Used by xEventGroupSetBitsFromISR() when
+ * configEVENT_GROUP_ISR_MAX_WAITERS is greater than 0.
+ *
+ * @return pdTRUE if the task being removed has a higher priority than the task
+ * making the call, otherwise pdFALSE.
+ */
+#if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem,
+                                                         const TaskEventItemValue_t xItemValue ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
@@ -3598,7 +4153,19 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
  * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
  * THE EVENT BITS MODULE.
  */
-TickType_t uxTaskResetEventItemValue( void ) PRIVILEGED_FUNCTION;
+TaskEventItemValue_t uxTaskResetEventItemValue( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS USED BY THE
+ * EVENT BITS MODULE.
+ *
+ * Returns the value stored by vTaskPlaceOnUnorderedEventList() for the task
+ * that owns pxEventListItem, when that value is too wide to be held in the
+ * list item itself.
+ */
+#if ( tskEVENT_ITEM_VALUE_IN_TCB != 0 )
+    TaskEventItemValue_t uxTaskGetEventItemValue( const ListItem_t * pxEventListItem ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * Return the handle of the calling task.
@@ -3697,6 +4264,15 @@ void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
  */
 TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Increment the mutex held count of a task other than
+ * the calling task.  Used when a task first blocks on a fast mutex that its
+ * holder took without entering the kernel, and when a reader-writer lock is
+ * handed to a task that was blocked on it.  Must be called from a critical
+ * section.
+ */
+void vTaskIncrementMutexHeldCountOfHolder( TaskHandle_t xMutexHolder ) PRIVILEGED_FUNCTION;
+
 /*
  * For internal use only.  Same as vTaskSetTimeOutState(), but without a critical
  * section.
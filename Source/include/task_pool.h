@@ -0,0 +1,292 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include task_pool.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A task pool is a fixed set of worker tasks that execute short jobs submitted
+ * by other tasks.  Each job is a function and an argument.  Submitting a job
+ * does not create a task or allocate memory, so jobs that are too short to
+ * justify a task of their own can still run in parallel with the submitting
+ * task, or on another core in an SMP system.
+ *
+ * Each worker has its own queue of jobs.  Jobs are distributed between the
+ * workers in turn, and a worker that has emptied its own queue takes jobs
+ * from the queues of the other workers before it blocks.  Workers wait for
+ * jobs on a direct to task notification, so an idle pool uses no processor
+ * time.
+ *
+ * The configUSE_TASK_POOL configuration constant must be set to 1 for the task
+ * pool API to be available.
+ *
+ * \defgroup TaskPoolHandle_t TaskPoolHandle_t
+ * \ingroup TaskPool
+ */
+struct TaskPoolDef_t;
+typedef struct TaskPoolDef_t * TaskPoolHandle_t;
+
+/*
+ * Defines the prototype to which job functions must conform.
+ */
+typedef void (* TaskPoolFunction_t)( void * pvArgument );
+
+/*
+ * A job, as passed to uxTaskPoolSubmitBatch().
+ */
+typedef struct xTASK_POOL_JOB
+{
+    TaskPoolFunction_t pxFunction; /**< The function executed by a worker. */
+    void * pvArgument;             /**< The value passed into pxFunction. */
+} TaskPoolJob_t;
+
+/*
+ * A future tracks the completion of one or more submitted jobs, and allows a
+ * task to block until they have all completed.  Futures are allocated by the
+ * application, typically on the stack of the task that submits the jobs, and
+ * must be initialised with vTaskPoolInitialiseFuture() before use.  The
+ * members should not be accessed directly.
+ *
+ * A worker writes to the future each time one of its jobs completes, so the
+ * future must remain valid until xTaskPoolWait() has returned pdPASS for it.
+ * A future on the stack must not go out of scope after xTaskPoolWait() has
+ * timed out while jobs are still queued or running.
+ */
+typedef struct xTASK_POOL_FUTURE
+{
+    volatile UBaseType_t uxPendingJobs; /**< The number of jobs submitted with this future that have not completed. */
+    TaskHandle_t xWaitingTask;          /**< The task blocked in xTaskPoolWait(), if any. */
+} TaskPoolFuture_t;
+
+/**
+ * task_pool.h
+ * @code{c}
+ * TaskPoolHandle_t xTaskPoolCreate( const char * const pcName,
+ *                                   UBaseType_t uxWorkerCount,
+ *                                   UBaseType_t uxJobsPerWorker,
+ *                                   configSTACK_DEPTH_TYPE uxStackDepth,
+ *                                   UBaseType_t uxPriority );
+ * @endcode
+ *
+ * Create a task pool.  The pool structure, the job queues and the worker tasks
+ * are all allocated from the FreeRTOS heap.
+ *
+ * @param pcName A descriptive name given to each worker task.
+ *
+ * @param uxWorkerCount The number of worker tasks to create.
+ *
+ * @param uxJobsPerWorker The number of jobs each worker's queue can hold.
+ * The pool can hold uxWorkerCount * uxJobsPerWorker jobs that have been
+ * submitted but not yet started.
+ *
+ * @param uxStackDepth The stack depth of each worker task.  Jobs execute on
+ * this stack.
+ *
+ * @param uxPriority The priority of the worker tasks.
+ *
+ * @return A handle to the created pool, or NULL if there was insufficient
+ * FreeRTOS heap available to create it.
+ *
+ * Example usage:
+ * @code{c}
+ * static void prvScaleBlock( void * pvArgument )
+ * {
+ *  // Process the block of samples pointed to by pvArgument.
+ * }
+ *
+ * void vAFunction( void )
+ * {
+ * TaskPoolHandle_t xPool;
+ * TaskPoolFuture_t xFuture;
+ * UBaseType_t x;
+ *
+ *  // Create a pool of two workers, each able to queue eight jobs.
+ *  xPool = xTaskPoolCreate( "Pool", 2, 8, configMINIMAL_STACK_SIZE, tskIDLE_PRIORITY + 1 );
+ *
+ *  // Process four blocks in parallel, then wait for them all to complete.
+ *  vTaskPoolInitialiseFuture( &xFuture );
+ *
+ *  for( x = 0; x < 4; x++ )
+ *  {
+ *      xTaskPoolSubmit( xPool, prvScaleBlock, &( pxBlocks[ x ] ), &xFuture );
+ *  }
+ *
+ *  // xFuture is on this function's stack and is updated by the workers, so
+ *  // the function must not return until every job has completed.
+ *  // portMAX_DELAY only blocks indefinitely when INCLUDE_vTaskSuspend is 1,
+ *  // so the wait is repeated until it succeeds.
+ *  while( xTaskPoolWait( &xFuture, portMAX_DELAY ) != pdPASS )
+ *  {
+ *  }
+ * }
+ * @endcode
+ * \defgroup xTaskPoolCreate xTaskPoolCreate
+ * \ingroup TaskPool
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    TaskPoolHandle_t xTaskPoolCreate( const char * const pcName,
+                                      UBaseType_t uxWorkerCount,
+                                      UBaseType_t uxJobsPerWorker,
+                                      configSTACK_DEPTH_TYPE uxStackDepth,
+                                      UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task_pool.h
+ * @code{c}
+ * void vTaskPoolInitialiseFuture( TaskPoolFuture_t * pxFuture );
+ * @endcode
+ *
+ * Initialise a future so it can be passed to xTaskPoolSubmit() or
+ * uxTaskPoolSubmitBatch().  A future can be reused once xTaskPoolWait() has
+ * reported that all of its jobs have completed.
+ *
+ * @param pxFuture The future to initialise.
+ *
+ * \defgroup vTaskPoolInitialiseFuture vTaskPoolInitialiseFuture
+ * \ingroup TaskPool
+ */
+void vTaskPoolInitialiseFuture( TaskPoolFuture_t * pxFuture ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_pool.h
+ * @code{c}
+ * BaseType_t xTaskPoolSubmit( TaskPoolHandle_t xPool,
+ *                             TaskPoolFunction_t pxFunction,
+ *                             void * pvArgument,
+ *                             TaskPoolFuture_t * pxFuture );
+ * @endcode
+ *
+ * Submit a job to a task pool.  The job is placed in the queue of the next
+ * worker in turn, or of the following worker if that queue is full, and the
+ * worker is notified.  This function does not block.
+ *
+ * @param xPool The pool to which the job is submitted.
+ *
+ * @param pxFunction The function to execute.
+ *
+ * @param pvArgument The value passed into pxFunction.
+ *
+ * @param pxFuture A future used to wait for the job to complete, or NULL if
+ * completion does not need to be tracked.  One future can track many jobs.
+ *
+ * @return pdPASS if the job was submitted, or errQUEUE_FULL if the queues of
+ * all the workers are full.
+ *
+ * \defgroup xTaskPoolSubmit xTaskPoolSubmit
+ * \ingroup TaskPool
+ */
+BaseType_t xTaskPoolSubmit( TaskPoolHandle_t xPool,
+                            TaskPoolFunction_t pxFunction,
+                            void * pvArgument,
+                            TaskPoolFuture_t * pxFuture ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_pool.h
+ * @code{c}
+ * UBaseType_t uxTaskPoolSubmitBatch( TaskPoolHandle_t xPool,
+ *                                    const TaskPoolJob_t * pxJobs,
+ *                                    UBaseType_t uxJobCount,
+ *                                    TaskPoolFuture_t * pxFuture );
+ * @endcode
+ *
+ * Submit a number of jobs to a task pool.  The jobs are shared between the
+ * workers, and each worker's share is queued in a single critical section and
+ * signalled with a single notification, which is cheaper than submitting the
+ * jobs one at a time.  This function does not block.
+ *
+ * @param xPool The pool to which the jobs are submitted.
+ *
+ * @param pxJobs An array of the jobs to submit.
+ *
+ * @param uxJobCount The number of jobs in the pxJobs array.
+ *
+ * @param pxFuture A future used to wait for all the submitted jobs to
+ * complete, or NULL if completion does not need to be tracked.
+ *
+ * @return The number of jobs submitted, starting from the first in the
+ * pxJobs array.  Fewer than uxJobCount jobs are submitted if the queues of
+ * the workers become full.
+ *
+ * \defgroup uxTaskPoolSubmitBatch uxTaskPoolSubmitBatch
+ * \ingroup TaskPool
+ */
+UBaseType_t uxTaskPoolSubmitBatch( TaskPoolHandle_t xPool,
+                                   const TaskPoolJob_t * pxJobs,
+                                   UBaseType_t uxJobCount,
+                                   TaskPoolFuture_t * pxFuture ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_pool.h
+ * @code{c}
+ * BaseType_t xTaskPoolWait( TaskPoolFuture_t * pxFuture, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Wait for every job submitted with a future to complete.  The calling task
+ * is notified on notification index configTASK_POOL_NOTIFICATION_INDEX when
+ * the last job completes, so that index must not be used for other purposes
+ * by tasks that wait on futures.  Only one task can wait on a future at a
+ * time.
+ *
+ * @param pxFuture The future to wait on.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in
+ * the Blocked state waiting for the jobs to complete.
+ *
+ * @return pdPASS if all the jobs completed, otherwise pdFAIL.  When pdFAIL is
+ * returned the outstanding jobs are still queued or running and will still
+ * update the future when they complete, so the future, and anything the jobs'
+ * arguments reference, must remain valid.  xTaskPoolWait() can be called
+ * again to continue waiting.
+ *
+ * \defgroup xTaskPoolWait xTaskPoolWait
+ * \ingroup TaskPool
+ */
+BaseType_t xTaskPoolWait( TaskPoolFuture_t * pxFuture,
+                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* TASK_POOL_H */
@@ -0,0 +1,565 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mpmc_queue.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include MPMC queue functionality. This #if is closed at the very bottom of
+ * this file. If you want to include MPMC queues then ensure
+ * configUSE_MPMC_QUEUES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_MPMC_QUEUES == 1 )
+
+    #include "atomic.h"
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define mpmcYIELD_IF_USING_PREEMPTION()
+    #else
+        #define mpmcYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+    #endif
+
+/* A send or receive position, padded so that the two positions never share a
+ * cache line. */
+    typedef union MpmcQueuePosition
+    {
+        volatile uint32_t ulPosition;
+        uint8_t ucPadding[ configCACHE_LINE_SIZE ];
+    } MpmcQueuePosition_t;
+
+/* The send and receive positions count up forever, wrapping at 2^32, and the
+ * slot used at a position is the position masked by ulMask.  The sequence
+ * number of a slot says which position may use it next:
+ *  - equal to the send position when the slot is free for that send,
+ *  - one more than the receive position when it holds the item for that
+ *    receive.
+ * A slot whose sequence number is behind the position has not yet been
+ * released by the previous user, meaning the queue is full (for a send) or
+ * empty (for a receive). */
+    typedef struct MpmcQueueDef_t
+    {
+        MpmcQueuePosition_t xSend;                  /**< The position the next item is sent to. */
+        MpmcQueuePosition_t xReceive;               /**< The position the next item is received from. */
+        volatile UBaseType_t uxSendersWaiting;      /**< The number of tasks blocking, or about to block, on xTasksWaitingToSend. */
+        volatile UBaseType_t uxReceiversWaiting;    /**< The number of tasks blocking, or about to block, on xTasksWaitingToReceive. */
+        List_t xTasksWaitingToSend;                 /**< Tasks waiting for space, in priority order. */
+        List_t xTasksWaitingToReceive;              /**< Tasks waiting for an item, in priority order. */
+        uint32_t ulMask;                            /**< The queue length minus one. */
+        UBaseType_t uxItemSize;                     /**< The size of each item in bytes. */
+        volatile uint32_t * pulSequenceNumbers;     /**< One sequence number per slot, following this structure in memory. */
+        uint8_t * pucStorage;                       /**< The item storage, following the sequence numbers in memory. */
+    } MpmcQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Claim the next send position and copy pvItem into its slot.  Returns pdFALSE
+ * without blocking if the queue is full.
+ */
+    static BaseType_t prvTrySend( MpmcQueue_t * const pxQueue,
+                                  const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Claim the next receive position and copy its item into pvBuffer.  Returns
+ * pdFALSE without blocking if the queue is empty.
+ */
+    static BaseType_t prvTryReceive( MpmcQueue_t * const pxQueue,
+                                     void * pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock the highest priority task in pxEventList if *puxWaiting shows a
+ * task might be waiting there.  Called after an item or a slot has been
+ * released.
+ */
+    static void prvUnblockWaitingTask( List_t * const pxEventList,
+                                       volatile UBaseType_t * const puxWaiting ) PRIVILEGED_FUNCTION;
+
+/*
+ * Block the calling task on the list of senders or receivers until it is
+ * unblocked or xTicksToWait expires, unless the queue stopped being full or
+ * empty while the task was registering itself as waiting.
+ */
+    static void prvBlockOnQueue( MpmcQueue_t * const pxQueue,
+                                 BaseType_t xSending,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return pdTRUE if the slot at the current send position is not yet free,
+ * or the slot at the current receive position does not yet hold an item.
+ */
+    static BaseType_t prvIsQueueFull( const MpmcQueue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvIsQueueEmpty( const MpmcQueue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        MpmcQueueHandle_t xMpmcQueueCreate( UBaseType_t uxLength,
+                                            UBaseType_t uxItemSize )
+        {
+            MpmcQueue_t * pxQueue = NULL;
+            size_t xStorageSizeInBytes;
+            uint32_t ulSlot;
+
+            traceENTER_xMpmcQueueCreate( uxLength, uxItemSize );
+
+            configASSERT( uxItemSize > ( UBaseType_t ) 0U );
+
+            /* The slot is found by masking the position, which only works if
+             * the length divides 2^32.  A sequence number that has moved one
+             * lap ahead must differ from one that has not, so at least two
+             * slots are needed. */
+            configASSERT( uxLength >= ( UBaseType_t ) 2U );
+            configASSERT( ( uxLength & ( uxLength - ( UBaseType_t ) 1U ) ) == ( UBaseType_t ) 0U );
+
+            if( ( uxLength >= ( UBaseType_t ) 2U ) &&
+                ( ( uxLength & ( uxLength - ( UBaseType_t ) 1U ) ) == ( UBaseType_t ) 0U ) &&
+                ( ( uint32_t ) ( uxLength - ( UBaseType_t ) 1U ) == ( uxLength - ( UBaseType_t ) 1U ) ) &&
+                /* Check for multiplication overflow. */
+                ( ( SIZE_MAX / uxLength ) >= ( uxItemSize + sizeof( uint32_t ) ) ) &&
+                /* Check for addition overflow. */
+                ( ( SIZE_MAX - sizeof( MpmcQueue_t ) ) >= ( size_t ) ( ( size_t ) uxLength * ( ( size_t ) uxItemSize + sizeof( uint32_t ) ) ) ) )
+            {
+                xStorageSizeInBytes = ( size_t ) uxLength * ( ( size_t ) uxItemSize + sizeof( uint32_t ) );
+
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxQueue = ( MpmcQueue_t * ) pvPortMalloc( sizeof( MpmcQueue_t ) + xStorageSizeInBytes );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxQueue != NULL )
+            {
+                pxQueue->xSend.ulPosition = 0U;
+                pxQueue->xReceive.ulPosition = 0U;
+                pxQueue->uxSendersWaiting = ( UBaseType_t ) 0U;
+                pxQueue->uxReceiversWaiting = ( UBaseType_t ) 0U;
+                vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
+                vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+                pxQueue->ulMask = ( uint32_t ) ( uxLength - ( UBaseType_t ) 1U );
+                pxQueue->uxItemSize = uxItemSize;
+
+                /* The structure contains pointers and 32-bit members, so the
+                 * sequence numbers that follow it are suitably aligned. */
+                pxQueue->pulSequenceNumbers = ( volatile uint32_t * ) &( pxQueue[ 1 ] );
+                pxQueue->pucStorage = ( uint8_t * ) &( pxQueue->pulSequenceNumbers[ uxLength ] );
+
+                /* Every slot starts free for the first send to use it. */
+                for( ulSlot = 0U; ulSlot <= pxQueue->ulMask; ulSlot++ )
+                {
+                    pxQueue->pulSequenceNumbers[ ulSlot ] = ulSlot;
+                }
+            }
+            else
+            {
+                traceMPMC_QUEUE_CREATE_FAILED();
+            }
+
+            traceRETURN_xMpmcQueueCreate( pxQueue );
+
+            return pxQueue;
+        }
+/*-----------------------------------------------------------*/
+
+        void vMpmcQueueDelete( MpmcQueueHandle_t xQueue )
+        {
+            traceENTER_vMpmcQueueDelete( xQueue );
+
+            configASSERT( xQueue != NULL );
+            configASSERT( listLIST_IS_EMPTY( &( xQueue->xTasksWaitingToSend ) ) != pdFALSE );
+            configASSERT( listLIST_IS_EMPTY( &( xQueue->xTasksWaitingToReceive ) ) != pdFALSE );
+
+            vPortFree( xQueue );
+
+            traceRETURN_vMpmcQueueDelete();
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTrySend( MpmcQueue_t * const pxQueue,
+                                  const void * pvItem )
+    {
+        uint32_t ulPosition = pxQueue->xSend.ulPosition;
+        uint32_t ulSlot;
+        BaseType_t xReturn = pdFALSE;
+
+        for( ; ; )
+        {
+            ulSlot = ulPosition & pxQueue->ulMask;
+
+            if( pxQueue->pulSequenceNumbers[ ulSlot ] == ulPosition )
+            {
+                /* The slot is free.  Claiming the position gives this task
+                 * sole use of the slot until its sequence number is updated. */
+                if( Atomic_CompareAndSwap_u32( &( pxQueue->xSend.ulPosition ), ulPosition + 1U, ulPosition ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+                {
+                    ( void ) memcpy( ( void * ) &( pxQueue->pucStorage[ ( size_t ) ulSlot * pxQueue->uxItemSize ] ), pvItem, ( size_t ) pxQueue->uxItemSize );
+
+                    /* The item must be complete before a receiver can see
+                     * it. */
+                    portMEMORY_BARRIER();
+                    pxQueue->pulSequenceNumbers[ ulSlot ] = ulPosition + 1U;
+                    xReturn = pdTRUE;
+                    break;
+                }
+            }
+            else if( ( ( uint32_t ) ( ulPosition - pxQueue->pulSequenceNumbers[ ulSlot ] ) ) <= pxQueue->ulMask )
+            {
+                /* The sequence number is behind the position, so the item sent
+                 * one lap earlier has not yet been received. */
+                break;
+            }
+            else
+            {
+                /* Another task claimed this position first. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ulPosition = pxQueue->xSend.ulPosition;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTryReceive( MpmcQueue_t * const pxQueue,
+                                     void * pvBuffer )
+    {
+        uint32_t ulPosition = pxQueue->xReceive.ulPosition;
+        uint32_t ulSlot;
+        BaseType_t xReturn = pdFALSE;
+
+        for( ; ; )
+        {
+            ulSlot = ulPosition & pxQueue->ulMask;
+
+            if( pxQueue->pulSequenceNumbers[ ulSlot ] == ( ulPosition + 1U ) )
+            {
+                /* The slot holds the item for this position. */
+                if( Atomic_CompareAndSwap_u32( &( pxQueue->xReceive.ulPosition ), ulPosition + 1U, ulPosition ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+                {
+                    /* Do not read the item until its sequence number has been
+                     * read. */
+                    portMEMORY_BARRIER();
+                    ( void ) memcpy( pvBuffer, ( const void * ) &( pxQueue->pucStorage[ ( size_t ) ulSlot * pxQueue->uxItemSize ] ), ( size_t ) pxQueue->uxItemSize );
+
+                    /* The item must be copied out before the slot is freed for
+                     * the send one lap later. */
+                    portMEMORY_BARRIER();
+                    pxQueue->pulSequenceNumbers[ ulSlot ] = ulPosition + pxQueue->ulMask + 1U;
+                    xReturn = pdTRUE;
+                    break;
+                }
+            }
+            else if( ( ( uint32_t ) ( ( ulPosition + 1U ) - pxQueue->pulSequenceNumbers[ ulSlot ] ) ) <= pxQueue->ulMask + 1U )
+            {
+                /* The sequence number is behind the position, so the item for
+                 * this position has not been sent yet. */
+                break;
+            }
+            else
+            {
+                /* Another task claimed this position first. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ulPosition = pxQueue->xReceive.ulPosition;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvIsQueueFull( const MpmcQueue_t * const pxQueue )
+    {
+        const uint32_t ulPosition = pxQueue->xSend.ulPosition;
+
+        return ( pxQueue->pulSequenceNumbers[ ulPosition & pxQueue->ulMask ] != ulPosition ) ? pdTRUE : pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvIsQueueEmpty( const MpmcQueue_t * const pxQueue )
+    {
+        const uint32_t ulPosition = pxQueue->xReceive.ulPosition;
+
+        return ( pxQueue->pulSequenceNumbers[ ulPosition & pxQueue->ulMask ] != ( ulPosition + 1U ) ) ? pdTRUE : pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvUnblockWaitingTask( List_t * const pxEventList,
+                                       volatile UBaseType_t * const puxWaiting )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
+
+        /* A task that is about to block increments the count before it checks
+         * the queue for the last time, so the release of the item or slot
+         * must be visible before the count is read. */
+        portMEMORY_BARRIER();
+
+        if( *puxWaiting != ( UBaseType_t ) 0U )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
+                {
+                    xYieldRequired = xTaskRemoveFromEventList( pxEventList );
+                }
+                else
+                {
+                    /* The waiting task has not placed itself on the list yet,
+                     * and will find the item or slot when it checks again. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xYieldRequired != pdFALSE )
+            {
+                mpmcYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvBlockOnQueue( MpmcQueue_t * const pxQueue,
+                                 BaseType_t xSending,
+                                 TickType_t xTicksToWait )
+    {
+        List_t * const pxEventList = ( xSending != pdFALSE ) ? &( pxQueue->xTasksWaitingToSend ) : &( pxQueue->xTasksWaitingToReceive );
+        volatile UBaseType_t * const puxWaiting = ( xSending != pdFALSE ) ? &( pxQueue->uxSendersWaiting ) : &( pxQueue->uxReceiversWaiting );
+        BaseType_t xStillBlocked;
+
+        /* Event lists are only modified with the scheduler suspended or from a
+         * critical section, so a task that unblocks waiting tasks cannot look
+         * at the list while this task is being placed on it. */
+        vTaskSuspendAll();
+        {
+            ( *puxWaiting )++;
+
+            /* Check the queue again now the count shows this task is waiting,
+             * as a task that released an item or slot before it could see the
+             * count will not try to unblock this task. */
+            portMEMORY_BARRIER();
+            xStillBlocked = ( xSending != pdFALSE ) ? prvIsQueueFull( pxQueue ) : prvIsQueueEmpty( pxQueue );
+
+            if( xStillBlocked != pdFALSE )
+            {
+                vTaskPlaceOnEventList( pxEventList, xTicksToWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( ( xTaskResumeAll() == pdFALSE ) && ( xStillBlocked != pdFALSE ) )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        taskENTER_CRITICAL();
+        {
+            ( *puxWaiting )--;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMpmcQueueSend( MpmcQueueHandle_t xQueue,
+                               const void * pvItem,
+                               TickType_t xTicksToWait )
+    {
+        MpmcQueue_t * const pxQueue = xQueue;
+        TimeOut_t xTimeOut;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xReturn;
+
+        traceENTER_xMpmcQueueSend( xQueue, pvItem, xTicksToWait );
+
+        configASSERT( pxQueue != NULL );
+        configASSERT( pvItem != NULL );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            if( prvTrySend( pxQueue, pvItem ) != pdFALSE )
+            {
+                prvUnblockWaitingTask( &( pxQueue->xTasksWaitingToReceive ), &( pxQueue->uxReceiversWaiting ) );
+                xReturn = pdPASS;
+                break;
+            }
+
+            /* xTaskCheckForTimeOut() sets xTicksToWait to zero on timeout. */
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                xReturn = errQUEUE_FULL;
+                break;
+            }
+
+            if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+
+            prvBlockOnQueue( pxQueue, pdTRUE, xTicksToWait );
+
+            ( void ) xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
+        }
+
+        traceRETURN_xMpmcQueueSend( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMpmcQueueReceive( MpmcQueueHandle_t xQueue,
+                                  void * pvBuffer,
+                                  TickType_t xTicksToWait )
+    {
+        MpmcQueue_t * const pxQueue = xQueue;
+        TimeOut_t xTimeOut;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xReturn;
+
+        traceENTER_xMpmcQueueReceive( xQueue, pvBuffer, xTicksToWait );
+
+        configASSERT( pxQueue != NULL );
+        configASSERT( pvBuffer != NULL );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            if( prvTryReceive( pxQueue, pvBuffer ) != pdFALSE )
+            {
+                prvUnblockWaitingTask( &( pxQueue->xTasksWaitingToSend ), &( pxQueue->uxSendersWaiting ) );
+                xReturn = pdPASS;
+                break;
+            }
+
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                xReturn = errQUEUE_EMPTY;
+                break;
+            }
+
+            if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+
+            prvBlockOnQueue( pxQueue, pdFALSE, xTicksToWait );
+
+            ( void ) xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
+        }
+
+        traceRETURN_xMpmcQueueReceive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxMpmcQueueMessagesWaiting( MpmcQueueHandle_t xQueue )
+    {
+        const MpmcQueue_t * const pxQueue = xQueue;
+        uint32_t ulReceivePosition, ulSendPosition;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxMpmcQueueMessagesWaiting( xQueue );
+
+        configASSERT( pxQueue != NULL );
+
+        ulReceivePosition = pxQueue->xReceive.ulPosition;
+        ulSendPosition = pxQueue->xSend.ulPosition;
+
+        /* The positions are read separately, so a receive that completes
+         * between the two reads can make the difference exceed the length. */
+        if( ( uint32_t ) ( ulSendPosition - ulReceivePosition ) > ( pxQueue->ulMask + 1U ) )
+        {
+            uxReturn = ( UBaseType_t ) pxQueue->ulMask + ( UBaseType_t ) 1U;
+        }
+        else
+        {
+            uxReturn = ( UBaseType_t ) ( uint32_t ) ( ulSendPosition - ulReceivePosition );
+        }
+
+        traceRETURN_uxMpmcQueueMessagesWaiting( uxReturn );
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include MPMC queue functionality. If you want to include MPMC queues then
+ * ensure configUSE_MPMC_QUEUES is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_MPMC_QUEUES == 1 */
@@ -1312,7 +1312,8 @@
                       ( pxParams->eAction == eSetBits ) ||
                       ( pxParams->eAction == eIncrement ) ||
                       ( pxParams->eAction == eSetValueWithOverwrite ) ||
-                      ( pxParams->eAction == eSetValueWithoutOverwrite ) ) )
+                      ( pxParams->eAction == eSetValueWithoutOverwrite ) ||
+                      ( pxParams->eAction == eIncrementBy ) ) )
                 {
                     if( pxParams->pulPreviousNotificationValue != NULL )
                     {
@@ -1443,6 +1444,30 @@
     #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+        uint32_t MPU_ulTaskGenericNotifyTakeUpToImpl( UBaseType_t uxIndexToWaitOn,
+                                                      uint32_t ulMaxCount,
+                                                      TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+        uint32_t MPU_ulTaskGenericNotifyTakeUpToImpl( UBaseType_t uxIndexToWaitOn,
+                                                      uint32_t ulMaxCount,
+                                                      TickType_t xTicksToWait ) /* PRIVILEGED_FUNCTION */
+        {
+            uint32_t ulReturn = 0;
+
+            if( ( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES ) &&
+                ( ulMaxCount != 0U ) )
+            {
+                ulReturn = ulTaskGenericNotifyTakeUpTo( uxIndexToWaitOn, ulMaxCount, xTicksToWait );
+            }
+
+            return ulReturn;
+        }
+
+    #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+/*-----------------------------------------------------------*/
+
     #if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
         BaseType_t MPU_xTaskGenericNotifyStateClearImpl( TaskHandle_t xTask,
@@ -5270,7 +5295,7 @@
             ( UBaseType_t ) MPU_xStreamBufferSpacesAvailableImpl,           /* SYSTEM_CALL_xStreamBufferSpacesAvailable. */
             ( UBaseType_t ) MPU_xStreamBufferBytesAvailableImpl,            /* SYSTEM_CALL_xStreamBufferBytesAvailable. */
             ( UBaseType_t ) MPU_xStreamBufferSetTriggerLevelImpl,           /* SYSTEM_CALL_xStreamBufferSetTriggerLevel. */
-            ( UBaseType_t ) MPU_xStreamBufferNextMessageLengthBytesImpl     /* SYSTEM_CALL_xStreamBufferNextMessageLengthBytes. */
+            ( UBaseType_t ) MPU_xStreamBufferNextMessageLengthBytesImpl,    /* SYSTEM_CALL_xStreamBufferNextMessageLengthBytes. */
         #else
             ( UBaseType_t ) 0,                                              /* SYSTEM_CALL_xStreamBufferSend. */
             ( UBaseType_t ) 0,                                              /* SYSTEM_CALL_xStreamBufferReceive. */
@@ -5282,6 +5307,11 @@
             ( UBaseType_t ) 0,                                              /* SYSTEM_CALL_xStreamBufferNextMessageLengthBytes. */
         #endif
 
+        #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+            ( UBaseType_t ) MPU_ulTaskGenericNotifyTakeUpToImpl             /* SYSTEM_CALL_ulTaskGenericNotifyTakeUpTo. */
+        #else
+            ( UBaseType_t ) 0                                               /* SYSTEM_CALL_ulTaskGenericNotifyTakeUpTo. */
+        #endif
     };
 /*-----------------------------------------------------------*/
 
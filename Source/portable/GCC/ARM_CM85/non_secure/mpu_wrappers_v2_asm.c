@@ -868,6 +868,38 @@
     #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+        uint32_t MPU_ulTaskGenericNotifyTakeUpTo( UBaseType_t uxIndexToWaitOn,
+                                                  uint32_t ulMaxCount,
+                                                  TickType_t xTicksToWait ) __attribute__( ( naked ) ) FREERTOS_SYSTEM_CALL;
+
+        uint32_t MPU_ulTaskGenericNotifyTakeUpTo( UBaseType_t uxIndexToWaitOn,
+                                                  uint32_t ulMaxCount,
+                                                  TickType_t xTicksToWait ) /* __attribute__ (( naked )) FREERTOS_SYSTEM_CALL */
+        {
+            __asm volatile
+            (
+                " .syntax unified                                       \n"
+                " .extern MPU_ulTaskGenericNotifyTakeUpToImpl           \n"
+                "                                                       \n"
+                " push {r0}                                             \n"
+                " mrs r0, control                                       \n"
+                " tst r0, #1                                            \n"
+                " pop {r0}                                              \n"
+                " bne MPU_ulTaskGenericNotifyTakeUpTo_Unpriv            \n"
+                " MPU_ulTaskGenericNotifyTakeUpTo_Priv:                 \n"
+                "     b MPU_ulTaskGenericNotifyTakeUpToImpl             \n"
+                " MPU_ulTaskGenericNotifyTakeUpTo_Unpriv:               \n"
+                "     svc %0                                            \n"
+                "                                                       \n"
+                : : "i" ( SYSTEM_CALL_ulTaskGenericNotifyTakeUpTo ) : "memory"
+            );
+        }
+
+    #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+/*-----------------------------------------------------------*/
+
     #if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
         BaseType_t MPU_xTaskGenericNotifyStateClear( TaskHandle_t xTask,
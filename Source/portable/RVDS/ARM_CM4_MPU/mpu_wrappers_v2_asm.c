@@ -725,6 +725,33 @@ MPU_ulTaskGenericNotifyTake_Unpriv
 
 #if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
+uint32_t MPU_ulTaskGenericNotifyTakeUpTo( UBaseType_t uxIndexToWaitOn,
+                                          uint32_t ulMaxCount,
+                                          TickType_t xTicksToWait ) FREERTOS_SYSTEM_CALL;
+
+__asm uint32_t MPU_ulTaskGenericNotifyTakeUpTo( UBaseType_t uxIndexToWaitOn,
+                                                uint32_t ulMaxCount,
+                                                TickType_t xTicksToWait ) /* FREERTOS_SYSTEM_CALL */
+{
+    PRESERVE8
+    extern MPU_ulTaskGenericNotifyTakeUpToImpl
+
+    push {r0}
+    mrs r0, control
+    tst r0, #1
+    pop {r0}
+    bne MPU_ulTaskGenericNotifyTakeUpTo_Unpriv
+MPU_ulTaskGenericNotifyTakeUpTo_Priv
+        b MPU_ulTaskGenericNotifyTakeUpToImpl
+MPU_ulTaskGenericNotifyTakeUpTo_Unpriv
+        svc #SYSTEM_CALL_ulTaskGenericNotifyTakeUpTo
+}
+
+#endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
 BaseType_t MPU_xTaskGenericNotifyStateClear( TaskHandle_t xTask,
                                              UBaseType_t uxIndexToClear ) FREERTOS_SYSTEM_CALL;
 
@@ -130,6 +130,11 @@ extern void vPortCancelThread( void * pxTaskToDelete );
 #define portTASK_FUNCTION( vFunction, pvParameters )               void vFunction( void * pvParameters )
 /*-----------------------------------------------------------*/
 
+#ifndef portFORCE_INLINE
+    #define portFORCE_INLINE    inline __attribute__( ( always_inline ) )
+#endif
+/*-----------------------------------------------------------*/
+
 /*
  * Tasks run in their own pthreads and context switches between them
  * are always a full memory barrier. ISRs are emulated as signals
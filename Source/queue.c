@@ -42,6 +42,10 @@
     #include "croutine.h"
 #endif
 
+#if ( configUSE_FAST_MUTEXES == 1 )
+    #include "atomic.h"
+#endif
+
 /* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
  * correct privileged Vs unprivileged linkage and placement. */
@@ -95,6 +99,104 @@ typedef struct SemaphoreData
     #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
 #endif
 
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+
+/* A task blocked in xQueueReceiveMultiple() or xQueueSendMultiple() can need
+ * more than one item or space, so when uxCount items or spaces become
+ * available the tasks unblocked are those whose needs can now be met, which
+ * are not necessarily the first in the event list. */
+    #define queueUNBLOCK_RECEIVERS( pxQueue, uxCount )    xTaskRemoveFromEventListForBatch( &( ( pxQueue )->xTasksWaitingToReceive ), ( pxQueue )->uxMessagesWaiting, ( uxCount ) )
+    #define queueUNBLOCK_SENDERS( pxQueue, uxCount )      xTaskRemoveFromEventListForBatch( &( ( pxQueue )->xTasksWaitingToSend ), ( UBaseType_t ) ( ( pxQueue )->uxLength - ( pxQueue )->uxMessagesWaiting ), ( uxCount ) )
+#else
+    #define queueUNBLOCK_RECEIVERS( pxQueue, uxCount )    xTaskRemoveFromEventList( &( ( pxQueue )->xTasksWaitingToReceive ) )
+    #define queueUNBLOCK_SENDERS( pxQueue, uxCount )      xTaskRemoveFromEventList( &( ( pxQueue )->xTasksWaitingToSend ) )
+#endif /* configUSE_QUEUE_BATCH_TRANSFER */
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+/* Bits used in the ucZeroCopyState member of a queue. */
+    #define queueSLOT_RESERVED    ( ( uint8_t ) 0x01U )
+    #define queueITEM_ACQUIRED    ( ( uint8_t ) 0x02U )
+
+/* While a slot is reserved it is the next place an item is written to the
+ * back of the queue, so the copying API cannot send to the back.  It can still
+ * send to the front if there is a free slot other than the reserved one.
+ * While an item is acquired it is still at the front of the queue, so the
+ * copying API must treat the queue as empty and must not write in front of
+ * it. */
+    #define queueCOPY_SEND_ALLOWED( pxQueue, xCopyPosition )                                                       \
+    ( ( ( xCopyPosition ) == queueSEND_TO_BACK ) ?                                                                 \
+      ( ( ( pxQueue )->ucZeroCopyState & queueSLOT_RESERVED ) == 0U ) :                                            \
+      ( ( ( ( pxQueue )->ucZeroCopyState & queueITEM_ACQUIRED ) == 0U ) &&                                         \
+        ( ( ( ( pxQueue )->ucZeroCopyState & queueSLOT_RESERVED ) == 0U ) ||                                       \
+          ( ( ( pxQueue )->uxMessagesWaiting + ( UBaseType_t ) 1U ) < ( pxQueue )->uxLength ) ) ) )
+
+/* Overwriting replaces the only item in a queue of length one, which is the
+ * slot an xQueueReserve() caller is writing to or the item an xQueueAcquire()
+ * caller is reading.  xQueueOverwrite() must always succeed, so it cannot be
+ * used on a queue that is also used with the zero-copy API. */
+    #define queueASSERT_OVERWRITE_ALLOWED( pxQueue, xCopyPosition ) \
+    configASSERT( !( ( ( xCopyPosition ) == queueOVERWRITE ) && ( ( pxQueue )->ucZeroCopyState != 0U ) ) )
+    #define queueCOPY_RECEIVE_ALLOWED( pxQueue )    ( ( ( pxQueue )->ucZeroCopyState & queueITEM_ACQUIRED ) == 0U )
+#else
+    #define queueCOPY_SEND_ALLOWED( pxQueue, xCopyPosition )           ( pdTRUE )
+    #define queueCOPY_RECEIVE_ALLOWED( pxQueue )                       ( pdTRUE )
+    #define queueASSERT_OVERWRITE_ALLOWED( pxQueue, xCopyPosition )
+#endif /* configUSE_QUEUE_ZERO_COPY */
+
+#if ( configUSE_QUEUE_SIZED_COPY == 1 )
+
+/* Values of the ucCopyClass member of a queue, chosen from the item size when
+ * the queue is created.  Items of 1, 2, 4 and 8 bytes are copied with a single
+ * fixed size load and store.  Anything larger is copied with memcpy(), which
+ * is at least as fast as a word by word loop for those sizes. */
+    #define queueCOPY_ANY_SIZE    ( ( uint8_t ) 0U )
+    #define queueCOPY_1_BYTE      ( ( uint8_t ) 1U )
+    #define queueCOPY_2_BYTES     ( ( uint8_t ) 2U )
+    #define queueCOPY_4_BYTES     ( ( uint8_t ) 3U )
+    #define queueCOPY_8_BYTES     ( ( uint8_t ) 4U )
+
+    #define queueCOPY_ITEM( pxQueue, pvDestination, pvSource )    prvCopyItem( ( pxQueue ), ( pvDestination ), ( pvSource ) )
+#else
+    #define queueCOPY_ITEM( pxQueue, pvDestination, pvSource )    ( void ) memcpy( ( void * ) ( pvDestination ), ( const void * ) ( pvSource ), ( size_t ) ( pxQueue )->uxItemSize )
+#endif /* configUSE_QUEUE_SIZED_COPY */
+
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+/* Each slot in the storage area of a priority queue starts with a
+ * PriorityQueueKey_t, which is queuePRIORITY_QUEUE_KEY_SIZE bytes, followed by
+ * the item itself.  uxItemSize is the size of the whole slot.  Slots are held
+ * as a binary heap, so the item with the highest priority is always in the
+ * first slot.  The sequence number keeps items of equal priority in the order
+ * they were sent. */
+    typedef struct PriorityQueueKey
+    {
+        UBaseType_t uxPriority;
+        UBaseType_t uxSequence;
+    } PriorityQueueKey_t;
+
+    #define queueIS_PRIORITY_QUEUE( pxQueue )                  ( ( pxQueue )->ucIsPriorityQueue != ( uint8_t ) pdFALSE )
+    #define queueGET_PRIORITY_QUEUE_SLOT( pxQueue, uxSlot )    ( &( ( pxQueue )->pcHead[ ( uxSlot ) * ( pxQueue )->uxItemSize ] ) )
+#else
+    #define queueIS_PRIORITY_QUEUE( pxQueue )                  ( pdFALSE )
+#endif /* configUSE_PRIORITY_QUEUES */
+
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+/* The xMutexHolder member of a fast mutex is taken and given with a
+ * compare-and-swap.  Task handles are aligned, so the bottom bit is used to
+ * mark the mutex as contended.  While the bit is set the holder's mutex held
+ * count includes the mutex, and the holder must give the mutex through the
+ * kernel so that any waiting task is unblocked and any inherited priority is
+ * disinherited. */
+    #define queueFAST_MUTEX_CONTENDED                     ( ( portPOINTER_SIZE_TYPE ) 1U )
+    #define queueFAST_MUTEX_HOLDER( xMutexHolder )        ( ( TaskHandle_t ) ( ( portPOINTER_SIZE_TYPE ) ( xMutexHolder ) & ~queueFAST_MUTEX_CONTENDED ) )
+    #define queueFAST_MUTEX_IS_CONTENDED( xMutexHolder )  ( ( ( portPOINTER_SIZE_TYPE ) ( xMutexHolder ) & queueFAST_MUTEX_CONTENDED ) != 0U )
+    #define queueFAST_MUTEX_MARK_CONTENDED( xTask )       ( ( TaskHandle_t ) ( ( portPOINTER_SIZE_TYPE ) ( xTask ) | queueFAST_MUTEX_CONTENDED ) )
+#else
+    #define queueFAST_MUTEX_HOLDER( xMutexHolder )        ( xMutexHolder )
+#endif /* configUSE_FAST_MUTEXES */
+
 /*
  * Definition of the queue used by the scheduler.
  * Items are queued by copy, not reference.  See the following link for the
@@ -133,6 +235,19 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         UBaseType_t uxQueueNumber;
         uint8_t ucQueueType;
     #endif
+
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        uint8_t ucZeroCopyState; /**< Records whether a slot is reserved by xQueueReserve() and whether an item is acquired by xQueueAcquire(). */
+    #endif
+
+    #if ( configUSE_QUEUE_SIZED_COPY == 1 )
+        uint8_t ucCopyClass; /**< Selects how items are copied into and out of the queue.  Set from the item size when the queue is created. */
+    #endif
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        uint8_t ucIsPriorityQueue; /**< Set to pdTRUE if the queue was created by xQueueCreatePriority(), in which case the storage area holds a binary heap. */
+        UBaseType_t uxNextSequence; /**< The sequence number given to the next item sent to a priority queue. */
+    #endif
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
@@ -190,11 +305,13 @@ static void prvUnlockQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
- * Uses a critical section to determine if there is any space in a queue.
+ * Uses a critical section to determine if there is any space in a queue for
+ * an item sent to xCopyPosition.
  *
  * @return pdTRUE if there is no space, otherwise pdFALSE;
  */
-static BaseType_t prvIsQueueFull( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
+static BaseType_t prvIsQueueFull( const Queue_t * pxQueue,
+                                  const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
 
 /*
  * Copies an item into the queue, either at the front of the queue or the
@@ -210,6 +327,98 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies the item at the front of a queue without removing it.
+ */
+static void prvPeekDataFromQueue( Queue_t * const pxQueue,
+                                  void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+/*
+ * Adds an item to, or removes the highest priority item from, the binary heap
+ * held in the storage area of a priority queue.  Must be called from a
+ * critical section, before uxMessagesWaiting is updated.
+ */
+    static void prvPushPriorityItem( Queue_t * const pxQueue,
+                                     const void * pvItemToQueue,
+                                     UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+    static void prvPopPriorityItem( Queue_t * const pxQueue,
+                                    void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies the key of the item in slot uxSlot of a priority queue into pxKey.
+ * The storage area of a statically allocated queue might not be aligned, so
+ * keys are never accessed in place.
+ */
+    static void prvGetPriorityKey( const Queue_t * const pxQueue,
+                                   UBaseType_t uxSlot,
+                                   PriorityQueueKey_t * const pxKey ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if an item with the key pxKey should be received before an
+ * item with the key pxOtherKey.
+ */
+    static BaseType_t prvIsBeforePriorityKey( const PriorityQueueKey_t * const pxKey,
+                                              const PriorityQueueKey_t * const pxOtherKey ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_PRIORITY_QUEUES */
+
+#if ( configUSE_QUEUE_SIZED_COPY == 1 )
+
+/*
+ * Chooses the ucCopyClass of a queue from its item size.
+ */
+    static uint8_t prvGetCopyClass( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies one item of the queue's item size using the method selected by the
+ * queue's ucCopyClass.
+ */
+    static void prvCopyItem( const Queue_t * const pxQueue,
+                             void * pvDestination,
+                             const void * pvSource ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_QUEUE_SIZED_COPY */
+
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+
+/*
+ * The number of items that can be sent to, or received from, a queue by the
+ * batch transfer functions at the time of the call.  Must be called from a
+ * critical section.
+ */
+    static UBaseType_t prvGetBatchSpaces( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
+    static UBaseType_t prvGetBatchItems( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies uxCount items to the back of a queue, or out of the front of a queue,
+ * using at most two memcpy() calls - one for the part of the batch that lies
+ * before the end of the queue storage area and one for the part that wraps
+ * back to its start.  Must be called from a critical section.
+ */
+    static void prvCopyMultipleToQueue( Queue_t * const pxQueue,
+                                        const void * pvItems,
+                                        const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+    static void prvCopyMultipleFromQueue( Queue_t * const pxQueue,
+                                          void * const pvBuffer,
+                                          const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks the tasks waiting to receive from, or send to, the queue that can
+ * use the items added to, or the spaces left by, a batch transfer.  A task is
+ * unblocked once, when the number of items or spaces it is waiting for is
+ * available.  If the queue is a member of a queue set then the queue set is
+ * notified once per item added instead.  Must be called from a critical
+ * section while the queue is not locked.
+ *
+ * @return pdTRUE if a task with a priority above the calling task was
+ * unblocked, otherwise pdFALSE.
+ */
+    static BaseType_t prvUnblockBatchReceivers( const Queue_t * const pxQueue,
+                                                const UBaseType_t uxItemsAdded ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvUnblockBatchSenders( const Queue_t * const pxQueue,
+                                              const UBaseType_t uxItemsRemoved ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_QUEUE_BATCH_TRANSFER */
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 /*
@@ -249,6 +458,18 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
  */
     static UBaseType_t prvGetHighestPriorityOfWaitToReceiveList( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
+
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+/*
+ * Called by xQueueTakeFastMutex() when the compare-and-swap fails because the
+ * mutex is held.  Marks the mutex as contended, applies priority inheritance
+ * and blocks in the same way as xQueueSemaphoreTake().
+ */
+    static BaseType_t prvTakeContendedFastMutex( Queue_t * const pxMutex,
+                                                 TaskHandle_t xCurrentTask,
+                                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
 /*-----------------------------------------------------------*/
 
 /*
@@ -324,6 +545,18 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             pxQueue->cRxLock = queueUNLOCKED;
             pxQueue->cTxLock = queueUNLOCKED;
 
+            #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+            {
+                pxQueue->ucZeroCopyState = ( uint8_t ) 0U;
+            }
+            #endif
+
+            #if ( configUSE_PRIORITY_QUEUES == 1 )
+            {
+                pxQueue->uxNextSequence = ( UBaseType_t ) 0U;
+            }
+            #endif
+
             if( xNewQueue == pdFALSE )
             {
                 /* If there are tasks blocked waiting to read from the queue, then
@@ -333,7 +566,7 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
                  * it will be possible to write to it. */
                 if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    if( queueUNBLOCK_SENDERS( pxQueue, 1U ) != pdFALSE )
                     {
                         queueYIELD_IF_USING_PREEMPTION();
                     }
@@ -596,6 +829,22 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
     pxNewQueue->uxItemSize = uxItemSize;
     ( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
 
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+    {
+        if( ucQueueType == queueQUEUE_TYPE_PRIORITY )
+        {
+            /* The item size passed in by xQueueCreatePriority() includes the
+             * key stored in front of each item. */
+            configASSERT( uxItemSize > queuePRIORITY_QUEUE_KEY_SIZE );
+            pxNewQueue->ucIsPriorityQueue = ( uint8_t ) pdTRUE;
+        }
+        else
+        {
+            pxNewQueue->ucIsPriorityQueue = ( uint8_t ) pdFALSE;
+        }
+    }
+    #endif /* configUSE_PRIORITY_QUEUES */
+
     #if ( configUSE_TRACE_FACILITY == 1 )
     {
         pxNewQueue->ucQueueType = ucQueueType;
@@ -608,6 +857,12 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
     }
     #endif /* configUSE_QUEUE_SETS */
 
+    #if ( configUSE_QUEUE_SIZED_COPY == 1 )
+    {
+        pxNewQueue->ucCopyClass = prvGetCopyClass( pxNewQueue );
+    }
+    #endif /* configUSE_QUEUE_SIZED_COPY */
+
     traceQUEUE_CREATE( pxNewQueue );
 }
 /*-----------------------------------------------------------*/
@@ -707,7 +962,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
         {
             if( pxSemaphore->uxQueueType == queueQUEUE_IS_MUTEX )
             {
-                pxReturn = pxSemaphore->u.xSemaphore.xMutexHolder;
+                pxReturn = queueFAST_MUTEX_HOLDER( pxSemaphore->u.xSemaphore.xMutexHolder );
             }
             else
             {
@@ -739,7 +994,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
          * not required here. */
         if( ( ( Queue_t * ) xSemaphore )->uxQueueType == queueQUEUE_IS_MUTEX )
         {
-            pxReturn = ( ( Queue_t * ) xSemaphore )->u.xSemaphore.xMutexHolder;
+            pxReturn = queueFAST_MUTEX_HOLDER( ( ( Queue_t * ) xSemaphore )->u.xSemaphore.xMutexHolder );
         }
         else
         {
@@ -867,6 +1122,289 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
 #endif /* configUSE_RECURSIVE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+    BaseType_t xQueueTakeFastMutex( QueueHandle_t xMutex,
+                                    TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn;
+        Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+        TaskHandle_t const xCurrentTask = xTaskGetCurrentTaskHandle();
+
+        traceENTER_xQueueTakeFastMutex( xMutex, xTicksToWait );
+
+        configASSERT( pxMutex );
+        configASSERT( pxMutex->uxQueueType == queueQUEUE_IS_MUTEX );
+
+        /* If the mutex is free it is taken by this single compare-and-swap.
+         * The mutex held count of the calling task is not incremented, as it
+         * can only be needed for priority disinheritance, which can only occur
+         * once another task has blocked on the mutex. */
+        if( Atomic_CompareAndSwapPointers_p32( ( void * volatile * ) &( pxMutex->u.xSemaphore.xMutexHolder ), ( void * ) xCurrentTask, NULL ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+        {
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = prvTakeContendedFastMutex( pxMutex, xCurrentTask, xTicksToWait );
+        }
+
+        traceRETURN_xQueueTakeFastMutex( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+    static BaseType_t prvTakeContendedFastMutex( Queue_t * const pxMutex,
+                                                 TaskHandle_t xCurrentTask,
+                                                 TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xInheritanceOccurred = pdFALSE;
+        BaseType_t xBlocked;
+        TimeOut_t xTimeOut;
+        TaskHandle_t xMutexHolder;
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            /* Within a critical section the mutex holder cannot be changed by
+             * the compare-and-swap in xQueueTakeFastMutex() or
+             * xQueueGiveFastMutex(), so it can be accessed directly. */
+            taskENTER_CRITICAL();
+            {
+                if( pxMutex->u.xSemaphore.xMutexHolder == NULL )
+                {
+                    /* The mutex was given.  If other tasks are still waiting
+                     * for it then take it marked as contended so the next give
+                     * unblocks one of them. */
+                    if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToReceive ) ) == pdFALSE )
+                    {
+                        pxMutex->u.xSemaphore.xMutexHolder = queueFAST_MUTEX_MARK_CONTENDED( pvTaskIncrementMutexHeldCount() );
+                    }
+                    else
+                    {
+                        pxMutex->u.xSemaphore.xMutexHolder = xCurrentTask;
+                    }
+
+                    taskEXIT_CRITICAL();
+
+                    return pdPASS;
+                }
+                else if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    xMutexHolder = pxMutex->u.xSemaphore.xMutexHolder;
+
+                    /* Either no block time was specified or the block time has
+                     * expired.  If this task caused the holder to inherit its
+                     * priority then the holder should now disinherit it again,
+                     * down to the priority of the highest priority task that is
+                     * still waiting.  The holder is only known to have
+                     * inherited if the mutex is still contended, as a holder
+                     * that took the mutex after this task blocked will not have
+                     * inherited this task's priority. */
+                    if( ( xInheritanceOccurred != pdFALSE ) &&
+                        ( queueFAST_MUTEX_IS_CONTENDED( xMutexHolder ) != pdFALSE ) )
+                    {
+                        vTaskPriorityDisinheritAfterTimeout( queueFAST_MUTEX_HOLDER( xMutexHolder ), prvGetHighestPriorityOfWaitToReceiveList( pxMutex ) );
+                    }
+                    else if( ( queueFAST_MUTEX_IS_CONTENDED( xMutexHolder ) == pdFALSE ) &&
+                             ( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToReceive ) ) == pdFALSE ) )
+                    {
+                        /* This task was unblocked by a give, but another task
+                         * took the mutex with the compare-and-swap before this
+                         * task ran, so the mutex is no longer marked as
+                         * contended.  Other tasks are still waiting, so mark it
+                         * again before giving up, otherwise the holder would
+                         * give it with the compare-and-swap and never unblock
+                         * them.  The holder then inherits the priority of the
+                         * highest priority task still waiting, as it would have
+                         * had those tasks blocked after it took the mutex. */
+                        vTaskIncrementMutexHeldCountOfHolder( xMutexHolder );
+                        pxMutex->u.xSemaphore.xMutexHolder = queueFAST_MUTEX_MARK_CONTENDED( xMutexHolder );
+                        vTaskPriorityDisinheritAfterTimeout( xMutexHolder, prvGetHighestPriorityOfWaitToReceiveList( pxMutex ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    taskEXIT_CRITICAL();
+
+                    traceQUEUE_RECEIVE_FAILED( pxMutex );
+
+                    return errQUEUE_EMPTY;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    /* The mutex is held and a block time was specified so
+                     * configure the timeout structure. */
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            vTaskSuspendAll();
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                xBlocked = pdFALSE;
+
+                taskENTER_CRITICAL();
+                {
+                    xMutexHolder = pxMutex->u.xSemaphore.xMutexHolder;
+
+                    if( xMutexHolder != NULL )
+                    {
+                        /* Mark the mutex as contended so the holder gives it
+                         * through the kernel, and count it as held by the
+                         * holder so it cannot disinherit a priority inherited
+                         * from this task while it still holds the mutex. */
+                        if( queueFAST_MUTEX_IS_CONTENDED( xMutexHolder ) == pdFALSE )
+                        {
+                            vTaskIncrementMutexHeldCountOfHolder( xMutexHolder );
+                            pxMutex->u.xSemaphore.xMutexHolder = queueFAST_MUTEX_MARK_CONTENDED( xMutexHolder );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        traceBLOCKING_ON_QUEUE_RECEIVE( pxMutex );
+
+                        if( xTaskPriorityInherit( queueFAST_MUTEX_HOLDER( xMutexHolder ) ) != pdFALSE )
+                        {
+                            xInheritanceOccurred = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        vTaskPlaceOnEventList( &( pxMutex->xTasksWaitingToReceive ), xTicksToWait );
+                        xBlocked = pdTRUE;
+                    }
+                    else
+                    {
+                        /* The mutex was given since it was last checked. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                if( ( xTaskResumeAll() == pdFALSE ) && ( xBlocked != pdFALSE ) )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* Timed out.  xTicksToWait is now zero, so the next iteration
+                 * makes a final attempt to take the mutex before returning. */
+                ( void ) xTaskResumeAll();
+            }
+        }
+    }
+
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+    BaseType_t xQueueGiveFastMutex( QueueHandle_t xMutex )
+    {
+        BaseType_t xReturn, xYieldRequired = pdFALSE;
+        Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+        TaskHandle_t const xCurrentTask = xTaskGetCurrentTaskHandle();
+
+        traceENTER_xQueueGiveFastMutex( xMutex );
+
+        configASSERT( pxMutex );
+        configASSERT( pxMutex->uxQueueType == queueQUEUE_IS_MUTEX );
+
+        /* If no task has blocked on the mutex since it was taken then it is
+         * given by this single compare-and-swap. */
+        if( Atomic_CompareAndSwapPointers_p32( ( void * volatile * ) &( pxMutex->u.xSemaphore.xMutexHolder ), NULL, ( void * ) xCurrentTask ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+        {
+            xReturn = pdPASS;
+        }
+        else
+        {
+            taskENTER_CRITICAL();
+            {
+                if( pxMutex->u.xSemaphore.xMutexHolder == queueFAST_MUTEX_MARK_CONTENDED( xCurrentTask ) )
+                {
+                    pxMutex->u.xSemaphore.xMutexHolder = NULL;
+
+                    /* The mutex was counted as held when it was marked as
+                     * contended, so this also disinherits any priority
+                     * inherited from the waiting tasks. */
+                    xYieldRequired = xTaskPriorityDisinherit( xCurrentTask );
+
+                    if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToReceive ) ) == pdFALSE )
+                    {
+                        if( xTaskRemoveFromEventList( &( pxMutex->xTasksWaitingToReceive ) ) != pdFALSE )
+                        {
+                            xYieldRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xReturn = pdPASS;
+                }
+                else
+                {
+                    /* The mutex cannot be given because the calling task is
+                     * not the holder. */
+                    xReturn = pdFAIL;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xYieldRequired != pdFALSE )
+            {
+                queueYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_xQueueGiveFastMutex( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
     QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount,
@@ -960,6 +1498,10 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
     configASSERT( pxQueue );
     configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
     configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+
+    /* An item priority above queueMAX_ITEM_PRIORITY. */
+    configASSERT( xCopyPosition != queueSEND_WITH_INVALID_PRIORITY );
+
     #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
     {
         configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
@@ -970,11 +1512,14 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
     {
         taskENTER_CRITICAL();
         {
+            queueASSERT_OVERWRITE_ALLOWED( pxQueue, xCopyPosition );
+
             /* Is there room on the queue now?  The running task must be the
              * highest priority task wanting to access the queue.  If the head item
              * in the queue is to be overwritten then it does not matter if the
              * queue is full. */
-            if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+            if( ( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) ) &&
+                ( queueCOPY_SEND_ALLOWED( pxQueue, xCopyPosition ) != pdFALSE ) )
             {
                 traceQUEUE_SEND( pxQueue );
 
@@ -1011,7 +1556,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                          * queue then unblock it now. */
                         if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                         {
-                            if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                            if( queueUNBLOCK_RECEIVERS( pxQueue, 1U ) != pdFALSE )
                             {
                                 /* The unblocked task has a priority higher than
                                  * our own so yield immediately.  Yes it is ok to
@@ -1046,7 +1591,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                      * queue then unblock it now. */
                     if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                     {
-                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                        if( queueUNBLOCK_RECEIVERS( pxQueue, 1U ) != pdFALSE )
                         {
                             /* The unblocked task has a priority higher than
                              * our own so yield immediately.  Yes it is ok to do
@@ -1120,7 +1665,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
         /* Update the timeout state to see if it has expired yet. */
         if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
         {
-            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            if( prvIsQueueFull( pxQueue, xCopyPosition ) != pdFALSE )
             {
                 traceBLOCKING_ON_QUEUE_SEND( pxQueue );
                 vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
@@ -1179,6 +1724,9 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
     configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
     configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
 
+    /* An item priority above queueMAX_ITEM_PRIORITY. */
+    configASSERT( xCopyPosition != queueSEND_WITH_INVALID_PRIORITY );
+
     /* RTOS ports that support interrupt nesting have the concept of a maximum
      * system call (or maximum API call) interrupt priority.  Interrupts that are
      * above the maximum system call priority are kept permanently enabled, even
@@ -1205,7 +1753,10 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
     /* coverity[misra_c_2012_directive_4_7_violation] */
     uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
     {
-        if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+        queueASSERT_OVERWRITE_ALLOWED( pxQueue, xCopyPosition );
+
+        if( ( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) ) &&
+            ( queueCOPY_SEND_ALLOWED( pxQueue, xCopyPosition ) != pdFALSE ) )
         {
             const int8_t cTxLock = pxQueue->cTxLock;
             const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
@@ -1257,7 +1808,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                     {
                         if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                         {
-                            if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                            if( queueUNBLOCK_RECEIVERS( pxQueue, 1U ) != pdFALSE )
                             {
                                 /* The task waiting has a higher priority so
                                  *  record that a context switch is required. */
@@ -1285,7 +1836,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                 {
                     if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                     {
-                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                        if( queueUNBLOCK_RECEIVERS( pxQueue, 1U ) != pdFALSE )
                         {
                             /* The task waiting has a higher priority so record that a
                              * context switch is required. */
@@ -1541,7 +2092,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
 
             /* Is there data in the queue now?  To be running the calling task
              * must be the highest priority task wanting to access the queue. */
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            if( ( uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( queueCOPY_RECEIVE_ALLOWED( pxQueue ) != pdFALSE ) )
             {
                 /* Data available, remove one item. */
                 prvCopyDataFromQueue( pxQueue, pvBuffer );
@@ -1553,7 +2104,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                  * task. */
                 if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    if( queueUNBLOCK_SENDERS( pxQueue, 1U ) != pdFALSE )
                     {
                         queueYIELD_IF_USING_PREEMPTION();
                     }
@@ -1890,7 +2441,6 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
 {
     BaseType_t xEntryTimeSet = pdFALSE;
     TimeOut_t xTimeOut;
-    int8_t * pcOriginalReadPosition;
     Queue_t * const pxQueue = xQueue;
 
     traceENTER_xQueuePeek( xQueue, pvBuffer, xTicksToWait );
@@ -1917,24 +2467,16 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
 
             /* Is there data in the queue now?  To be running the calling task
              * must be the highest priority task wanting to access the queue. */
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            if( ( uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( queueCOPY_RECEIVE_ALLOWED( pxQueue ) != pdFALSE ) )
             {
-                /* Remember the read position so it can be reset after the data
-                 * is read from the queue as this function is only peeking the
-                 * data, not removing it. */
-                pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-
-                prvCopyDataFromQueue( pxQueue, pvBuffer );
+                prvPeekDataFromQueue( pxQueue, pvBuffer );
                 traceQUEUE_PEEK( pxQueue );
 
-                /* The data is not being removed, so reset the read pointer. */
-                pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
-
                 /* The data is being left in the queue, so see if there are
                  * any other tasks waiting for the data. */
                 if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    if( queueUNBLOCK_RECEIVERS( pxQueue, 1U ) != pdFALSE )
                     {
                         /* The task waiting has a higher priority than this task. */
                         queueYIELD_IF_USING_PREEMPTION();
@@ -2079,7 +2621,7 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
         const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
         /* Cannot block in an ISR, so check there is data available. */
-        if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+        if( ( uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( queueCOPY_RECEIVE_ALLOWED( pxQueue ) != pdFALSE ) )
         {
             const int8_t cRxLock = pxQueue->cRxLock;
 
@@ -2096,7 +2638,7 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
             {
                 if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    if( queueUNBLOCK_SENDERS( pxQueue, 1U ) != pdFALSE )
                     {
                         /* The task waiting has a higher priority than us so
                          * force a context switch. */
@@ -2147,61 +2689,927 @@ BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
 {
     BaseType_t xReturn;
     UBaseType_t uxSavedInterruptStatus;
-    int8_t * pcOriginalReadPosition;
     Queue_t * const pxQueue = xQueue;
 
-    traceENTER_xQueuePeekFromISR( xQueue, pvBuffer );
+    traceENTER_xQueuePeekFromISR( xQueue, pvBuffer );
+
+    configASSERT( pxQueue );
+    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+    configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+
+    /* RTOS ports that support interrupt nesting have the concept of a maximum
+     * system call (or maximum API call) interrupt priority.  Interrupts that are
+     * above the maximum system call priority are kept permanently enabled, even
+     * when the RTOS kernel is in a critical section, but cannot make any calls to
+     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+     * failure if a FreeRTOS API function is called from an interrupt that has been
+     * assigned a priority above the configured maximum system call priority.
+     * Only FreeRTOS functions that end in FromISR can be called from interrupts
+     * that have been assigned a priority at or (logically) below the maximum
+     * system call interrupt priority.  FreeRTOS maintains a separate interrupt
+     * safe API to ensure interrupt entry is as fast and as simple as possible.
+     * More information (albeit Cortex-M specific) is provided on the following
+     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+    {
+        /* Cannot block in an ISR, so check there is data available. */
+        if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( queueCOPY_RECEIVE_ALLOWED( pxQueue ) != pdFALSE ) )
+        {
+            traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+            prvPeekDataFromQueue( pxQueue, pvBuffer );
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+            traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+        }
+    }
+    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+    traceRETURN_xQueuePeekFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    BaseType_t xQueueReserve( QueueHandle_t xQueue,
+                              void ** ppvSlot,
+                              TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueReserve( xQueue, ppvSlot, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( ppvSlot );
+
+        /* Only queues that hold data have slots to reserve. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        /* Priority queues hold their items in a binary heap. */
+        configASSERT( queueIS_PRIORITY_QUEUE( pxQueue ) == pdFALSE );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* Is there a free slot that is not already reserved? */
+                if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) &&
+                    ( ( pxQueue->ucZeroCopyState & queueSLOT_RESERVED ) == 0U ) )
+                {
+                    /* The next item is always written to pcWriteTo, and no other
+                     * writer can move pcWriteTo until the slot is committed. */
+                    pxQueue->ucZeroCopyState |= queueSLOT_RESERVED;
+                    *ppvSlot = ( void * ) pxQueue->pcWriteTo;
+
+                    taskEXIT_CRITICAL();
+
+                    traceRETURN_xQueueReserve( pdPASS );
+
+                    return pdPASS;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        taskEXIT_CRITICAL();
+
+                        traceQUEUE_SEND_FAILED( pxQueue );
+                        traceRETURN_xQueueReserve( errQUEUE_FULL );
+
+                        return errQUEUE_FULL;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* The timeout has expired. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                traceQUEUE_SEND_FAILED( pxQueue );
+                traceRETURN_xQueueReserve( errQUEUE_FULL );
+
+                return errQUEUE_FULL;
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueCommit( QueueHandle_t xQueue )
+    {
+        BaseType_t xReturn = pdFAIL;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueCommit( xQueue );
+
+        configASSERT( pxQueue );
+
+        taskENTER_CRITICAL();
+        {
+            configASSERT( ( pxQueue->ucZeroCopyState & queueSLOT_RESERVED ) != 0U );
+
+            if( ( pxQueue->ucZeroCopyState & queueSLOT_RESERVED ) != 0U )
+            {
+                traceQUEUE_SEND( pxQueue );
+
+                /* The item is already in place, so only the write position and
+                 * the item count need updating, as prvCopyDataToQueue() would
+                 * for an item sent to the back of the queue. */
+                pxQueue->pcWriteTo += pxQueue->uxItemSize;
+
+                if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+                {
+                    pxQueue->pcWriteTo = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting + ( UBaseType_t ) 1 );
+                pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueSLOT_RESERVED;
+                xReturn = pdPASS;
+
+                /* Unblock a reader exactly as xQueueGenericSend() does. */
+                #if ( configUSE_QUEUE_SETS == 1 )
+                    if( pxQueue->pxQueueSetContainer != NULL )
+                    {
+                        if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                #endif /* configUSE_QUEUE_SETS */
+                {
+                    if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                    {
+                        if( queueUNBLOCK_RECEIVERS( pxQueue, 1U ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                /* Writers that found the slot reserved were told the queue was
+                 * full, so unblock one if there is still space. */
+                if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) &&
+                    ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE ) )
+                {
+                    if( queueUNBLOCK_SENDERS( pxQueue, 1U ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xQueueCommit( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueAcquire( QueueHandle_t xQueue,
+                              void ** ppvItem,
+                              TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        int8_t * pcItem;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueAcquire( xQueue, ppvItem, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( ppvItem );
+
+        /* Only queues that hold data have items to acquire. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        configASSERT( queueIS_PRIORITY_QUEUE( pxQueue ) == pdFALSE );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) &&
+                    ( ( pxQueue->ucZeroCopyState & queueITEM_ACQUIRED ) == 0U ) )
+                {
+                    /* The item at the front of the queue is the one after the
+                     * last read position.  The read position itself is only
+                     * moved when the item is released. */
+                    pcItem = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize;
+
+                    if( pcItem >= pxQueue->u.xQueue.pcTail )
+                    {
+                        pcItem = pxQueue->pcHead;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxQueue->ucZeroCopyState |= queueITEM_ACQUIRED;
+                    *ppvItem = ( void * ) pcItem;
+
+                    taskEXIT_CRITICAL();
+
+                    traceRETURN_xQueueAcquire( pdPASS );
+
+                    return pdPASS;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        taskEXIT_CRITICAL();
+
+                        traceQUEUE_RECEIVE_FAILED( pxQueue );
+                        traceRETURN_xQueueAcquire( errQUEUE_EMPTY );
+
+                        return errQUEUE_EMPTY;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* The timeout has expired. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                traceQUEUE_RECEIVE_FAILED( pxQueue );
+                traceRETURN_xQueueAcquire( errQUEUE_EMPTY );
+
+                return errQUEUE_EMPTY;
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueRelease( QueueHandle_t xQueue )
+    {
+        BaseType_t xReturn = pdFAIL;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueRelease( xQueue );
+
+        configASSERT( pxQueue );
+
+        taskENTER_CRITICAL();
+        {
+            configASSERT( ( pxQueue->ucZeroCopyState & queueITEM_ACQUIRED ) != 0U );
+
+            if( ( pxQueue->ucZeroCopyState & queueITEM_ACQUIRED ) != 0U )
+            {
+                traceQUEUE_RECEIVE( pxQueue );
+
+                /* Remove the item as prvCopyDataFromQueue() would, without
+                 * copying it. */
+                pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+
+                if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+                {
+                    pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1 );
+                pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueITEM_ACQUIRED;
+                xReturn = pdPASS;
+
+                /* There is now space in the queue, so unblock a writer exactly
+                 * as xQueueReceive() does. */
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( queueUNBLOCK_SENDERS( pxQueue, 1U ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Readers that found the item acquired were told the queue was
+                 * empty, so unblock one if there are still items. */
+                if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) &&
+                    ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) )
+                {
+                    if( queueUNBLOCK_RECEIVERS( pxQueue, 1U ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xQueueRelease( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+
+    UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue,
+                                    const void * pvItems,
+                                    UBaseType_t uxMinItems,
+                                    UBaseType_t uxMaxItems,
+                                    TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xEnoughSpace;
+        UBaseType_t uxCount;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueSendMultiple( xQueue, pvItems, uxMinItems, uxMaxItems, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( !( ( pvItems == NULL ) && ( uxMaxItems != ( UBaseType_t ) 0U ) ) );
+
+        /* Semaphores and mutexes hold no data so cannot be used here. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        configASSERT( queueIS_PRIORITY_QUEUE( pxQueue ) == pdFALSE );
+
+        /* A task waiting for more space than the queue has would never be
+         * unblocked. */
+        configASSERT( uxMinItems <= uxMaxItems );
+        configASSERT( uxMinItems <= pxQueue->uxLength );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                uxCount = prvGetBatchSpaces( pxQueue );
+
+                /* Send now if there is enough space, or if the block time is
+                 * zero or has expired, in which case send whatever fits.
+                 * xTaskCheckForTimeOut() sets xTicksToWait to zero on
+                 * timeout. */
+                if( ( uxCount >= uxMinItems ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+                {
+                    if( uxCount > uxMaxItems )
+                    {
+                        uxCount = uxMaxItems;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( uxCount > ( UBaseType_t ) 0 )
+                    {
+                        traceQUEUE_SEND( pxQueue );
+                        prvCopyMultipleToQueue( pxQueue, pvItems, uxCount );
+
+                        if( prvUnblockBatchReceivers( pxQueue, uxCount ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else if( uxMaxItems > ( UBaseType_t ) 0 )
+                    {
+                        traceQUEUE_SEND_FAILED( pxQueue );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    taskEXIT_CRITICAL();
+
+                    traceRETURN_xQueueSendMultiple( uxCount );
 
-    configASSERT( pxQueue );
-    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-    configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+                    return uxCount;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
 
-    /* RTOS ports that support interrupt nesting have the concept of a maximum
-     * system call (or maximum API call) interrupt priority.  Interrupts that are
-     * above the maximum system call priority are kept permanently enabled, even
-     * when the RTOS kernel is in a critical section, but cannot make any calls to
-     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-     * failure if a FreeRTOS API function is called from an interrupt that has been
-     * assigned a priority above the configured maximum system call priority.
-     * Only FreeRTOS functions that end in FromISR can be called from interrupts
-     * that have been assigned a priority at or (logically) below the maximum
-     * system call interrupt priority.  FreeRTOS maintains a separate interrupt
-     * safe API to ensure interrupt entry is as fast and as simple as possible.
-     * More information (albeit Cortex-M specific) is provided on the following
-     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
 
-    /* MISRA Ref 4.7.1 [Return value shall be checked] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-    /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                taskENTER_CRITICAL();
+                {
+                    xEnoughSpace = ( prvGetBatchSpaces( pxQueue ) >= uxMinItems ) ? pdTRUE : pdFALSE;
+                }
+                taskEXIT_CRITICAL();
+
+                if( xEnoughSpace == pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventListForBatch( &( pxQueue->xTasksWaitingToSend ), uxMinItems, xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* The timeout has expired - go round the loop once more to
+                 * send whatever fits now. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue,
+                                           const void * pvItems,
+                                           UBaseType_t uxMaxItems,
+                                           BaseType_t * const pxHigherPriorityTaskWoken )
     {
-        /* Cannot block in an ISR, so check there is data available. */
-        if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+        UBaseType_t uxCount;
+        UBaseType_t uxItem;
+        UBaseType_t uxSavedInterruptStatus;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueSendMultipleFromISR( xQueue, pvItems, uxMaxItems, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxQueue );
+        configASSERT( !( ( pvItems == NULL ) && ( uxMaxItems != ( UBaseType_t ) 0U ) ) );
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        configASSERT( queueIS_PRIORITY_QUEUE( pxQueue ) == pdFALSE );
+
+        /* See the comments in xQueueGenericSendFromISR(). */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
         {
-            traceQUEUE_PEEK_FROM_ISR( pxQueue );
+            uxCount = prvGetBatchSpaces( pxQueue );
 
-            /* Remember the read position so it can be reset as nothing is
-             * actually being removed from the queue. */
-            pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-            prvCopyDataFromQueue( pxQueue, pvBuffer );
-            pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+            if( uxCount > uxMaxItems )
+            {
+                uxCount = uxMaxItems;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-            xReturn = pdPASS;
+            if( uxCount > ( UBaseType_t ) 0 )
+            {
+                traceQUEUE_SEND_FROM_ISR( pxQueue );
+                prvCopyMultipleToQueue( pxQueue, pvItems, uxCount );
+
+                /* The event list is not altered if the queue is locked.  This
+                 * will be done when the queue is unlocked later, once for each
+                 * increment of the lock count. */
+                if( pxQueue->cTxLock == queueUNLOCKED )
+                {
+                    if( prvUnblockBatchReceivers( pxQueue, uxCount ) != pdFALSE )
+                    {
+                        if( pxHigherPriorityTaskWoken != NULL )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    for( uxItem = 0; uxItem < uxCount; uxItem++ )
+                    {
+                        const int8_t cTxLock = pxQueue->cTxLock;
+
+                        prvIncrementQueueTxLock( pxQueue, cTxLock );
+                    }
+                }
+            }
+            else
+            {
+                traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+            }
         }
-        else
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_xQueueSendMultipleFromISR( uxCount );
+
+        return uxCount;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue,
+                                       void * pvBuffer,
+                                       UBaseType_t uxMinItems,
+                                       UBaseType_t uxMaxItems,
+                                       TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xEnoughItems;
+        UBaseType_t uxCount;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueReceiveMultiple( xQueue, pvBuffer, uxMinItems, uxMaxItems, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( !( ( pvBuffer == NULL ) && ( uxMaxItems != ( UBaseType_t ) 0U ) ) );
+
+        /* Semaphores and mutexes hold no data so cannot be used here. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        configASSERT( queueIS_PRIORITY_QUEUE( pxQueue ) == pdFALSE );
+
+        /* A task waiting for more items than the queue can hold would never be
+         * unblocked. */
+        configASSERT( uxMinItems <= uxMaxItems );
+        configASSERT( uxMinItems <= pxQueue->uxLength );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
         {
-            xReturn = pdFAIL;
-            traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                uxCount = prvGetBatchItems( pxQueue );
+
+                /* Receive now if there are enough items, or if the block time
+                 * is zero or has expired, in which case receive whatever is
+                 * there. */
+                if( ( uxCount >= uxMinItems ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+                {
+                    if( uxCount > uxMaxItems )
+                    {
+                        uxCount = uxMaxItems;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( uxCount > ( UBaseType_t ) 0 )
+                    {
+                        prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxCount );
+                        traceQUEUE_RECEIVE( pxQueue );
+                        pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - uxCount );
+
+                        if( prvUnblockBatchSenders( pxQueue, uxCount ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else if( uxMaxItems > ( UBaseType_t ) 0 )
+                    {
+                        traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    taskEXIT_CRITICAL();
+
+                    traceRETURN_xQueueReceiveMultiple( uxCount );
+
+                    return uxCount;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                taskENTER_CRITICAL();
+                {
+                    xEnoughItems = ( prvGetBatchItems( pxQueue ) >= uxMinItems ) ? pdTRUE : pdFALSE;
+                }
+                taskEXIT_CRITICAL();
+
+                if( xEnoughItems == pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    vTaskPlaceOnEventListForBatch( &( pxQueue->xTasksWaitingToReceive ), uxMinItems, xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* The timeout has expired - go round the loop once more to
+                 * receive whatever is there now. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
         }
     }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+/*-----------------------------------------------------------*/
 
-    traceRETURN_xQueuePeekFromISR( xReturn );
+    UBaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue,
+                                              void * pvBuffer,
+                                              UBaseType_t uxMaxItems,
+                                              BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxCount;
+        UBaseType_t uxItem;
+        UBaseType_t uxSavedInterruptStatus;
+        Queue_t * const pxQueue = xQueue;
 
-    return xReturn;
-}
+        traceENTER_xQueueReceiveMultipleFromISR( xQueue, pvBuffer, uxMaxItems, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxQueue );
+        configASSERT( !( ( pvBuffer == NULL ) && ( uxMaxItems != ( UBaseType_t ) 0U ) ) );
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        configASSERT( queueIS_PRIORITY_QUEUE( pxQueue ) == pdFALSE );
+
+        /* See the comments in xQueueGenericSendFromISR(). */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            uxCount = prvGetBatchItems( pxQueue );
+
+            if( uxCount > uxMaxItems )
+            {
+                uxCount = uxMaxItems;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( uxCount > ( UBaseType_t ) 0 )
+            {
+                traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+                prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxCount );
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - uxCount );
+
+                /* If the queue is locked the event list will not be modified.
+                 * Instead update the lock count so the task that unlocks the
+                 * queue will know that ISRs have removed data while the queue
+                 * was locked. */
+                if( pxQueue->cRxLock == queueUNLOCKED )
+                {
+                    if( prvUnblockBatchSenders( pxQueue, uxCount ) != pdFALSE )
+                    {
+                        if( pxHigherPriorityTaskWoken != NULL )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    for( uxItem = 0; uxItem < uxCount; uxItem++ )
+                    {
+                        const int8_t cRxLock = pxQueue->cRxLock;
+
+                        prvIncrementQueueRxLock( pxQueue, cRxLock );
+                    }
+                }
+            }
+            else
+            {
+                traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_xQueueReceiveMultipleFromISR( uxCount );
+
+        return uxCount;
+    }
+
+#endif /* configUSE_QUEUE_BATCH_TRANSFER */
 /*-----------------------------------------------------------*/
 
 UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
@@ -2352,11 +3760,29 @@ void vQueueDelete( QueueHandle_t xQueue )
 
 UBaseType_t uxQueueGetQueueItemSize( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION */
 {
+    UBaseType_t uxReturn;
+
     traceENTER_uxQueueGetQueueItemSize( xQueue );
 
-    traceRETURN_uxQueueGetQueueItemSize( ( ( Queue_t * ) xQueue )->uxItemSize );
+    uxReturn = ( ( Queue_t * ) xQueue )->uxItemSize;
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+    {
+        /* Do not include the key stored in front of each item. */
+        if( queueIS_PRIORITY_QUEUE( ( Queue_t * ) xQueue ) != pdFALSE )
+        {
+            uxReturn -= queuePRIORITY_QUEUE_KEY_SIZE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_PRIORITY_QUEUES */
+
+    traceRETURN_uxQueueGetQueueItemSize( uxReturn );
 
-    return ( ( Queue_t * ) xQueue )->uxItemSize;
+    return uxReturn;
 }
 /*-----------------------------------------------------------*/
 
@@ -2425,9 +3851,26 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
         }
         #endif /* configUSE_MUTEXES */
     }
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        else if( queueIS_PRIORITY_QUEUE( pxQueue ) != pdFALSE )
+        {
+            /* Items are ordered by priority, so cannot be sent to the front of
+             * a priority queue.  xQueueSend() sends at the lowest priority. */
+            configASSERT( ( xPosition == queueSEND_TO_BACK ) || ( xPosition >= queueSEND_WITH_PRIORITY( 0 ) ) );
+
+            if( xPosition == queueSEND_TO_BACK )
+            {
+                prvPushPriorityItem( pxQueue, pvItemToQueue, ( UBaseType_t ) 0U );
+            }
+            else
+            {
+                prvPushPriorityItem( pxQueue, pvItemToQueue, ( UBaseType_t ) ( xPosition - queueSEND_WITH_PRIORITY( 0 ) ) );
+            }
+        }
+    #endif /* configUSE_PRIORITY_QUEUES */
     else if( xPosition == queueSEND_TO_BACK )
     {
-        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+        queueCOPY_ITEM( pxQueue, pxQueue->pcWriteTo, pvItemToQueue );
         pxQueue->pcWriteTo += pxQueue->uxItemSize;
 
         if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
@@ -2441,7 +3884,10 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
     }
     else
     {
-        ( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+        /* Only priority queues can be sent to with a priority. */
+        configASSERT( ( xPosition >= queueSEND_TO_BACK ) && ( xPosition < queueSEND_WITH_PRIORITY( 0 ) ) );
+
+        queueCOPY_ITEM( pxQueue, pxQueue->u.xQueue.pcReadFrom, pvItemToQueue );
         pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
 
         if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead )
@@ -2483,6 +3929,13 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer )
 {
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        if( queueIS_PRIORITY_QUEUE( pxQueue ) != pdFALSE )
+        {
+            prvPopPriorityItem( pxQueue, pvBuffer );
+        }
+        else
+    #endif /* configUSE_PRIORITY_QUEUES */
     if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
     {
         pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
@@ -2496,11 +3949,403 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
             mtCOVERAGE_TEST_MARKER();
         }
 
-        ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize );
+        queueCOPY_ITEM( pxQueue, pvBuffer, pxQueue->u.xQueue.pcReadFrom );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvPeekDataFromQueue( Queue_t * const pxQueue,
+                                  void * const pvBuffer )
+{
+    int8_t * pcOriginalReadPosition;
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        if( queueIS_PRIORITY_QUEUE( pxQueue ) != pdFALSE )
+        {
+            /* The highest priority item is always in the first slot. */
+            ( void ) memcpy( pvBuffer, ( void * ) &( pxQueue->pcHead[ queuePRIORITY_QUEUE_KEY_SIZE ] ), ( size_t ) ( pxQueue->uxItemSize - queuePRIORITY_QUEUE_KEY_SIZE ) );
+        }
+        else
+    #endif /* configUSE_PRIORITY_QUEUES */
+    {
+        /* Remember the read position so it can be reset after the data is
+         * read from the queue as the data is only being peeked, not
+         * removed. */
+        pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
+        prvCopyDataFromQueue( pxQueue, pvBuffer );
+        pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
     }
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+    static void prvPushPriorityItem( Queue_t * const pxQueue,
+                                     const void * pvItemToQueue,
+                                     UBaseType_t uxPriority )
+    {
+        PriorityQueueKey_t xKey, xParentKey;
+        UBaseType_t uxHole, uxParent;
+        int8_t * pcHole;
+
+        xKey.uxPriority = uxPriority;
+        xKey.uxSequence = pxQueue->uxNextSequence;
+        pxQueue->uxNextSequence++;
+
+        /* Start with a hole at the end of the heap and move it towards the
+         * first slot until its parent holds an item that should be received
+         * first, moving each parent passed over down into the hole. */
+        uxHole = pxQueue->uxMessagesWaiting;
+
+        while( uxHole > ( UBaseType_t ) 0U )
+        {
+            uxParent = ( uxHole - ( UBaseType_t ) 1U ) / ( UBaseType_t ) 2U;
+            prvGetPriorityKey( pxQueue, uxParent, &xParentKey );
+
+            if( prvIsBeforePriorityKey( &xParentKey, &xKey ) != pdFALSE )
+            {
+                break;
+            }
+
+            ( void ) memcpy( ( void * ) queueGET_PRIORITY_QUEUE_SLOT( pxQueue, uxHole ), ( void * ) queueGET_PRIORITY_QUEUE_SLOT( pxQueue, uxParent ), ( size_t ) pxQueue->uxItemSize );
+            uxHole = uxParent;
+        }
+
+        pcHole = queueGET_PRIORITY_QUEUE_SLOT( pxQueue, uxHole );
+        ( void ) memcpy( ( void * ) pcHole, ( void * ) &xKey, sizeof( xKey ) );
+        ( void ) memcpy( ( void * ) &( pcHole[ queuePRIORITY_QUEUE_KEY_SIZE ] ), pvItemToQueue, ( size_t ) ( pxQueue->uxItemSize - queuePRIORITY_QUEUE_KEY_SIZE ) );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvPopPriorityItem( Queue_t * const pxQueue,
+                                    void * const pvBuffer )
+    {
+        PriorityQueueKey_t xLastKey, xChildKey, xSiblingKey;
+        UBaseType_t uxHole, uxChild, uxLast;
+
+        ( void ) memcpy( pvBuffer, ( void * ) &( pxQueue->pcHead[ queuePRIORITY_QUEUE_KEY_SIZE ] ), ( size_t ) ( pxQueue->uxItemSize - queuePRIORITY_QUEUE_KEY_SIZE ) );
+
+        /* The last slot of the heap has to be placed again.  Move the hole
+         * left in the first slot away from it, moving the child that should be
+         * received first up into the hole each time, until the last item
+         * should be received before both children of the hole.  The last slot
+         * is outside the smaller heap, so is never overwritten before it is
+         * copied. */
+        uxLast = pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1U;
+        prvGetPriorityKey( pxQueue, uxLast, &xLastKey );
+        uxHole = ( UBaseType_t ) 0U;
+
+        for( ; ; )
+        {
+            uxChild = ( uxHole * ( UBaseType_t ) 2U ) + ( UBaseType_t ) 1U;
+
+            if( uxChild >= uxLast )
+            {
+                break;
+            }
+
+            prvGetPriorityKey( pxQueue, uxChild, &xChildKey );
+
+            if( ( uxChild + ( UBaseType_t ) 1U ) < uxLast )
+            {
+                prvGetPriorityKey( pxQueue, uxChild + ( UBaseType_t ) 1U, &xSiblingKey );
+
+                if( prvIsBeforePriorityKey( &xSiblingKey, &xChildKey ) != pdFALSE )
+                {
+                    uxChild++;
+                    xChildKey = xSiblingKey;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( prvIsBeforePriorityKey( &xChildKey, &xLastKey ) == pdFALSE )
+            {
+                break;
+            }
+
+            ( void ) memcpy( ( void * ) queueGET_PRIORITY_QUEUE_SLOT( pxQueue, uxHole ), ( void * ) queueGET_PRIORITY_QUEUE_SLOT( pxQueue, uxChild ), ( size_t ) pxQueue->uxItemSize );
+            uxHole = uxChild;
+        }
+
+        if( uxHole != uxLast )
+        {
+            ( void ) memcpy( ( void * ) queueGET_PRIORITY_QUEUE_SLOT( pxQueue, uxHole ), ( void * ) queueGET_PRIORITY_QUEUE_SLOT( pxQueue, uxLast ), ( size_t ) pxQueue->uxItemSize );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvGetPriorityKey( const Queue_t * const pxQueue,
+                                   UBaseType_t uxSlot,
+                                   PriorityQueueKey_t * const pxKey )
+    {
+        ( void ) memcpy( ( void * ) pxKey, ( void * ) queueGET_PRIORITY_QUEUE_SLOT( pxQueue, uxSlot ), sizeof( PriorityQueueKey_t ) );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvIsBeforePriorityKey( const PriorityQueueKey_t * const pxKey,
+                                              const PriorityQueueKey_t * const pxOtherKey )
+    {
+        BaseType_t xReturn;
+
+        if( pxKey->uxPriority != pxOtherKey->uxPriority )
+        {
+            xReturn = ( pxKey->uxPriority > pxOtherKey->uxPriority ) ? pdTRUE : pdFALSE;
+        }
+        else
+        {
+            /* There are never more than uxLength items in the queue, so the
+             * older of two items with equal priority is found correctly even
+             * after the sequence number wraps. */
+            xReturn = ( ( BaseType_t ) ( pxKey->uxSequence - pxOtherKey->uxSequence ) < 0 ) ? pdTRUE : pdFALSE;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_PRIORITY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_SIZED_COPY == 1 )
+
+    static uint8_t prvGetCopyClass( const Queue_t * const pxQueue )
+    {
+        uint8_t ucReturn;
+
+        switch( pxQueue->uxItemSize )
+        {
+            case 1U:
+                ucReturn = queueCOPY_1_BYTE;
+                break;
+
+            case 2U:
+                ucReturn = queueCOPY_2_BYTES;
+                break;
+
+            case 4U:
+                ucReturn = queueCOPY_4_BYTES;
+                break;
+
+            case 8U:
+                ucReturn = queueCOPY_8_BYTES;
+                break;
+
+            default:
+                ucReturn = queueCOPY_ANY_SIZE;
+                break;
+        }
+
+        return ucReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCopyItem( const Queue_t * const pxQueue,
+                             void * pvDestination,
+                             const void * pvSource )
+    {
+        /* The fixed size memcpy() calls are expanded by the compiler into a
+         * single load and store of the right width, without a function call
+         * and without making assumptions about the alignment of the caller's
+         * buffer. */
+        switch( pxQueue->ucCopyClass )
+        {
+            case queueCOPY_1_BYTE:
+                *( ( uint8_t * ) pvDestination ) = *( ( const uint8_t * ) pvSource );
+                break;
+
+            case queueCOPY_2_BYTES:
+                ( void ) memcpy( pvDestination, pvSource, 2U );
+                break;
+
+            case queueCOPY_4_BYTES:
+                ( void ) memcpy( pvDestination, pvSource, 4U );
+                break;
+
+            case queueCOPY_8_BYTES:
+                ( void ) memcpy( pvDestination, pvSource, 8U );
+                break;
+
+            default:
+                ( void ) memcpy( pvDestination, pvSource, ( size_t ) pxQueue->uxItemSize );
+                break;
+        }
+    }
+
+#endif /* configUSE_QUEUE_SIZED_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+
+    static UBaseType_t prvGetBatchSpaces( const Queue_t * pxQueue )
+    {
+        UBaseType_t uxReturn;
+
+        if( queueCOPY_SEND_ALLOWED( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+        {
+            uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting );
+        }
+        else
+        {
+            uxReturn = ( UBaseType_t ) 0;
+        }
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvGetBatchItems( const Queue_t * pxQueue )
+    {
+        UBaseType_t uxReturn;
+
+        if( queueCOPY_RECEIVE_ALLOWED( pxQueue ) != pdFALSE )
+        {
+            uxReturn = pxQueue->uxMessagesWaiting;
+        }
+        else
+        {
+            uxReturn = ( UBaseType_t ) 0;
+        }
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCopyMultipleToQueue( Queue_t * const pxQueue,
+                                        const void * pvItems,
+                                        const UBaseType_t uxCount )
+    {
+        const size_t xTotalBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+        const size_t xBytesToEnd = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo );
+
+        /* This function is called from a critical section. */
+
+        if( xTotalBytes < xBytesToEnd )
+        {
+            ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItems, xTotalBytes );
+            pxQueue->pcWriteTo += xTotalBytes;
+        }
+        else
+        {
+            /* The batch reaches or passes the end of the storage area, so the
+             * remainder, if any, is written to its start. */
+            ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItems, xBytesToEnd );
+            ( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) &( ( ( const uint8_t * ) pvItems )[ xBytesToEnd ] ), xTotalBytes - xBytesToEnd );
+            pxQueue->pcWriteTo = pxQueue->pcHead + ( xTotalBytes - xBytesToEnd );
+        }
+
+        pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting + uxCount );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCopyMultipleFromQueue( Queue_t * const pxQueue,
+                                          void * const pvBuffer,
+                                          const UBaseType_t uxCount )
+    {
+        const size_t xTotalBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+        int8_t * pcFirstItem;
+        size_t xBytesToEnd;
+
+        /* This function is called from a critical section.  As in
+         * prvCopyDataFromQueue(), pcReadFrom is left pointing at the last item
+         * read. */
+        pcFirstItem = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize;
+
+        if( pcFirstItem >= pxQueue->u.xQueue.pcTail )
+        {
+            pcFirstItem = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xBytesToEnd = ( size_t ) ( pxQueue->u.xQueue.pcTail - pcFirstItem );
+
+        if( xTotalBytes <= xBytesToEnd )
+        {
+            ( void ) memcpy( pvBuffer, ( void * ) pcFirstItem, xTotalBytes );
+            pxQueue->u.xQueue.pcReadFrom = pcFirstItem + ( xTotalBytes - pxQueue->uxItemSize );
+        }
+        else
+        {
+            ( void ) memcpy( pvBuffer, ( void * ) pcFirstItem, xBytesToEnd );
+            ( void ) memcpy( ( void * ) &( ( ( uint8_t * ) pvBuffer )[ xBytesToEnd ] ), ( void * ) pxQueue->pcHead, xTotalBytes - xBytesToEnd );
+            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead + ( ( xTotalBytes - xBytesToEnd ) - pxQueue->uxItemSize );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvUnblockBatchReceivers( const Queue_t * const pxQueue,
+                                                const UBaseType_t uxItemsAdded )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        #if ( configUSE_QUEUE_SETS == 1 )
+            UBaseType_t uxItem;
+
+            if( pxQueue->pxQueueSetContainer != NULL )
+            {
+                /* The queue set holds one entry per item, as if each item had
+                 * been sent separately. */
+                for( uxItem = 0; uxItem < uxItemsAdded; uxItem++ )
+                {
+                    if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                    {
+                        xHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            else
+        #endif /* configUSE_QUEUE_SETS */
+        {
+            if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+            {
+                xHigherPriorityTaskWoken = queueUNBLOCK_RECEIVERS( pxQueue, uxItemsAdded );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xHigherPriorityTaskWoken;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvUnblockBatchSenders( const Queue_t * const pxQueue,
+                                              const UBaseType_t uxItemsRemoved )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+        {
+            xHigherPriorityTaskWoken = queueUNBLOCK_SENDERS( pxQueue, uxItemsRemoved );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xHigherPriorityTaskWoken;
+    }
+
+#endif /* configUSE_QUEUE_BATCH_TRANSFER */
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -2541,7 +4386,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
                      * suspended. */
                     if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                     {
-                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                        if( queueUNBLOCK_RECEIVERS( pxQueue, 1U ) != pdFALSE )
                         {
                             /* The task waiting has a higher priority so record that a
                              * context switch is required. */
@@ -2564,7 +4409,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
                  * the pending ready list as the scheduler is still suspended. */
                 if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    if( queueUNBLOCK_RECEIVERS( pxQueue, 1U ) != pdFALSE )
                     {
                         /* The task waiting has a higher priority so record that
                          * a context switch is required. */
@@ -2598,7 +4443,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
         {
             if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
             {
-                if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                if( queueUNBLOCK_SENDERS( pxQueue, 1U ) != pdFALSE )
                 {
                     vTaskMissedYield();
                 }
@@ -2627,7 +4472,8 @@ static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue )
 
     taskENTER_CRITICAL();
     {
-        if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+        if( ( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 ) ||
+            ( queueCOPY_RECEIVE_ALLOWED( pxQueue ) == pdFALSE ) )
         {
             xReturn = pdTRUE;
         }
@@ -2666,13 +4512,18 @@ BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue )
 }
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvIsQueueFull( const Queue_t * pxQueue )
+static BaseType_t prvIsQueueFull( const Queue_t * pxQueue,
+                                  const BaseType_t xCopyPosition )
 {
     BaseType_t xReturn;
 
     taskENTER_CRITICAL();
     {
-        if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+        /* A queue is also reported as full when a reserved slot or an acquired
+         * item stops an item being sent to xCopyPosition, so the writer blocks
+         * until xQueueCommit() or xQueueRelease() unblocks it. */
+        if( ( ( pxQueue->uxMessagesWaiting == pxQueue->uxLength ) && ( xCopyPosition != queueOVERWRITE ) ) ||
+            ( queueCOPY_SEND_ALLOWED( pxQueue, xCopyPosition ) == pdFALSE ) )
         {
             xReturn = pdTRUE;
         }
@@ -2727,7 +4578,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
          * between the check to see if the queue is full and blocking on the queue. */
         portDISABLE_INTERRUPTS();
         {
-            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
             {
                 /* The queue is full - do we want to block or just leave without
                  * posting? */
@@ -2852,7 +4703,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
                 }
 
                 --( pxQueue->uxMessagesWaiting );
-                ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+                queueCOPY_ITEM( pxQueue, pvBuffer, pxQueue->u.xQueue.pcReadFrom );
 
                 xReturn = pdPASS;
 
@@ -2974,7 +4825,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
             }
 
             --( pxQueue->uxMessagesWaiting );
-            ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+            queueCOPY_ITEM( pxQueue, pvBuffer, pxQueue->u.xQueue.pcReadFrom );
 
             if( ( *pxCoRoutineWoken ) == pdFALSE )
             {
@@ -3181,6 +5032,46 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 #endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_WAIT_ANY == 1 )
+
+    List_t * pxQueueGetWaitAnyListRestricted( QueueHandle_t xQueue )
+    {
+        Queue_t * const pxQueue = xQueue;
+        List_t * pxReturn;
+
+        traceENTER_pxQueueGetWaitAnyListRestricted( xQueue );
+
+        /* This function should not be called by application code hence the
+         * 'Restricted' in its name.  It is not part of the public API.  It is
+         * used by xTaskWaitAny(), which calls it from a critical section with
+         * the scheduler suspended, so the queue cannot be locked. */
+        configASSERT( pxQueue );
+
+        #if ( configUSE_QUEUE_SETS == 1 )
+        {
+            /* Sending to a queue that is in a set notifies the set rather than
+             * the tasks waiting to receive from the queue. */
+            configASSERT( pxQueue->pxQueueSetContainer == NULL );
+        }
+        #endif
+
+        if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0U )
+        {
+            pxReturn = &( pxQueue->xTasksWaitingToReceive );
+        }
+        else
+        {
+            pxReturn = NULL;
+        }
+
+        traceRETURN_pxQueueGetWaitAnyListRestricted( pxReturn );
+
+        return pxReturn;
+    }
+
+#endif /* configUSE_WAIT_ANY */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
     QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxEventQueueLength )
@@ -0,0 +1,637 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rw_lock.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include reader-writer lock functionality. This #if is closed at the very
+ * bottom of this file. If you want to include reader-writer locks then ensure
+ * configUSE_RW_LOCKS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_RW_LOCKS == 1 )
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define rwlockYIELD_IF_USING_PREEMPTION()
+    #else
+        #define rwlockYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+    #endif
+
+/* The lock is either free, held by xWriter, or held by the uxReaders tasks
+ * recorded in pxReaders.  The lock is handed directly to waiting tasks when it
+ * is released, so a waiting task only ever needs to block once, and on being
+ * unblocked only needs to check whether it is now a holder. */
+    typedef struct RwLockDef_t
+    {
+        TaskHandle_t xWriter;           /**< The task holding the lock for writing, or NULL. */
+        UBaseType_t uxReaders;          /**< The number of tasks holding the lock for reading. */
+        UBaseType_t uxMaxReaders;       /**< The number of entries in pxReaders. */
+        TaskHandle_t * pxReaders;       /**< The tasks holding the lock for reading, with NULL in unused entries.  Follows this structure in memory. */
+        List_t xTasksWaitingToRead;     /**< Tasks waiting to take the lock for reading, in priority order. */
+        List_t xTasksWaitingToWrite;    /**< Tasks waiting to take the lock for writing, in priority order. */
+    } RwLock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Take the lock for reading or writing, blocking for up to xTicksToWait if it
+ * cannot be granted immediately.
+ */
+    static BaseType_t prvTakeLock( RwLock_t * const pxLock,
+                                   BaseType_t xForWriting,
+                                   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return pdTRUE if the lock can be granted to a new reader or writer without
+ * overtaking a waiting writer.
+ */
+    static BaseType_t prvCanTakeLock( const RwLock_t * const pxLock,
+                                      BaseType_t xForWriting ) PRIVILEGED_FUNCTION;
+
+/*
+ * Record xTask as a holder of the lock.  xTask's mutex held count must already
+ * have been incremented.
+ */
+    static void prvAddHolder( RwLock_t * const pxLock,
+                              TaskHandle_t xTask,
+                              BaseType_t xForWriting ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the index of xTask in pxReaders, or uxMaxReaders if xTask does not
+ * hold the lock for reading.
+ */
+    static UBaseType_t prvFindReader( const RwLock_t * const pxLock,
+                                      TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Hand the lock to the highest priority waiting writer, or to as many waiting
+ * readers as are allowed if no writer is waiting.  Called from a critical
+ * section whenever a holder releases the lock or a waiting task gives up.
+ * Returns pdTRUE if a task with a priority above the calling task was
+ * unblocked.
+ */
+    static BaseType_t prvHandOverLock( RwLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Raise the priority of every holder of the lock to that of the calling task,
+ * if it is higher.  Returns pdTRUE if any holder inherited, or had already
+ * inherited, the calling task's priority.
+ */
+    static BaseType_t prvInheritPriority( const RwLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called after a waiting task has timed out.  Lower the priority of every
+ * holder of the lock to the priority of the highest priority task that is
+ * still waiting, or to the holder's base priority.
+ */
+    static void prvDisinheritPriorityAfterTimeout( const RwLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        RwLockHandle_t xRwLockCreate( UBaseType_t uxMaxReaders )
+        {
+            RwLock_t * pxLock = NULL;
+            UBaseType_t uxReader;
+
+            traceENTER_xRwLockCreate( uxMaxReaders );
+
+            configASSERT( uxMaxReaders > ( UBaseType_t ) 0U );
+
+            if( ( uxMaxReaders > ( UBaseType_t ) 0U ) &&
+                /* Check for multiplication and addition overflow. */
+                ( ( ( SIZE_MAX - sizeof( RwLock_t ) ) / sizeof( TaskHandle_t ) ) >= uxMaxReaders ) )
+            {
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxLock = ( RwLock_t * ) pvPortMalloc( sizeof( RwLock_t ) + ( ( size_t ) uxMaxReaders * sizeof( TaskHandle_t ) ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxLock != NULL )
+            {
+                pxLock->xWriter = NULL;
+                pxLock->uxReaders = ( UBaseType_t ) 0U;
+                pxLock->uxMaxReaders = uxMaxReaders;
+                pxLock->pxReaders = ( TaskHandle_t * ) &( pxLock[ 1 ] );
+
+                for( uxReader = ( UBaseType_t ) 0U; uxReader < uxMaxReaders; uxReader++ )
+                {
+                    pxLock->pxReaders[ uxReader ] = NULL;
+                }
+
+                vListInitialise( &( pxLock->xTasksWaitingToRead ) );
+                vListInitialise( &( pxLock->xTasksWaitingToWrite ) );
+            }
+            else
+            {
+                traceRW_LOCK_CREATE_FAILED();
+            }
+
+            traceRETURN_xRwLockCreate( pxLock );
+
+            return pxLock;
+        }
+/*-----------------------------------------------------------*/
+
+        void vRwLockDelete( RwLockHandle_t xRwLock )
+        {
+            traceENTER_vRwLockDelete( xRwLock );
+
+            configASSERT( xRwLock != NULL );
+            configASSERT( xRwLock->xWriter == NULL );
+            configASSERT( xRwLock->uxReaders == ( UBaseType_t ) 0U );
+            configASSERT( listLIST_IS_EMPTY( &( xRwLock->xTasksWaitingToRead ) ) != pdFALSE );
+            configASSERT( listLIST_IS_EMPTY( &( xRwLock->xTasksWaitingToWrite ) ) != pdFALSE );
+
+            vPortFree( xRwLock );
+
+            traceRETURN_vRwLockDelete();
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvCanTakeLock( const RwLock_t * const pxLock,
+                                      BaseType_t xForWriting )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        /* A waiting writer blocks new readers as well as new writers. */
+        if( ( pxLock->xWriter == NULL ) &&
+            ( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToWrite ) ) != pdFALSE ) )
+        {
+            if( xForWriting != pdFALSE )
+            {
+                if( pxLock->uxReaders == ( UBaseType_t ) 0U )
+                {
+                    xReturn = pdTRUE;
+                }
+            }
+            else
+            {
+                if( pxLock->uxReaders < pxLock->uxMaxReaders )
+                {
+                    xReturn = pdTRUE;
+                }
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvAddHolder( RwLock_t * const pxLock,
+                              TaskHandle_t xTask,
+                              BaseType_t xForWriting )
+    {
+        UBaseType_t uxReader;
+
+        if( xForWriting != pdFALSE )
+        {
+            pxLock->xWriter = xTask;
+        }
+        else
+        {
+            /* The caller has checked uxReaders < uxMaxReaders, so there is a
+             * free entry. */
+            for( uxReader = ( UBaseType_t ) 0U; pxLock->pxReaders[ uxReader ] != NULL; uxReader++ )
+            {
+                configASSERT( uxReader < pxLock->uxMaxReaders );
+            }
+
+            pxLock->pxReaders[ uxReader ] = xTask;
+            ( pxLock->uxReaders )++;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvFindReader( const RwLock_t * const pxLock,
+                                      TaskHandle_t xTask )
+    {
+        UBaseType_t uxReader;
+
+        for( uxReader = ( UBaseType_t ) 0U; uxReader < pxLock->uxMaxReaders; uxReader++ )
+        {
+            if( pxLock->pxReaders[ uxReader ] == xTask )
+            {
+                break;
+            }
+        }
+
+        return uxReader;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvHandOverLock( RwLock_t * const pxLock )
+    {
+        TaskHandle_t xTask;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        if( pxLock->xWriter == NULL )
+        {
+            if( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToWrite ) ) == pdFALSE )
+            {
+                /* Writers are preferred, but a writer has to wait for every
+                 * reader to release the lock. */
+                if( pxLock->uxReaders == ( UBaseType_t ) 0U )
+                {
+                    xTask = listGET_OWNER_OF_HEAD_ENTRY( &( pxLock->xTasksWaitingToWrite ) );
+                    vTaskIncrementMutexHeldCountOfHolder( xTask );
+                    prvAddHolder( pxLock, xTask, pdTRUE );
+
+                    if( xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToWrite ) ) != pdFALSE )
+                    {
+                        xYieldRequired = pdTRUE;
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* Readers are unblocked in priority order while there is room
+                 * for them. */
+                while( ( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToRead ) ) == pdFALSE ) &&
+                       ( pxLock->uxReaders < pxLock->uxMaxReaders ) )
+                {
+                    xTask = listGET_OWNER_OF_HEAD_ENTRY( &( pxLock->xTasksWaitingToRead ) );
+                    vTaskIncrementMutexHeldCountOfHolder( xTask );
+                    prvAddHolder( pxLock, xTask, pdFALSE );
+
+                    if( xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToRead ) ) != pdFALSE )
+                    {
+                        xYieldRequired = pdTRUE;
+                    }
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xYieldRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvInheritPriority( const RwLock_t * const pxLock )
+    {
+        UBaseType_t uxReader;
+        BaseType_t xInheritanceOccurred = pdFALSE;
+
+        if( pxLock->xWriter != NULL )
+        {
+            xInheritanceOccurred = xTaskPriorityInherit( pxLock->xWriter );
+        }
+        else
+        {
+            for( uxReader = ( UBaseType_t ) 0U; uxReader < pxLock->uxMaxReaders; uxReader++ )
+            {
+                if( pxLock->pxReaders[ uxReader ] != NULL )
+                {
+                    if( xTaskPriorityInherit( pxLock->pxReaders[ uxReader ] ) != pdFALSE )
+                    {
+                        xInheritanceOccurred = pdTRUE;
+                    }
+                }
+            }
+        }
+
+        return xInheritanceOccurred;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvDisinheritPriorityAfterTimeout( const RwLock_t * const pxLock )
+    {
+        UBaseType_t uxReader;
+        UBaseType_t uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+        UBaseType_t uxPriority;
+
+        /* Event lists are ordered by priority, so the highest priority waiting
+         * task is at the head of each list. */
+        if( listCURRENT_LIST_LENGTH( &( pxLock->xTasksWaitingToRead ) ) > 0U )
+        {
+            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxLock->xTasksWaitingToRead ) ) );
+        }
+
+        if( listCURRENT_LIST_LENGTH( &( pxLock->xTasksWaitingToWrite ) ) > 0U )
+        {
+            uxPriority = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxLock->xTasksWaitingToWrite ) ) );
+
+            if( uxPriority > uxHighestPriorityOfWaitingTasks )
+            {
+                uxHighestPriorityOfWaitingTasks = uxPriority;
+            }
+        }
+
+        if( pxLock->xWriter != NULL )
+        {
+            vTaskPriorityDisinheritAfterTimeout( pxLock->xWriter, uxHighestPriorityOfWaitingTasks );
+        }
+        else
+        {
+            for( uxReader = ( UBaseType_t ) 0U; uxReader < pxLock->uxMaxReaders; uxReader++ )
+            {
+                if( pxLock->pxReaders[ uxReader ] != NULL )
+                {
+                    vTaskPriorityDisinheritAfterTimeout( pxLock->pxReaders[ uxReader ], uxHighestPriorityOfWaitingTasks );
+                }
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTakeLock( RwLock_t * const pxLock,
+                                   BaseType_t xForWriting,
+                                   TickType_t xTicksToWait )
+    {
+        List_t * const pxWaitingList = ( xForWriting != pdFALSE ) ? &( pxLock->xTasksWaitingToWrite ) : &( pxLock->xTasksWaitingToRead );
+        TaskHandle_t const xCurrentTask = xTaskGetCurrentTaskHandle();
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xBlocked = pdFALSE;
+        BaseType_t xInheritanceOccurred = pdFALSE;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        configASSERT( pxLock != NULL );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        /* The task must not already hold the lock, as it would then wait for
+         * itself. */
+        configASSERT( pxLock->xWriter != xCurrentTask );
+        configASSERT( prvFindReader( pxLock, xCurrentTask ) == pxLock->uxMaxReaders );
+
+        vTaskSuspendAll();
+        {
+            taskENTER_CRITICAL();
+            {
+                if( prvCanTakeLock( pxLock, xForWriting ) != pdFALSE )
+                {
+                    ( void ) pvTaskIncrementMutexHeldCount();
+                    prvAddHolder( pxLock, xCurrentTask, xForWriting );
+                    xReturn = pdPASS;
+                }
+                else if( xTicksToWait != ( TickType_t ) 0 )
+                {
+                    /* The holders must not be left running at a priority
+                     * below that of a task waiting for them. */
+                    xInheritanceOccurred = prvInheritPriority( pxLock );
+                    vTaskPlaceOnEventList( pxWaitingList, xTicksToWait );
+                    xBlocked = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        if( ( xTaskResumeAll() == pdFALSE ) && ( xBlocked != pdFALSE ) )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xBlocked != pdFALSE )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* The lock is handed over while the task is still on the
+                 * waiting list, so the task holds the lock now unless it was
+                 * unblocked because its block time expired. */
+                if( ( xForWriting != pdFALSE ) ? ( pxLock->xWriter == xCurrentTask ) : ( prvFindReader( pxLock, xCurrentTask ) < pxLock->uxMaxReaders ) )
+                {
+                    xReturn = pdPASS;
+                }
+                else
+                {
+                    if( xInheritanceOccurred != pdFALSE )
+                    {
+                        prvDisinheritPriorityAfterTimeout( pxLock );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* A writer that gives up may have been the only thing
+                     * holding back waiting readers. */
+                    xYieldRequired = prvHandOverLock( pxLock );
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xYieldRequired != pdFALSE )
+            {
+                rwlockYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRwLockTakeRead( RwLockHandle_t xRwLock,
+                                TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn;
+
+        traceENTER_xRwLockTakeRead( xRwLock, xTicksToWait );
+
+        xReturn = prvTakeLock( xRwLock, pdFALSE, xTicksToWait );
+
+        traceRETURN_xRwLockTakeRead( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRwLockTakeWrite( RwLockHandle_t xRwLock,
+                                 TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn;
+
+        traceENTER_xRwLockTakeWrite( xRwLock, xTicksToWait );
+
+        xReturn = prvTakeLock( xRwLock, pdTRUE, xTicksToWait );
+
+        traceRETURN_xRwLockTakeWrite( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRwLockGiveRead( RwLockHandle_t xRwLock )
+    {
+        RwLock_t * const pxLock = xRwLock;
+        TaskHandle_t const xCurrentTask = xTaskGetCurrentTaskHandle();
+        UBaseType_t uxReader;
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_xRwLockGiveRead( xRwLock );
+
+        configASSERT( pxLock != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            uxReader = prvFindReader( pxLock, xCurrentTask );
+
+            if( uxReader < pxLock->uxMaxReaders )
+            {
+                pxLock->pxReaders[ uxReader ] = NULL;
+                ( pxLock->uxReaders )--;
+
+                /* Restore the priority of this task if it inherited a
+                 * priority and holds no other lock or mutex. */
+                xYieldRequired = xTaskPriorityDisinherit( xCurrentTask );
+
+                if( prvHandOverLock( pxLock ) != pdFALSE )
+                {
+                    xYieldRequired = pdTRUE;
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                /* The calling task does not hold the lock for reading. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            rwlockYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xRwLockGiveRead( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRwLockGiveWrite( RwLockHandle_t xRwLock )
+    {
+        RwLock_t * const pxLock = xRwLock;
+        TaskHandle_t const xCurrentTask = xTaskGetCurrentTaskHandle();
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_xRwLockGiveWrite( xRwLock );
+
+        configASSERT( pxLock != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxLock->xWriter == xCurrentTask )
+            {
+                pxLock->xWriter = NULL;
+
+                /* Restore the priority of this task if it inherited a
+                 * priority and holds no other lock or mutex. */
+                xYieldRequired = xTaskPriorityDisinherit( xCurrentTask );
+
+                if( prvHandOverLock( pxLock ) != pdFALSE )
+                {
+                    xYieldRequired = pdTRUE;
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                /* The calling task does not hold the lock for writing. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            rwlockYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xRwLockGiveWrite( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include reader-writer lock functionality. If you want to include
+ * reader-writer locks then ensure configUSE_RW_LOCKS is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_RW_LOCKS == 1 */
@@ -0,0 +1,457 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "spsc_queue.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include SPSC queue functionality. This #if is closed at the very bottom of
+ * this file. If you want to include SPSC queues then ensure
+ * configUSE_SPSC_QUEUES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+/* An index into the queue storage area, padded so that the producer's index
+ * and the consumer's index never share a cache line. */
+    typedef union SpscQueueIndex
+    {
+        volatile UBaseType_t uxIndex;
+        uint8_t ucPadding[ configCACHE_LINE_SIZE ];
+    } SpscQueueIndex_t;
+
+/* The storage area has one more slot than the queue length so that a full
+ * queue can be told apart from an empty one without a shared item count.  The
+ * queue is empty when the two indexes are equal, and full when the slot after
+ * xHead is xTail. */
+    typedef struct SpscQueueDef_t
+    {
+        SpscQueueIndex_t xHead;                  /**< The slot the next item is written to.  Only written by the producer. */
+        SpscQueueIndex_t xTail;                  /**< The slot the next item is read from.  Only written by the consumer. */
+        TaskHandle_t volatile xWaitingConsumer;  /**< The consumer while it is about to block or blocked, otherwise NULL.  Only written by the consumer. */
+        TaskHandle_t volatile xWaitingProducer;  /**< The producer while it is about to block or blocked on a full queue, otherwise NULL.  Only written by the producer. */
+        UBaseType_t uxSlots;                     /**< The number of slots in the storage area. */
+        UBaseType_t uxItemSize;                  /**< The size of each item in bytes. */
+        uint8_t * pucStorage;                    /**< The storage area, which follows this structure in memory. */
+    } SpscQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Copy an item into the queue and publish it to the consumer.  Returns pdFALSE
+ * if the queue is full.
+ */
+    static BaseType_t prvWriteItem( SpscQueue_t * const pxQueue,
+                                    const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if the queue has no free slot.
+ */
+    static BaseType_t prvIsQueueFull( const SpscQueue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        SpscQueueHandle_t xSpscQueueCreate( UBaseType_t uxLength,
+                                            UBaseType_t uxItemSize )
+        {
+            SpscQueue_t * pxQueue = NULL;
+            size_t xStorageSizeInBytes;
+            const UBaseType_t uxSlots = uxLength + ( UBaseType_t ) 1U;
+
+            traceENTER_xSpscQueueCreate( uxLength, uxItemSize );
+
+            configASSERT( uxItemSize > ( UBaseType_t ) 0U );
+            configASSERT( configSPSC_QUEUE_NOTIFICATION_INDEX < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+            if( ( uxLength > ( UBaseType_t ) 0U ) &&
+                ( uxSlots > uxLength ) &&
+                /* Check for multiplication overflow. */
+                ( ( SIZE_MAX / uxSlots ) >= uxItemSize ) &&
+                /* Check for addition overflow. */
+                ( ( SIZE_MAX - sizeof( SpscQueue_t ) ) >= ( size_t ) ( ( size_t ) uxSlots * ( size_t ) uxItemSize ) ) )
+            {
+                xStorageSizeInBytes = ( size_t ) uxSlots * ( size_t ) uxItemSize;
+
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxQueue = ( SpscQueue_t * ) pvPortMalloc( sizeof( SpscQueue_t ) + xStorageSizeInBytes );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxQueue != NULL )
+            {
+                pxQueue->xHead.uxIndex = ( UBaseType_t ) 0U;
+                pxQueue->xTail.uxIndex = ( UBaseType_t ) 0U;
+                pxQueue->xWaitingConsumer = NULL;
+                pxQueue->xWaitingProducer = NULL;
+                pxQueue->uxSlots = uxSlots;
+                pxQueue->uxItemSize = uxItemSize;
+                pxQueue->pucStorage = ( uint8_t * ) &( pxQueue[ 1 ] );
+            }
+            else
+            {
+                traceSPSC_QUEUE_CREATE_FAILED();
+            }
+
+            traceRETURN_xSpscQueueCreate( pxQueue );
+
+            return pxQueue;
+        }
+/*-----------------------------------------------------------*/
+
+        void vSpscQueueDelete( SpscQueueHandle_t xQueue )
+        {
+            traceENTER_vSpscQueueDelete( xQueue );
+
+            configASSERT( xQueue != NULL );
+
+            vPortFree( xQueue );
+
+            traceRETURN_vSpscQueueDelete();
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvIsQueueFull( const SpscQueue_t * const pxQueue )
+    {
+        UBaseType_t uxNextHead = pxQueue->xHead.uxIndex + ( UBaseType_t ) 1U;
+        BaseType_t xReturn = pdFALSE;
+
+        if( uxNextHead == pxQueue->uxSlots )
+        {
+            uxNextHead = ( UBaseType_t ) 0U;
+        }
+
+        if( uxNextHead == pxQueue->xTail.uxIndex )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvWriteItem( SpscQueue_t * const pxQueue,
+                                    const void * pvItem )
+    {
+        const UBaseType_t uxHead = pxQueue->xHead.uxIndex;
+        UBaseType_t uxNextHead = uxHead + ( UBaseType_t ) 1U;
+        BaseType_t xReturn = pdFALSE;
+
+        if( uxNextHead == pxQueue->uxSlots )
+        {
+            uxNextHead = ( UBaseType_t ) 0U;
+        }
+
+        if( uxNextHead != pxQueue->xTail.uxIndex )
+        {
+            ( void ) memcpy( ( void * ) &( pxQueue->pucStorage[ uxHead * pxQueue->uxItemSize ] ), pvItem, ( size_t ) pxQueue->uxItemSize );
+
+            /* The item must be complete before the consumer can see it. */
+            portMEMORY_BARRIER();
+            pxQueue->xHead.uxIndex = uxNextHead;
+
+            /* The consumer registers itself before it checks the queue one
+             * last time, so the new head must be visible before the producer
+             * checks for a registered consumer.  One side or the other then
+             * always sees the item, and the consumer cannot block while the
+             * item sits in the queue. */
+            portMEMORY_BARRIER();
+            xReturn = pdTRUE;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscQueueSend( SpscQueueHandle_t xQueue,
+                               const void * pvItem,
+                               TickType_t xTicksToWait )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+        TaskHandle_t xConsumer;
+        TimeOut_t xTimeOut;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xReturn = errQUEUE_FULL;
+
+        traceENTER_xSpscQueueSend( xQueue, pvItem, xTicksToWait );
+
+        configASSERT( pxQueue != NULL );
+        configASSERT( pvItem != NULL );
+
+        for( ; ; )
+        {
+            if( prvWriteItem( pxQueue, pvItem ) != pdFALSE )
+            {
+                xConsumer = pxQueue->xWaitingConsumer;
+
+                if( xConsumer != NULL )
+                {
+                    ( void ) xTaskNotifyGiveIndexed( xConsumer, configSPSC_QUEUE_NOTIFICATION_INDEX );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+                break;
+            }
+
+            /* xTaskCheckForTimeOut() sets xTicksToWait to zero on timeout. */
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                break;
+            }
+
+            if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+
+            /* As in xSpscQueueReceive(), register as the waiting producer and
+             * then check again in case the consumer freed a slot before it
+             * could see the registration. */
+            pxQueue->xWaitingProducer = xTaskGetCurrentTaskHandle();
+            portMEMORY_BARRIER();
+
+            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            {
+                ( void ) ulTaskNotifyTakeIndexed( configSPSC_QUEUE_NOTIFICATION_INDEX, pdTRUE, xTicksToWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxQueue->xWaitingProducer = NULL;
+
+            ( void ) xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
+        }
+
+        traceRETURN_xSpscQueueSend( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscQueueSendFromISR( SpscQueueHandle_t xQueue,
+                                      const void * pvItem,
+                                      BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+        TaskHandle_t xConsumer;
+        BaseType_t xReturn;
+
+        traceENTER_xSpscQueueSendFromISR( xQueue, pvItem, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxQueue != NULL );
+        configASSERT( pvItem != NULL );
+
+        if( prvWriteItem( pxQueue, pvItem ) != pdFALSE )
+        {
+            xConsumer = pxQueue->xWaitingConsumer;
+
+            if( xConsumer != NULL )
+            {
+                vTaskNotifyGiveIndexedFromISR( xConsumer, configSPSC_QUEUE_NOTIFICATION_INDEX, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = errQUEUE_FULL;
+        }
+
+        traceRETURN_xSpscQueueSendFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscQueueReceive( SpscQueueHandle_t xQueue,
+                                  void * pvBuffer,
+                                  TickType_t xTicksToWait )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+        TaskHandle_t xProducer;
+        TimeOut_t xTimeOut;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xReturn = errQUEUE_EMPTY;
+        UBaseType_t uxTail;
+
+        traceENTER_xSpscQueueReceive( xQueue, pvBuffer, xTicksToWait );
+
+        configASSERT( pxQueue != NULL );
+        configASSERT( pvBuffer != NULL );
+
+        for( ; ; )
+        {
+            uxTail = pxQueue->xTail.uxIndex;
+
+            if( uxTail != pxQueue->xHead.uxIndex )
+            {
+                /* Do not read the item until the head that published it has
+                 * been read. */
+                portMEMORY_BARRIER();
+                ( void ) memcpy( pvBuffer, ( const void * ) &( pxQueue->pucStorage[ uxTail * pxQueue->uxItemSize ] ), ( size_t ) pxQueue->uxItemSize );
+
+                uxTail++;
+
+                if( uxTail == pxQueue->uxSlots )
+                {
+                    uxTail = ( UBaseType_t ) 0U;
+                }
+
+                /* The item must be copied out before the producer can reuse
+                 * its slot. */
+                portMEMORY_BARRIER();
+                pxQueue->xTail.uxIndex = uxTail;
+
+                /* The new tail must be visible before checking for a producer
+                 * blocked on a full queue, for the same reason prvWriteItem()
+                 * publishes the head before the producer checks for a waiting
+                 * consumer. */
+                portMEMORY_BARRIER();
+                xProducer = pxQueue->xWaitingProducer;
+
+                if( xProducer != NULL )
+                {
+                    ( void ) xTaskNotifyGiveIndexed( xProducer, configSPSC_QUEUE_NOTIFICATION_INDEX );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+                break;
+            }
+
+            /* xTaskCheckForTimeOut() sets xTicksToWait to zero on timeout. */
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                break;
+            }
+
+            if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+
+            /* Register as the waiting consumer, then check the queue again in
+             * case the producer sent an item before it could see the
+             * registration. */
+            pxQueue->xWaitingConsumer = xTaskGetCurrentTaskHandle();
+            portMEMORY_BARRIER();
+
+            if( pxQueue->xTail.uxIndex == pxQueue->xHead.uxIndex )
+            {
+                /* Clearing the notification value on exit also discards a
+                 * notification left by an item that arrived after an earlier
+                 * registration was checked. */
+                ( void ) ulTaskNotifyTakeIndexed( configSPSC_QUEUE_NOTIFICATION_INDEX, pdTRUE, xTicksToWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxQueue->xWaitingConsumer = NULL;
+
+            ( void ) xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
+        }
+
+        traceRETURN_xSpscQueueReceive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxSpscQueueMessagesWaiting( SpscQueueHandle_t xQueue )
+    {
+        const SpscQueue_t * const pxQueue = xQueue;
+        UBaseType_t uxHead, uxTail, uxReturn;
+
+        traceENTER_uxSpscQueueMessagesWaiting( xQueue );
+
+        configASSERT( pxQueue != NULL );
+
+        uxTail = pxQueue->xTail.uxIndex;
+        uxHead = pxQueue->xHead.uxIndex;
+
+        if( uxHead >= uxTail )
+        {
+            uxReturn = uxHead - uxTail;
+        }
+        else
+        {
+            uxReturn = ( pxQueue->uxSlots - uxTail ) + uxHead;
+        }
+
+        traceRETURN_uxSpscQueueMessagesWaiting( uxReturn );
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include SPSC queue functionality. If you want to include SPSC queues then
+ * ensure configUSE_SPSC_QUEUES is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_SPSC_QUEUES == 1 */
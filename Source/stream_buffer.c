@@ -58,6 +58,10 @@
         #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build stream_buffer.c
     #endif
 
+    #if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+        #include "atomic.h"
+    #endif
+
 /* If the user has not provided application specific Rx notification macros,
  * or #defined the notification macros away, then provide default implementations
  * that uses task notifications. */
@@ -225,6 +229,55 @@
     #define sbFLAGS_IS_MESSAGE_BUFFER          ( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
     #define sbFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 2 ) /* Set if the stream buffer was created using statically allocated memory. */
     #define sbFLAGS_IS_BATCHING_BUFFER         ( ( uint8_t ) 4 ) /* Set if the stream buffer was created as a batching buffer, meaning the receiver task will only unblock when the trigger level exceededs. */
+    #define sbFLAGS_IS_MULTI_WRITER            ( ( uint8_t ) 8 ) /* Set if the stream buffer was created as a multi-writer buffer, meaning writers reserve space before copying into it. */
+
+    #if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+
+/* The reservation of a multi-writer stream buffer holds the index at which the
+ * next writer reserves space above the number of writers that have reserved
+ * space but not yet filled it, so both can be updated by one compare and swap.
+ * The index must fit in the bits above the count, which limits the length of a
+ * multi-writer stream buffer. */
+        #define sbRESERVATION_INDEX_SHIFT      ( 8U )
+        #define sbRESERVATION_WRITER_MASK      ( ( uint32_t ) 0xffU )
+        #define sbMULTI_WRITER_MAX_LENGTH      ( ( uint32_t ) 0xffffffU )
+
+/* The index at which the next byte is written.  For a multi-writer stream
+ * buffer that is the end of the reserved space, which can be ahead of xHead. */
+        #define sbGET_WRITE_INDEX( pxStreamBuffer )                                                                    \
+    ( ( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_MULTI_WRITER ) != ( uint8_t ) 0 ) ?                                  \
+      ( size_t ) ( ( pxStreamBuffer )->ulReservation >> sbRESERVATION_INDEX_SHIFT ) : ( pxStreamBuffer )->xHead )
+
+/* True if a writer of a multi-writer stream buffer is filling the space it
+ * reserved or waiting for space. */
+        #define sbWRITERS_ARE_ACTIVE( pxStreamBuffer )                                            \
+    ( ( ( ( pxStreamBuffer )->ulReservation & sbRESERVATION_WRITER_MASK ) != ( uint32_t ) 0U ) || \
+      ( listLIST_IS_EMPTY( &( ( pxStreamBuffer )->xTasksWaitingToSend ) ) == pdFALSE ) )
+
+/* Writers of a multi-writer stream buffer wait for space on an event list
+ * rather than through a task notification, so must be unblocked separately
+ * after bytes are removed from the buffer. */
+        #define prvUNBLOCK_WAITING_WRITERS( pxStreamBuffer )                               \
+    do {                                                                                   \
+        if( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_MULTI_WRITER ) != ( uint8_t ) 0 )   \
+        {                                                                                  \
+            prvUnblockWaitingWriters( ( pxStreamBuffer ) );                                \
+        }                                                                                  \
+    } while( 0 )
+
+        #define prvUNBLOCK_WAITING_WRITERS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )        \
+    do {                                                                                                \
+        if( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_MULTI_WRITER ) != ( uint8_t ) 0 )                \
+        {                                                                                               \
+            prvUnblockWaitingWritersFromISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) );       \
+        }                                                                                               \
+    } while( 0 )
+    #else /* if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 ) */
+        #define sbGET_WRITE_INDEX( pxStreamBuffer )       ( ( pxStreamBuffer )->xHead )
+        #define sbWRITERS_ARE_ACTIVE( pxStreamBuffer )    ( pdFALSE )
+        #define prvUNBLOCK_WAITING_WRITERS( pxStreamBuffer )
+        #define prvUNBLOCK_WAITING_WRITERS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )
+    #endif /* if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 ) */
 
 /*-----------------------------------------------------------*/
 
@@ -249,6 +302,11 @@ typedef struct StreamBufferDef_t
         StreamBufferCallbackFunction_t pxReceiveCompletedCallback; /* Optional callback called on receive complete.  sbRECEIVE_COMPLETED is called if this is NULL. */
     #endif
     UBaseType_t uxNotificationIndex;                               /* The index we are using for notification, by default tskDEFAULT_INDEX_TO_NOTIFY. */
+
+    #if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+        volatile uint32_t ulReservation; /* For a multi-writer buffer, the index at which the next writer reserves space and the number of writers still filling the space they reserved. */
+        List_t xTasksWaitingToSend;      /* For a multi-writer buffer, the writers waiting for space, in priority order. */
+    #endif
 } StreamBuffer_t;
 
 /*
@@ -284,6 +342,15 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                         size_t xBufferLengthBytes,
                                         size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
 
+/*
+ * Waits up to xTicksToWait for xRequiredSpace bytes to be free in the buffer,
+ * then returns the number of bytes that are free.  Only one writer can wait at
+ * a time.
+ */
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+                               size_t xRequiredSpace,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 /*
  * If the stream buffer is being used as a message buffer, then writes an entire
  * message to the buffer.  If the stream buffer is being used as a stream
@@ -314,6 +381,91 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                       size_t xCount,
                                       size_t xTail ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
+
+/*
+ * Describes the xCount bytes of the buffer starting at index xStart in
+ * pxWindow, splitting them into two regions if they wrap past the end of the
+ * buffer.  Returns xCount.
+ */
+    static size_t prvGetWindow( const StreamBuffer_t * const pxStreamBuffer,
+                                size_t xStart,
+                                size_t xCount,
+                                StreamBufferWindow_t * const pxWindow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Waits up to xTicksToWait for more than xBytesToWaitFor bytes to be in the
+ * buffer, then returns the number of bytes in the buffer.  Only one reader can
+ * wait at a time.
+ */
+    static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+                                  size_t xBytesToWaitFor,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * The scatter-gather equivalent of prvWriteMessageToBuffer().  Gathers the
+ * xSegmentCount segments in pxSegments, which total xDataLengthBytes, into the
+ * buffer as a single message or as a single run of stream bytes.
+ */
+    static size_t prvWriteSegmentsToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                            const StreamBufferSegment_t * pxSegments,
+                                            size_t xSegmentCount,
+                                            size_t xDataLengthBytes,
+                                            size_t xSpace,
+                                            size_t xRequiredSpace ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the total number of bytes in the xSegmentCount segments in
+ * pxSegments.
+ */
+    static size_t prvSegmentsLength( const StreamBufferSegment_t * pxSegments,
+                                     size_t xSegmentCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves the tail of a message buffer past the message at the tail, returning
+ * pdFAIL if the buffer is empty.
+ */
+    static BaseType_t prvDiscardMessage( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+
+#if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+
+/*
+ * Reserves up to xMaxCount bytes of a multi-writer stream buffer for the
+ * calling writer, setting *pxStart to the index of the first reserved byte.
+ * Returns the number of bytes reserved, which is 0 if fewer than xMinCount
+ * bytes are free.
+ */
+    static size_t prvReserveSpace( StreamBuffer_t * const pxStreamBuffer,
+                                   size_t xMaxCount,
+                                   size_t xMinCount,
+                                   size_t * const pxStart ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by a writer of a multi-writer stream buffer after filling the space
+ * it reserved.  The last writer to finish moves xHead to the end of the
+ * reserved space, making the bytes of every writer visible to the reader in
+ * the order the space was reserved.  Must be called from a critical section.
+ */
+    static void prvPublishReservation( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Writes the bytes sent to a multi-writer stream buffer from a task, waiting up
+ * to xTicksToWait for xRequiredSpace bytes to be free.
+ */
+    static size_t prvSendToMultiWriterBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                              const void * pvTxData,
+                                              size_t xRequiredSpace,
+                                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock every writer waiting for space in a multi-writer stream buffer.
+ */
+    static void prvUnblockWaitingWriters( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+    static void prvUnblockWaitingWritersFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                                 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_STREAM_BUFFER_MULTI_WRITER */
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -355,6 +507,18 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
             ucFlags = sbFLAGS_IS_BATCHING_BUFFER;
             configASSERT( xBufferSizeBytes > 0 );
         }
+
+        #if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+            else if( xStreamBufferType == sbTYPE_STREAM_MULTI_WRITER_BUFFER )
+            {
+                /* Is a multi-writer buffer but not statically allocated.  The
+                 * length is incremented below, so must be less than the
+                 * maximum here. */
+                ucFlags = sbFLAGS_IS_MULTI_WRITER;
+                configASSERT( xBufferSizeBytes > 0 );
+                configASSERT( ( uint32_t ) xBufferSizeBytes < sbMULTI_WRITER_MAX_LENGTH );
+            }
+        #endif
         else
         {
             /* Not a message buffer and not statically allocated. */
@@ -469,6 +633,16 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
             ucFlags = sbFLAGS_IS_BATCHING_BUFFER | sbFLAGS_IS_STATICALLY_ALLOCATED;
             configASSERT( xBufferSizeBytes > 0 );
         }
+
+        #if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+            else if( xStreamBufferType == sbTYPE_STREAM_MULTI_WRITER_BUFFER )
+            {
+                /* Statically allocated multi-writer buffer. */
+                ucFlags = sbFLAGS_IS_MULTI_WRITER | sbFLAGS_IS_STATICALLY_ALLOCATED;
+                configASSERT( xBufferSizeBytes > 0 );
+                configASSERT( ( uint32_t ) xBufferSizeBytes <= sbMULTI_WRITER_MAX_LENGTH );
+            }
+        #endif
         else
         {
             /* Statically allocated stream buffer. */
@@ -616,7 +790,7 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
     /* Can only reset a message buffer if there are no tasks blocked on it. */
     taskENTER_CRITICAL();
     {
-        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
+        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) && ( sbWRITERS_ARE_ACTIVE( pxStreamBuffer ) == pdFALSE ) )
         {
             #if ( configUSE_SB_COMPLETED_CALLBACK == 1 )
             {
@@ -681,7 +855,7 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
     /* coverity[misra_c_2012_directive_4_7_violation] */
     uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
     {
-        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
+        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) && ( sbWRITERS_ARE_ACTIVE( pxStreamBuffer ) == pdFALSE ) )
         {
             #if ( configUSE_SB_COMPLETED_CALLBACK == 1 )
             {
@@ -768,7 +942,7 @@ size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
     {
         xOriginalTail = pxStreamBuffer->xTail;
         xSpace = pxStreamBuffer->xLength + pxStreamBuffer->xTail;
-        xSpace -= pxStreamBuffer->xHead;
+        xSpace -= sbGET_WRITE_INDEX( pxStreamBuffer );
     } while( xOriginalTail != pxStreamBuffer->xTail );
 
     xSpace -= ( size_t ) 1;
@@ -805,15 +979,73 @@ size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer )
 }
 /*-----------------------------------------------------------*/
 
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+                               size_t xRequiredSpace,
+                               TickType_t xTicksToWait )
+{
+    size_t xSpace = 0;
+    TimeOut_t xTimeOut;
+
+    if( xTicksToWait != ( TickType_t ) 0 )
+    {
+        vTaskSetTimeOutState( &xTimeOut );
+
+        do
+        {
+            /* Wait until the required number of bytes are free in the message
+             * buffer. */
+            taskENTER_CRITICAL();
+            {
+                xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+                if( xSpace < xRequiredSpace )
+                {
+                    /* Clear notification state as going to wait for space. */
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+
+                    /* Should only be one writer. */
+                    configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+                    pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    taskEXIT_CRITICAL();
+                    break;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+            ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            pxStreamBuffer->xTaskWaitingToSend = NULL;
+        } while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( xSpace == ( size_t ) 0 )
+    {
+        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xSpace;
+}
+/*-----------------------------------------------------------*/
+
 size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
                           const void * pvTxData,
                           size_t xDataLengthBytes,
                           TickType_t xTicksToWait )
 {
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xReturn, xSpace = 0;
+    size_t xReturn, xSpace;
     size_t xRequiredSpace = xDataLengthBytes;
-    TimeOut_t xTimeOut;
     size_t xMaxReportedSpace = 0;
 
     traceENTER_xStreamBufferSend( xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait );
@@ -864,56 +1096,18 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         }
     }
 
-    if( xTicksToWait != ( TickType_t ) 0 )
-    {
-        vTaskSetTimeOutState( &xTimeOut );
-
-        do
+    #if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_WRITER ) != ( uint8_t ) 0 )
         {
-            /* Wait until the required number of bytes are free in the message
-             * buffer. */
-            taskENTER_CRITICAL();
-            {
-                xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-
-                if( xSpace < xRequiredSpace )
-                {
-                    /* Clear notification state as going to wait for space. */
-                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
-
-                    /* Should only be one writer. */
-                    configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
-                    pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
-                }
-                else
-                {
-                    taskEXIT_CRITICAL();
-                    break;
-                }
-            }
-            taskEXIT_CRITICAL();
-
-            traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
-            ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
-            pxStreamBuffer->xTaskWaitingToSend = NULL;
-        } while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
-    }
-    else
-    {
-        mtCOVERAGE_TEST_MARKER();
-    }
-
-    if( xSpace == ( size_t ) 0 )
-    {
-        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-    }
-    else
+            xReturn = prvSendToMultiWriterBuffer( pxStreamBuffer, pvTxData, xRequiredSpace, xTicksToWait );
+        }
+        else
+    #endif /* configUSE_STREAM_BUFFER_MULTI_WRITER */
     {
-        mtCOVERAGE_TEST_MARKER();
+        xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
+        xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
     }
 
-    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
-
     if( xReturn > ( size_t ) 0 )
     {
         traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
@@ -949,6 +1143,11 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
     size_t xReturn, xSpace;
     size_t xRequiredSpace = xDataLengthBytes;
 
+    #if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+        size_t xStart;
+        UBaseType_t uxSavedStatus;
+    #endif
+
     traceENTER_xStreamBufferSendFromISR( xStreamBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken );
 
     configASSERT( pvTxData );
@@ -967,8 +1166,34 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
         mtCOVERAGE_TEST_MARKER();
     }
 
-    xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+    #if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_WRITER ) != ( uint8_t ) 0 )
+        {
+            /* An interrupt cannot wait for space, so writes as many bytes as
+             * are free. */
+            xReturn = prvReserveSpace( pxStreamBuffer, xRequiredSpace, ( size_t ) 1, &xStart );
+
+            if( xReturn > ( size_t ) 0 )
+            {
+                ( void ) prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xReturn, xStart );
+
+                uxSavedStatus = taskENTER_CRITICAL_FROM_ISR();
+                {
+                    prvPublishReservation( pxStreamBuffer );
+                }
+                taskEXIT_CRITICAL_FROM_ISR( uxSavedStatus );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+    #endif /* configUSE_STREAM_BUFFER_MULTI_WRITER */
+    {
+        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+        xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+    }
 
     if( xReturn > ( size_t ) 0 )
     {
@@ -1148,6 +1373,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         {
             traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
             prvRECEIVE_COMPLETED( xStreamBuffer );
+            prvUNBLOCK_WAITING_WRITERS( pxStreamBuffer );
         }
         else
         {
@@ -1255,6 +1481,7 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
             /* coverity[misra_c_2012_directive_4_7_violation] */
             prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            prvUNBLOCK_WAITING_WRITERS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
         }
         else
         {
@@ -1328,91 +1555,1119 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
-{
-    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    BaseType_t xReturn;
-    size_t xTail;
+#if ( configUSE_STREAM_BUFFER_ZERO_COPY == 1 )
 
-    traceENTER_xStreamBufferIsEmpty( xStreamBuffer );
+    size_t xStreamBufferGetWriteWindow( StreamBufferHandle_t xStreamBuffer,
+                                        StreamBufferWindow_t * const pxWindow,
+                                        TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn, xSpace;
 
-    configASSERT( pxStreamBuffer );
+        traceENTER_xStreamBufferGetWriteWindow( xStreamBuffer, pxWindow, xTicksToWait );
 
-    /* True if no bytes are available. */
-    xTail = pxStreamBuffer->xTail;
+        configASSERT( pxStreamBuffer );
+        configASSERT( pxWindow );
 
-    if( pxStreamBuffer->xHead == xTail )
-    {
-        xReturn = pdTRUE;
-    }
-    else
-    {
-        xReturn = pdFALSE;
-    }
+        /* Message buffers store the length of each message in front of it, so
+         * cannot be written in place.  Multi-writer buffers must reserve space
+         * before writing to it. */
+        configASSERT( ( pxStreamBuffer->ucFlags & ( sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_WRITER ) ) == ( uint8_t ) 0 );
 
-    traceRETURN_xStreamBufferIsEmpty( xReturn );
+        /* Wait until there is space for at least one byte. */
+        xSpace = prvWaitForSpace( pxStreamBuffer, ( size_t ) 1, xTicksToWait );
 
-    return xReturn;
-}
+        /* The free space always starts at the head. */
+        xReturn = prvGetWindow( pxStreamBuffer, pxStreamBuffer->xHead, xSpace, pxWindow );
+
+        traceRETURN_xStreamBufferGetWriteWindow( xReturn );
+
+        return xReturn;
+    }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
-{
-    BaseType_t xReturn;
-    size_t xBytesToStoreMessageLength;
-    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xStreamBufferGetWriteWindowFromISR( StreamBufferHandle_t xStreamBuffer,
+                                               StreamBufferWindow_t * const pxWindow )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
 
-    traceENTER_xStreamBufferIsFull( xStreamBuffer );
+        traceENTER_xStreamBufferGetWriteWindowFromISR( xStreamBuffer, pxWindow );
 
-    configASSERT( pxStreamBuffer );
+        configASSERT( pxStreamBuffer );
+        configASSERT( pxWindow );
+        configASSERT( ( pxStreamBuffer->ucFlags & ( sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_WRITER ) ) == ( uint8_t ) 0 );
 
-    /* This generic version of the receive function is used by both message
-     * buffers, which store discrete messages, and stream buffers, which store a
-     * continuous stream of bytes.  Discrete messages include an additional
-     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the message. */
-    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
-    {
-        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
-    }
-    else
-    {
-        xBytesToStoreMessageLength = 0;
-    }
+        xReturn = prvGetWindow( pxStreamBuffer, pxStreamBuffer->xHead, xStreamBufferSpacesAvailable( pxStreamBuffer ), pxWindow );
 
-    /* True if the available space equals zero. */
-    if( xStreamBufferSpacesAvailable( xStreamBuffer ) <= xBytesToStoreMessageLength )
-    {
-        xReturn = pdTRUE;
+        traceRETURN_xStreamBufferGetWriteWindowFromISR( xReturn );
+
+        return xReturn;
     }
-    else
+/*-----------------------------------------------------------*/
+
+    BaseType_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+                                         size_t xBytesWritten )
     {
-        xReturn = pdFALSE;
-    }
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
+        size_t xNextHead;
 
-    traceRETURN_xStreamBufferIsFull( xReturn );
+        traceENTER_xStreamBufferCommitWrite( xStreamBuffer, xBytesWritten );
 
-    return xReturn;
-}
-/*-----------------------------------------------------------*/
+        configASSERT( pxStreamBuffer );
 
-BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
-                                              BaseType_t * pxHigherPriorityTaskWoken )
-{
-    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    BaseType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
+        /* Only the writer moves the head, and the reader can only make more
+         * space available, so the check cannot be invalidated before the head
+         * is updated. */
+        if( ( xBytesWritten > ( size_t ) 0 ) && ( xBytesWritten <= xStreamBufferSpacesAvailable( pxStreamBuffer ) ) )
+        {
+            xNextHead = pxStreamBuffer->xHead + xBytesWritten;
 
-    traceENTER_xStreamBufferSendCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken );
+            if( xNextHead >= pxStreamBuffer->xLength )
+            {
+                xNextHead -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-    configASSERT( pxStreamBuffer );
+            pxStreamBuffer->xHead = xNextHead;
 
-    /* MISRA Ref 4.7.1 [Return value shall be checked] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-    /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
-    {
-        if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
-        {
+            traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesWritten );
+
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+            {
+                prvSEND_COMPLETED( pxStreamBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        traceRETURN_xStreamBufferCommitWrite( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                size_t xBytesWritten,
+                                                BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
+        size_t xNextHead;
+
+        traceENTER_xStreamBufferCommitWriteFromISR( xStreamBuffer, xBytesWritten, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxStreamBuffer );
+
+        if( ( xBytesWritten > ( size_t ) 0 ) && ( xBytesWritten <= xStreamBufferSpacesAvailable( pxStreamBuffer ) ) )
+        {
+            xNextHead = pxStreamBuffer->xHead + xBytesWritten;
+
+            if( xNextHead >= pxStreamBuffer->xLength )
+            {
+                xNextHead -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xHead = xNextHead;
+
+            traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesWritten );
+
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+            {
+                /* MISRA Ref 4.7.1 [Return value shall be checked] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+                /* coverity[misra_c_2012_directive_4_7_violation] */
+                prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        traceRETURN_xStreamBufferCommitWriteFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xStreamBufferGetReadWindow( StreamBufferHandle_t xStreamBuffer,
+                                       StreamBufferWindow_t * const pxWindow,
+                                       TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn, xBytesAvailable, xBytesToWaitFor;
+
+        traceENTER_xStreamBufferGetReadWindow( xStreamBuffer, pxWindow, xTicksToWait );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( pxWindow );
+
+        /* Message buffers store the length of each message in front of it, so
+         * cannot be read in place. */
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+        /* As in xStreamBufferReceive(), a batching buffer must hold more than
+         * the trigger level before the reader is unblocked. */
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_BATCHING_BUFFER ) != ( uint8_t ) 0 )
+        {
+            xBytesToWaitFor = pxStreamBuffer->xTriggerLevelBytes;
+        }
+        else
+        {
+            xBytesToWaitFor = 0;
+        }
+
+        xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToWaitFor, xTicksToWait );
+
+        /* The data always starts at the tail. */
+        xReturn = prvGetWindow( pxStreamBuffer, pxStreamBuffer->xTail, xBytesAvailable, pxWindow );
+
+        traceRETURN_xStreamBufferGetReadWindow( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xStreamBufferGetReadWindowFromISR( StreamBufferHandle_t xStreamBuffer,
+                                              StreamBufferWindow_t * const pxWindow )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferGetReadWindowFromISR( xStreamBuffer, pxWindow );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( pxWindow );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+        xReturn = prvGetWindow( pxStreamBuffer, pxStreamBuffer->xTail, prvBytesInBuffer( pxStreamBuffer ), pxWindow );
+
+        traceRETURN_xStreamBufferGetReadWindowFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xBytesConsumed )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
+        size_t xNextTail;
+
+        traceENTER_xStreamBufferConsume( xStreamBuffer, xBytesConsumed );
+
+        configASSERT( pxStreamBuffer );
+
+        /* Only the reader moves the tail, and the writer can only add more
+         * data, so the check cannot be invalidated before the tail is
+         * updated. */
+        if( ( xBytesConsumed > ( size_t ) 0 ) && ( xBytesConsumed <= prvBytesInBuffer( pxStreamBuffer ) ) )
+        {
+            xNextTail = pxStreamBuffer->xTail + xBytesConsumed;
+
+            if( xNextTail >= pxStreamBuffer->xLength )
+            {
+                xNextTail -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xTail = xNextTail;
+
+            traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xBytesConsumed );
+
+            /* Was a task waiting for space in the buffer? */
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
+            prvUNBLOCK_WAITING_WRITERS( pxStreamBuffer );
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        traceRETURN_xStreamBufferConsume( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            size_t xBytesConsumed,
+                                            BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
+        size_t xNextTail;
+
+        traceENTER_xStreamBufferConsumeFromISR( xStreamBuffer, xBytesConsumed, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxStreamBuffer );
+
+        if( ( xBytesConsumed > ( size_t ) 0 ) && ( xBytesConsumed <= prvBytesInBuffer( pxStreamBuffer ) ) )
+        {
+            xNextTail = pxStreamBuffer->xTail + xBytesConsumed;
+
+            if( xNextTail >= pxStreamBuffer->xLength )
+            {
+                xNextTail -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xTail = xNextTail;
+
+            traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xBytesConsumed );
+
+            /* Was a task waiting for space in the buffer? */
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            prvUNBLOCK_WAITING_WRITERS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        traceRETURN_xStreamBufferConsumeFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+                               const StreamBufferSegment_t * pxSegments,
+                               size_t xSegmentCount,
+                               TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn, xSpace, xDataLengthBytes, xRequiredSpace;
+        size_t xMaxReportedSpace;
+
+        traceENTER_xStreamBufferSendV( xStreamBuffer, pxSegments, xSegmentCount, xTicksToWait );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxSegments != NULL ) || ( xSegmentCount == ( size_t ) 0 ) );
+
+        /* Multi-writer buffers must reserve space before writing to it. */
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_WRITER ) == ( uint8_t ) 0 );
+
+        xDataLengthBytes = prvSegmentsLength( pxSegments, xSegmentCount );
+        xRequiredSpace = xDataLengthBytes;
+        xMaxReportedSpace = pxStreamBuffer->xLength - ( size_t ) 1;
+
+        /* Size the write exactly as xStreamBufferSend() would size a write of
+         * the same total length. */
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+            /* Overflow? */
+            configASSERT( xRequiredSpace > xDataLengthBytes );
+
+            if( xRequiredSpace > xMaxReportedSpace )
+            {
+                /* The message would not fit even if the entire buffer was
+                 * empty, so don't wait for space. */
+                xTicksToWait = ( TickType_t ) 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            if( xRequiredSpace > xMaxReportedSpace )
+            {
+                xRequiredSpace = xMaxReportedSpace;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
+        xReturn = prvWriteSegmentsToBuffer( pxStreamBuffer, pxSegments, xSegmentCount, xDataLengthBytes, xSpace, xRequiredSpace );
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+            {
+                prvSEND_COMPLETED( pxStreamBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+            traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
+        }
+
+        traceRETURN_xStreamBufferSendV( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                      const StreamBufferSegment_t * pxSegments,
+                                      size_t xSegmentCount,
+                                      BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn, xSpace, xDataLengthBytes, xRequiredSpace;
+
+        traceENTER_xStreamBufferSendVFromISR( xStreamBuffer, pxSegments, xSegmentCount, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxSegments != NULL ) || ( xSegmentCount == ( size_t ) 0 ) );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_WRITER ) == ( uint8_t ) 0 );
+
+        xDataLengthBytes = prvSegmentsLength( pxSegments, xSegmentCount );
+        xRequiredSpace = xDataLengthBytes;
+
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+        xReturn = prvWriteSegmentsToBuffer( pxStreamBuffer, pxSegments, xSegmentCount, xDataLengthBytes, xSpace, xRequiredSpace );
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+            {
+                /* MISRA Ref 4.7.1 [Return value shall be checked] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+                /* coverity[misra_c_2012_directive_4_7_violation] */
+                prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+        traceRETURN_xStreamBufferSendVFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xStreamBufferPeekMessage( StreamBufferHandle_t xStreamBuffer,
+                                     StreamBufferWindow_t * const pxWindow,
+                                     TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn, xStart;
+        configMESSAGE_BUFFER_LENGTH_TYPE xTempLength;
+
+        traceENTER_xStreamBufferPeekMessage( xStreamBuffer, pxWindow, xTicksToWait );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( pxWindow );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 );
+
+        /* Messages are written whole, so a buffer holding more than the length
+         * of a message length holds at least one complete message. */
+        if( prvWaitForData( pxStreamBuffer, sbBYTES_TO_STORE_MESSAGE_LENGTH, xTicksToWait ) > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+        {
+            /* Read the length without moving the tail.  The message itself
+             * follows its length. */
+            xStart = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
+            xReturn = prvGetWindow( pxStreamBuffer, xStart, ( size_t ) xTempLength, pxWindow );
+        }
+        else
+        {
+            xReturn = prvGetWindow( pxStreamBuffer, pxStreamBuffer->xTail, ( size_t ) 0, pxWindow );
+        }
+
+        traceRETURN_xStreamBufferPeekMessage( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xStreamBufferPeekMessageFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            StreamBufferWindow_t * const pxWindow )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn, xStart;
+        configMESSAGE_BUFFER_LENGTH_TYPE xTempLength;
+
+        traceENTER_xStreamBufferPeekMessageFromISR( xStreamBuffer, pxWindow );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( pxWindow );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 );
+
+        if( prvBytesInBuffer( pxStreamBuffer ) > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+        {
+            xStart = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
+            xReturn = prvGetWindow( pxStreamBuffer, xStart, ( size_t ) xTempLength, pxWindow );
+        }
+        else
+        {
+            xReturn = prvGetWindow( pxStreamBuffer, pxStreamBuffer->xTail, ( size_t ) 0, pxWindow );
+        }
+
+        traceRETURN_xStreamBufferPeekMessageFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xStreamBufferDiscardMessage( StreamBufferHandle_t xStreamBuffer )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
+
+        traceENTER_xStreamBufferDiscardMessage( xStreamBuffer );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 );
+
+        xReturn = prvDiscardMessage( pxStreamBuffer );
+
+        if( xReturn == pdPASS )
+        {
+            /* Was a task waiting for space in the buffer? */
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferDiscardMessage( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xStreamBufferDiscardMessageFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                   BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
+
+        traceENTER_xStreamBufferDiscardMessageFromISR( xStreamBuffer, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 );
+
+        xReturn = prvDiscardMessage( pxStreamBuffer );
+
+        if( xReturn == pdPASS )
+        {
+            /* Was a task waiting for space in the buffer? */
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferDiscardMessageFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvDiscardMessage( StreamBuffer_t * const pxStreamBuffer )
+    {
+        BaseType_t xReturn;
+        size_t xNextTail;
+        configMESSAGE_BUFFER_LENGTH_TYPE xTempLength;
+
+        /* Only the reader moves the tail, so the message cannot be removed
+         * between checking for it and discarding it. */
+        if( prvBytesInBuffer( pxStreamBuffer ) > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+        {
+            xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
+            xNextTail += ( size_t ) xTempLength;
+
+            if( xNextTail >= pxStreamBuffer->xLength )
+            {
+                xNextTail -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xTail = xNextTail;
+
+            traceSTREAM_BUFFER_RECEIVE( pxStreamBuffer, ( size_t ) xTempLength );
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            traceSTREAM_BUFFER_RECEIVE_FAILED( pxStreamBuffer );
+            xReturn = pdFAIL;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static size_t prvSegmentsLength( const StreamBufferSegment_t * pxSegments,
+                                     size_t xSegmentCount )
+    {
+        size_t x, xTotal = 0;
+
+        for( x = 0; x < xSegmentCount; x++ )
+        {
+            configASSERT( ( pxSegments[ x ].pvData != NULL ) || ( pxSegments[ x ].xLength == ( size_t ) 0 ) );
+
+            xTotal += pxSegments[ x ].xLength;
+
+            /* Overflow? */
+            configASSERT( xTotal >= pxSegments[ x ].xLength );
+        }
+
+        return xTotal;
+    }
+/*-----------------------------------------------------------*/
+
+    static size_t prvWriteSegmentsToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                            const StreamBufferSegment_t * pxSegments,
+                                            size_t xSegmentCount,
+                                            size_t xDataLengthBytes,
+                                            size_t xSpace,
+                                            size_t xRequiredSpace )
+    {
+        size_t xNextHead = pxStreamBuffer->xHead;
+        size_t x, xBytesLeft, xCount;
+        configMESSAGE_BUFFER_LENGTH_TYPE xMessageLength;
+
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            /* Convert xDataLengthBytes to the message length type. */
+            xMessageLength = ( configMESSAGE_BUFFER_LENGTH_TYPE ) xDataLengthBytes;
+
+            /* Ensure the data length given fits within configMESSAGE_BUFFER_LENGTH_TYPE. */
+            configASSERT( ( size_t ) xMessageLength == xDataLengthBytes );
+
+            if( xSpace >= xRequiredSpace )
+            {
+                xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xMessageLength ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
+            }
+            else
+            {
+                /* Not enough space, so do not write data to the buffer. */
+                xDataLengthBytes = 0;
+            }
+        }
+        else
+        {
+            /* A stream buffer takes as many of the leading bytes as fit. */
+            xDataLengthBytes = configMIN( xDataLengthBytes, xSpace );
+        }
+
+        if( xDataLengthBytes != ( size_t ) 0 )
+        {
+            /* Copy each segment straight into the buffer, then publish them
+             * all at once by moving the head, so the reader never sees part of
+             * the write. */
+            xBytesLeft = xDataLengthBytes;
+
+            for( x = 0; ( x < xSegmentCount ) && ( xBytesLeft > ( size_t ) 0 ); x++ )
+            {
+                xCount = configMIN( pxSegments[ x ].xLength, xBytesLeft );
+
+                if( xCount > ( size_t ) 0 )
+                {
+                    /* MISRA Ref 11.5.5 [Void pointer assignment] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                    /* coverity[misra_c_2012_rule_11_5_violation] */
+                    xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pxSegments[ x ].pvData, xCount, xNextHead );
+                    xBytesLeft -= xCount;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            pxStreamBuffer->xHead = xNextHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xDataLengthBytes;
+    }
+/*-----------------------------------------------------------*/
+
+    static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+                                  size_t xBytesToWaitFor,
+                                  TickType_t xTicksToWait )
+    {
+        size_t xBytesAvailable;
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            /* Checking if there is data and clearing the notification state
+             * must be performed atomically. */
+            taskENTER_CRITICAL();
+            {
+                xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+                if( xBytesAvailable <= xBytesToWaitFor )
+                {
+                    /* Clear notification state as going to wait for data. */
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+
+                    /* Should only be one reader. */
+                    configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                    pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xBytesAvailable <= xBytesToWaitFor )
+            {
+                /* Wait for data to be available. */
+                traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+                ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+                pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+                /* Recheck the data available after blocking. */
+                xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+        }
+
+        return xBytesAvailable;
+    }
+/*-----------------------------------------------------------*/
+
+    static size_t prvGetWindow( const StreamBuffer_t * const pxStreamBuffer,
+                                size_t xStart,
+                                size_t xCount,
+                                StreamBufferWindow_t * const pxWindow )
+    {
+        /* The first region runs from xStart to the end of the buffer at most.
+         * Anything left over continues from the start of the buffer. */
+        pxWindow->pucFirst = &( pxStreamBuffer->pucBuffer[ xStart ] );
+        pxWindow->xFirstLength = configMIN( pxStreamBuffer->xLength - xStart, xCount );
+
+        if( xCount > pxWindow->xFirstLength )
+        {
+            pxWindow->pucSecond = pxStreamBuffer->pucBuffer;
+            pxWindow->xSecondLength = xCount - pxWindow->xFirstLength;
+        }
+        else
+        {
+            pxWindow->pucSecond = NULL;
+            pxWindow->xSecondLength = 0;
+        }
+
+        return xCount;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+
+    static size_t prvReserveSpace( StreamBuffer_t * const pxStreamBuffer,
+                                   size_t xMaxCount,
+                                   size_t xMinCount,
+                                   size_t * const pxStart )
+    {
+        uint32_t ulReservation, ulNewReservation;
+        size_t xIndex, xNextIndex, xSpace, xCount;
+
+        for( ; ; )
+        {
+            ulReservation = pxStreamBuffer->ulReservation;
+            xIndex = ( size_t ) ( ulReservation >> sbRESERVATION_INDEX_SHIFT );
+
+            /* Only the reader moves the tail, and only ever frees space, so
+             * the space calculated here can be less than, but never more than,
+             * the space actually free. */
+            xSpace = pxStreamBuffer->xLength + pxStreamBuffer->xTail;
+            xSpace -= xIndex + ( size_t ) 1;
+
+            if( xSpace >= pxStreamBuffer->xLength )
+            {
+                xSpace -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xCount = configMIN( xSpace, xMaxCount );
+
+            if( ( xCount == ( size_t ) 0 ) || ( xCount < xMinCount ) )
+            {
+                xCount = 0;
+                break;
+            }
+
+            /* The count of writers filling their space must not overflow into
+             * the index. */
+            configASSERT( ( ulReservation & sbRESERVATION_WRITER_MASK ) != sbRESERVATION_WRITER_MASK );
+
+            xNextIndex = xIndex + xCount;
+
+            if( xNextIndex >= pxStreamBuffer->xLength )
+            {
+                xNextIndex -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ulNewReservation = ( ( uint32_t ) xNextIndex << sbRESERVATION_INDEX_SHIFT ) | ( ( ulReservation & sbRESERVATION_WRITER_MASK ) + 1U );
+
+            if( Atomic_CompareAndSwap_u32( &( pxStreamBuffer->ulReservation ), ulNewReservation, ulReservation ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+            {
+                *pxStart = xIndex;
+                break;
+            }
+            else
+            {
+                /* Another writer reserved space first. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xCount;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvPublishReservation( StreamBuffer_t * const pxStreamBuffer )
+    {
+        uint32_t ulReservation;
+
+        /* Writers on other cores can still reserve space, so the count must be
+         * decremented atomically. */
+        do
+        {
+            ulReservation = pxStreamBuffer->ulReservation;
+        } while( Atomic_CompareAndSwap_u32( &( pxStreamBuffer->ulReservation ), ulReservation - 1U, ulReservation ) != ATOMIC_COMPARE_AND_SWAP_SUCCESS );
+
+        if( ( ( ulReservation - 1U ) & sbRESERVATION_WRITER_MASK ) == ( uint32_t ) 0U )
+        {
+            /* No other writer is filling its space, so every byte up to the
+             * reservation index has been written.  The bytes must be complete
+             * before the reader can see them. */
+            portMEMORY_BARRIER();
+            pxStreamBuffer->xHead = ( size_t ) ( ulReservation >> sbRESERVATION_INDEX_SHIFT );
+        }
+        else
+        {
+            /* The last writer to finish publishes these bytes with its own. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static size_t prvSendToMultiWriterBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                              const void * pvTxData,
+                                              size_t xRequiredSpace,
+                                              TickType_t xTicksToWait )
+    {
+        TimeOut_t xTimeOut;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xBlocked;
+        size_t xReturn, xStart = 0;
+
+        for( ; ; )
+        {
+            /* Wait for all the bytes to fit, as for a single writer.  Once the
+             * block time has expired write as many bytes as are free. */
+            xReturn = prvReserveSpace( pxStreamBuffer, xRequiredSpace, ( xTicksToWait != ( TickType_t ) 0 ) ? xRequiredSpace : ( size_t ) 1, &xStart );
+
+            if( ( xReturn > ( size_t ) 0 ) || ( xTicksToWait == ( TickType_t ) 0 ) || ( xRequiredSpace == ( size_t ) 0 ) )
+            {
+                break;
+            }
+
+            if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+
+            xBlocked = pdFALSE;
+
+            /* The reader can remove bytes from an interrupt, so checking for
+             * space and joining the list of waiting writers is performed from
+             * a critical section. */
+            vTaskSuspendAll();
+            {
+                taskENTER_CRITICAL();
+                {
+                    if( xStreamBufferSpacesAvailable( pxStreamBuffer ) < xRequiredSpace )
+                    {
+                        traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+                        vTaskPlaceOnEventList( &( pxStreamBuffer->xTasksWaitingToSend ), xTicksToWait );
+                        xBlocked = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Space was freed since it was last checked. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+            }
+
+            if( ( xTaskResumeAll() == pdFALSE ) && ( xBlocked != pdFALSE ) )
+            {
+                taskYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* xTaskCheckForTimeOut() sets xTicksToWait to zero on timeout. */
+            ( void ) xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
+        }
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            /* The reserved space belongs to this writer alone, so can be filled
+             * while other writers fill theirs. */
+            ( void ) prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xReturn, xStart );
+
+            taskENTER_CRITICAL();
+            {
+                prvPublishReservation( pxStreamBuffer );
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvUnblockWaitingWriters( StreamBuffer_t * const pxStreamBuffer )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
+
+        /* A writer joins the list from a critical section after finding too
+         * little space, so the list is only checked from a critical section
+         * too.  The space freed might be enough for several writers, so all
+         * are unblocked to check again. */
+        taskENTER_CRITICAL();
+        {
+            while( listLIST_IS_EMPTY( &( pxStreamBuffer->xTasksWaitingToSend ) ) == pdFALSE )
+            {
+                if( xTaskRemoveFromEventList( &( pxStreamBuffer->xTasksWaitingToSend ) ) != pdFALSE )
+                {
+                    xYieldRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvUnblockWaitingWritersFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                                 BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            while( listLIST_IS_EMPTY( &( pxStreamBuffer->xTasksWaitingToSend ) ) == pdFALSE )
+            {
+                if( ( xTaskRemoveFromEventList( &( pxStreamBuffer->xTasksWaitingToSend ) ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    }
+
+#endif /* configUSE_STREAM_BUFFER_MULTI_WRITER */
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
+{
+    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    BaseType_t xReturn;
+    size_t xTail;
+
+    traceENTER_xStreamBufferIsEmpty( xStreamBuffer );
+
+    configASSERT( pxStreamBuffer );
+
+    /* True if no bytes are available. */
+    xTail = pxStreamBuffer->xTail;
+
+    if( pxStreamBuffer->xHead == xTail )
+    {
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    traceRETURN_xStreamBufferIsEmpty( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
+{
+    BaseType_t xReturn;
+    size_t xBytesToStoreMessageLength;
+    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+    traceENTER_xStreamBufferIsFull( xStreamBuffer );
+
+    configASSERT( pxStreamBuffer );
+
+    /* This generic version of the receive function is used by both message
+     * buffers, which store discrete messages, and stream buffers, which store a
+     * continuous stream of bytes.  Discrete messages include an additional
+     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the message. */
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+    }
+    else
+    {
+        xBytesToStoreMessageLength = 0;
+    }
+
+    /* True if the available space equals zero. */
+    if( xStreamBufferSpacesAvailable( xStreamBuffer ) <= xBytesToStoreMessageLength )
+    {
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    traceRETURN_xStreamBufferIsFull( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
+                                              BaseType_t * pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    BaseType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    traceENTER_xStreamBufferSendCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxStreamBuffer );
+
+    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    {
+        if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
+        {
             ( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,
                                                 ( pxStreamBuffer )->uxNotificationIndex,
                                                 ( uint32_t ) 0,
@@ -1611,6 +2866,13 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
     pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
     pxStreamBuffer->ucFlags = ucFlags;
     pxStreamBuffer->uxNotificationIndex = tskDEFAULT_INDEX_TO_NOTIFY;
+
+    #if ( configUSE_STREAM_BUFFER_MULTI_WRITER == 1 )
+    {
+        vListInitialise( &( pxStreamBuffer->xTasksWaitingToSend ) );
+    }
+    #endif
+
     #if ( configUSE_SB_COMPLETED_CALLBACK == 1 )
     {
         pxStreamBuffer->pxSendCompletedCallback = pxSendCompletedCallback;
@@ -1666,6 +2928,35 @@ void vStreamBufferSetStreamBufferNotificationIndex( StreamBufferHandle_t xStream
 
     traceRETURN_vStreamBufferSetStreamBufferNotificationIndex();
 }
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_WAIT_ANY == 1 )
+
+    UBaseType_t uxStreamBufferSetWaitingReceiverRestricted( StreamBufferHandle_t xStreamBuffer,
+                                                            TaskHandle_t xTask )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+        traceENTER_uxStreamBufferSetWaitingReceiverRestricted( xStreamBuffer, xTask );
+
+        /* This function should not be called by application code hence the
+         * 'Restricted' in its name.  It is not part of the public API.  It is
+         * used by xTaskWaitAny() to register xTask as the task notified when
+         * data is sent, or to cancel the registration when xTask is NULL, and
+         * must be called from a critical section. */
+        configASSERT( pxStreamBuffer );
+
+        /* Only one task can receive from a stream buffer at a time. */
+        configASSERT( ( xTask == NULL ) || ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) );
+
+        pxStreamBuffer->xTaskWaitingToReceive = xTask;
+
+        traceRETURN_uxStreamBufferSetWaitingReceiverRestricted( pxStreamBuffer->uxNotificationIndex );
+
+        return pxStreamBuffer->uxNotificationIndex;
+    }
+
+#endif /* configUSE_WAIT_ANY */
 /*-----------------------------------------------------------*/
 
     #if ( configUSE_TRACE_FACILITY == 1 )
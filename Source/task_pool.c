@@ -0,0 +1,530 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_pool.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include task pool functionality. This #if is closed at the very bottom of
+ * this file. If you want to include task pools then ensure configUSE_TASK_POOL
+ * is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_TASK_POOL == 1 )
+
+/* A job held in a worker's queue, together with the future that tracks it. */
+    typedef struct TaskPoolQueuedJob
+    {
+        TaskPoolJob_t xJob;
+        TaskPoolFuture_t * pxFuture;
+    } TaskPoolQueuedJob_t;
+
+/* The state of one worker task.  The queue is a ring buffer of
+ * uxJobsPerWorker entries, and is only accessed from a critical section as it
+ * can be written by any submitting task and read by any worker. */
+    typedef struct TaskPoolWorker
+    {
+        TaskHandle_t xTask;           /**< The worker task. */
+        TaskPoolQueuedJob_t * pxJobs; /**< Storage for the worker's queue. */
+        UBaseType_t uxHead;           /**< Index of the oldest job in the queue. */
+        UBaseType_t uxCount;          /**< Number of jobs in the queue. */
+        struct TaskPoolDef_t * pxPool;
+    } TaskPoolWorker_t;
+
+    typedef struct TaskPoolDef_t
+    {
+        TaskPoolWorker_t * pxWorkers;
+        UBaseType_t uxWorkerCount;
+        UBaseType_t uxJobsPerWorker;
+        UBaseType_t uxNextWorker; /**< The worker that receives the next submission.  Only used to balance the load, so not protected. */
+    } TaskPool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The function executed by each worker task.
+ */
+    static portTASK_FUNCTION_PROTO( prvTaskPoolWorker, pvParameters );
+
+/*
+ * Append up to uxJobCount jobs to the queue of pxWorker, recording them in
+ * pxFuture if it is not NULL.  Returns the number of jobs appended, which is
+ * less than uxJobCount if the queue becomes full.
+ */
+    static UBaseType_t prvQueueJobs( TaskPoolWorker_t * pxWorker,
+                                     const TaskPoolJob_t * pxJobs,
+                                     UBaseType_t uxJobCount,
+                                     TaskPoolFuture_t * pxFuture ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove the oldest job from the queue of pxWorker or, if that queue is
+ * empty, from the queue of another worker in the same pool.  Returns pdFALSE
+ * if all the queues are empty.
+ */
+    static BaseType_t prvTakeJob( TaskPoolWorker_t * pxWorker,
+                                  TaskPoolQueuedJob_t * pxQueuedJob ) PRIVILEGED_FUNCTION;
+
+/*
+ * Record the completion of a job in pxFuture, and notify the task waiting on
+ * the future if it was the last outstanding job.
+ */
+    static void prvCompleteJob( TaskPoolFuture_t * pxFuture ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        TaskPoolHandle_t xTaskPoolCreate( const char * const pcName,
+                                          UBaseType_t uxWorkerCount,
+                                          UBaseType_t uxJobsPerWorker,
+                                          configSTACK_DEPTH_TYPE uxStackDepth,
+                                          UBaseType_t uxPriority )
+        {
+            TaskPool_t * pxPool;
+            TaskPoolQueuedJob_t * pxJobStorage;
+            UBaseType_t uxWorker;
+            BaseType_t xCreated = pdPASS;
+
+            traceENTER_xTaskPoolCreate( pcName, uxWorkerCount, uxJobsPerWorker, uxStackDepth, uxPriority );
+
+            configASSERT( uxWorkerCount > ( UBaseType_t ) 0U );
+            configASSERT( uxJobsPerWorker > ( UBaseType_t ) 0U );
+            configASSERT( configTASK_POOL_NOTIFICATION_INDEX < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+            /* The pool, the worker structures and the queue storage are
+             * allocated in one block.  All three contain only pointers and
+             * UBaseType_t members, so the worker structures and the queue
+             * storage are suitably aligned when placed one after the other. */
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxPool = ( TaskPool_t * ) pvPortMalloc( sizeof( TaskPool_t ) +
+                                                    ( ( size_t ) uxWorkerCount * sizeof( TaskPoolWorker_t ) ) +
+                                                    ( ( size_t ) uxWorkerCount * ( size_t ) uxJobsPerWorker * sizeof( TaskPoolQueuedJob_t ) ) );
+
+            if( pxPool != NULL )
+            {
+                pxPool->pxWorkers = ( TaskPoolWorker_t * ) &( pxPool[ 1 ] );
+                pxPool->uxWorkerCount = uxWorkerCount;
+                pxPool->uxJobsPerWorker = uxJobsPerWorker;
+                pxPool->uxNextWorker = ( UBaseType_t ) 0U;
+
+                pxJobStorage = ( TaskPoolQueuedJob_t * ) &( pxPool->pxWorkers[ uxWorkerCount ] );
+
+                /* Initialise every worker before any worker task is created, as
+                 * a worker looks at the queues of the other workers. */
+                for( uxWorker = ( UBaseType_t ) 0U; uxWorker < uxWorkerCount; uxWorker++ )
+                {
+                    pxPool->pxWorkers[ uxWorker ].xTask = NULL;
+                    pxPool->pxWorkers[ uxWorker ].pxJobs = &( pxJobStorage[ uxWorker * uxJobsPerWorker ] );
+                    pxPool->pxWorkers[ uxWorker ].uxHead = ( UBaseType_t ) 0U;
+                    pxPool->pxWorkers[ uxWorker ].uxCount = ( UBaseType_t ) 0U;
+                    pxPool->pxWorkers[ uxWorker ].pxPool = pxPool;
+                }
+
+                for( uxWorker = ( UBaseType_t ) 0U; uxWorker < uxWorkerCount; uxWorker++ )
+                {
+                    xCreated = xTaskCreate( prvTaskPoolWorker, pcName, uxStackDepth, ( void * ) &( pxPool->pxWorkers[ uxWorker ] ), uxPriority, &( pxPool->pxWorkers[ uxWorker ].xTask ) );
+
+                    if( xCreated != pdPASS )
+                    {
+                        break;
+                    }
+                }
+
+                if( xCreated != pdPASS )
+                {
+                    #if ( INCLUDE_vTaskDelete == 1 )
+                    {
+                        /* Remove the workers that were created, after which
+                         * nothing references the pool memory. */
+                        while( uxWorker > ( UBaseType_t ) 0U )
+                        {
+                            uxWorker--;
+                            vTaskDelete( pxPool->pxWorkers[ uxWorker ].xTask );
+                        }
+
+                        vPortFree( pxPool );
+                    }
+                    #else
+                    {
+                        /* The workers that were created cannot be deleted, and
+                         * they reference the pool memory, so the memory cannot
+                         * be freed.  The workers remain blocked as no jobs can
+                         * be submitted to them. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                    #endif /* INCLUDE_vTaskDelete */
+
+                    pxPool = NULL;
+                }
+            }
+            else
+            {
+                traceTASK_POOL_CREATE_FAILED();
+            }
+
+            traceRETURN_xTaskPoolCreate( pxPool );
+
+            return pxPool;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vTaskPoolInitialiseFuture( TaskPoolFuture_t * pxFuture )
+    {
+        traceENTER_vTaskPoolInitialiseFuture( pxFuture );
+
+        configASSERT( pxFuture != NULL );
+
+        pxFuture->uxPendingJobs = ( UBaseType_t ) 0U;
+        pxFuture->xWaitingTask = NULL;
+
+        traceRETURN_vTaskPoolInitialiseFuture();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskPoolSubmit( TaskPoolHandle_t xPool,
+                                TaskPoolFunction_t pxFunction,
+                                void * pvArgument,
+                                TaskPoolFuture_t * pxFuture )
+    {
+        TaskPool_t * const pxPool = xPool;
+        TaskPoolJob_t xJob;
+        UBaseType_t uxAttempt, uxWorker;
+        BaseType_t xReturn = errQUEUE_FULL;
+
+        traceENTER_xTaskPoolSubmit( xPool, pxFunction, pvArgument, pxFuture );
+
+        configASSERT( pxPool != NULL );
+        configASSERT( pxFunction != NULL );
+
+        xJob.pxFunction = pxFunction;
+        xJob.pvArgument = pvArgument;
+
+        uxWorker = pxPool->uxNextWorker;
+
+        /* Try each worker in turn, starting from the one after the worker
+         * that received the last submission. */
+        for( uxAttempt = ( UBaseType_t ) 0U; uxAttempt < pxPool->uxWorkerCount; uxAttempt++ )
+        {
+            if( uxWorker >= pxPool->uxWorkerCount )
+            {
+                uxWorker = ( UBaseType_t ) 0U;
+            }
+
+            if( prvQueueJobs( &( pxPool->pxWorkers[ uxWorker ] ), &xJob, ( UBaseType_t ) 1U, pxFuture ) != ( UBaseType_t ) 0U )
+            {
+                ( void ) xTaskNotifyGiveIndexed( pxPool->pxWorkers[ uxWorker ].xTask, configTASK_POOL_NOTIFICATION_INDEX );
+                pxPool->uxNextWorker = uxWorker + ( UBaseType_t ) 1U;
+                xReturn = pdPASS;
+                break;
+            }
+
+            uxWorker++;
+        }
+
+        traceRETURN_xTaskPoolSubmit( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTaskPoolSubmitBatch( TaskPoolHandle_t xPool,
+                                       const TaskPoolJob_t * pxJobs,
+                                       UBaseType_t uxJobCount,
+                                       TaskPoolFuture_t * pxFuture )
+    {
+        TaskPool_t * const pxPool = xPool;
+        UBaseType_t uxSubmitted = ( UBaseType_t ) 0U;
+        UBaseType_t uxAttempt, uxWorker, uxWorkersLeft, uxShare, uxQueued;
+
+        traceENTER_uxTaskPoolSubmitBatch( xPool, pxJobs, uxJobCount, pxFuture );
+
+        configASSERT( pxPool != NULL );
+        configASSERT( ( pxJobs != NULL ) || ( uxJobCount == ( UBaseType_t ) 0U ) );
+
+        uxWorker = pxPool->uxNextWorker;
+
+        /* The first pass shares the jobs evenly between the workers.  If some
+         * queues were too full to take their share, the second pass places the
+         * remaining jobs wherever there is space. */
+        for( uxAttempt = ( UBaseType_t ) 0U; ( uxAttempt < ( pxPool->uxWorkerCount * ( UBaseType_t ) 2U ) ) && ( uxSubmitted < uxJobCount ); uxAttempt++ )
+        {
+            if( uxWorker >= pxPool->uxWorkerCount )
+            {
+                uxWorker = ( UBaseType_t ) 0U;
+            }
+
+            if( uxAttempt < pxPool->uxWorkerCount )
+            {
+                uxWorkersLeft = pxPool->uxWorkerCount - uxAttempt;
+                uxShare = ( ( uxJobCount - uxSubmitted ) + uxWorkersLeft - ( UBaseType_t ) 1U ) / uxWorkersLeft;
+            }
+            else
+            {
+                uxShare = uxJobCount - uxSubmitted;
+            }
+
+            uxQueued = prvQueueJobs( &( pxPool->pxWorkers[ uxWorker ] ), &( pxJobs[ uxSubmitted ] ), uxShare, pxFuture );
+
+            if( uxQueued != ( UBaseType_t ) 0U )
+            {
+                /* One notification for the worker's whole share.  The worker
+                 * empties its queue before it blocks again. */
+                ( void ) xTaskNotifyGiveIndexed( pxPool->pxWorkers[ uxWorker ].xTask, configTASK_POOL_NOTIFICATION_INDEX );
+                uxSubmitted += uxQueued;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            uxWorker++;
+        }
+
+        pxPool->uxNextWorker = uxWorker;
+
+        traceRETURN_uxTaskPoolSubmitBatch( uxSubmitted );
+
+        return uxSubmitted;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskPoolWait( TaskPoolFuture_t * pxFuture,
+                              TickType_t xTicksToWait )
+    {
+        TimeOut_t xTimeOut;
+        BaseType_t xTimedOut = pdFALSE;
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xTaskPoolWait( pxFuture, xTicksToWait );
+
+        configASSERT( pxFuture != NULL );
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            /* The future is only updated from a critical section, so checking
+             * for completion and registering as the waiting task are atomic
+             * with respect to the worker that completes the last job. */
+            taskENTER_CRITICAL();
+            {
+                if( pxFuture->uxPendingJobs == ( UBaseType_t ) 0U )
+                {
+                    pxFuture->xWaitingTask = NULL;
+                    xReturn = pdPASS;
+                }
+                else if( xTimedOut != pdFALSE )
+                {
+                    pxFuture->xWaitingTask = NULL;
+                }
+                else
+                {
+                    pxFuture->xWaitingTask = xTaskGetCurrentTaskHandle();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( ( xReturn == pdPASS ) || ( xTimedOut != pdFALSE ) )
+            {
+                break;
+            }
+
+            /* Clearing the notification value on exit also discards any
+             * notification left by a future that completed after an earlier
+             * wait timed out. */
+            ( void ) ulTaskNotifyTakeIndexed( configTASK_POOL_NOTIFICATION_INDEX, pdTRUE, xTicksToWait );
+
+            xTimedOut = xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
+        }
+
+        traceRETURN_xTaskPoolWait( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static portTASK_FUNCTION( prvTaskPoolWorker, pvParameters )
+    {
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        TaskPoolWorker_t * const pxWorker = ( TaskPoolWorker_t * ) pvParameters;
+        TaskPoolQueuedJob_t xQueuedJob;
+
+        for( ; ; )
+        {
+            if( prvTakeJob( pxWorker, &xQueuedJob ) != pdFALSE )
+            {
+                xQueuedJob.xJob.pxFunction( xQueuedJob.xJob.pvArgument );
+
+                if( xQueuedJob.pxFuture != NULL )
+                {
+                    prvCompleteJob( xQueuedJob.pxFuture );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* There is no work, so wait to be notified of a submission.
+                 * A job that is submitted after the queues were checked leaves
+                 * the notification pending, so it is not missed. */
+                ( void ) ulTaskNotifyTakeIndexed( configTASK_POOL_NOTIFICATION_INDEX, pdTRUE, portMAX_DELAY );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvQueueJobs( TaskPoolWorker_t * pxWorker,
+                                     const TaskPoolJob_t * pxJobs,
+                                     UBaseType_t uxJobCount,
+                                     TaskPoolFuture_t * pxFuture )
+    {
+        const UBaseType_t uxLength = pxWorker->pxPool->uxJobsPerWorker;
+        UBaseType_t uxQueued, uxTail;
+
+        taskENTER_CRITICAL();
+        {
+            uxTail = pxWorker->uxHead + pxWorker->uxCount;
+
+            for( uxQueued = ( UBaseType_t ) 0U; ( uxQueued < uxJobCount ) && ( pxWorker->uxCount < uxLength ); uxQueued++ )
+            {
+                if( uxTail >= uxLength )
+                {
+                    uxTail -= uxLength;
+                }
+
+                pxWorker->pxJobs[ uxTail ].xJob = pxJobs[ uxQueued ];
+                pxWorker->pxJobs[ uxTail ].pxFuture = pxFuture;
+                uxTail++;
+                ( pxWorker->uxCount )++;
+            }
+
+            /* The jobs are recorded in the future before any worker can run
+             * them, so the future cannot appear complete early. */
+            if( pxFuture != NULL )
+            {
+                pxFuture->uxPendingJobs += uxQueued;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return uxQueued;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTakeJob( TaskPoolWorker_t * pxWorker,
+                                  TaskPoolQueuedJob_t * pxQueuedJob )
+    {
+        TaskPool_t * const pxPool = pxWorker->pxPool;
+        TaskPoolWorker_t * pxVictim = pxWorker;
+        UBaseType_t uxWorker;
+        BaseType_t xReturn = pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            if( pxVictim->uxCount == ( UBaseType_t ) 0U )
+            {
+                /* The worker's own queue is empty, so take the oldest job
+                 * from the first other worker that has one queued. */
+                for( uxWorker = ( UBaseType_t ) 0U; uxWorker < pxPool->uxWorkerCount; uxWorker++ )
+                {
+                    if( pxPool->pxWorkers[ uxWorker ].uxCount != ( UBaseType_t ) 0U )
+                    {
+                        pxVictim = &( pxPool->pxWorkers[ uxWorker ] );
+                        break;
+                    }
+                }
+            }
+
+            if( pxVictim->uxCount != ( UBaseType_t ) 0U )
+            {
+                *pxQueuedJob = pxVictim->pxJobs[ pxVictim->uxHead ];
+                ( pxVictim->uxHead )++;
+
+                if( pxVictim->uxHead >= pxPool->uxJobsPerWorker )
+                {
+                    pxVictim->uxHead = ( UBaseType_t ) 0U;
+                }
+
+                ( pxVictim->uxCount )--;
+                xReturn = pdTRUE;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCompleteJob( TaskPoolFuture_t * pxFuture )
+    {
+        taskENTER_CRITICAL();
+        {
+            /* The future must remain valid until all its jobs have completed.
+             * A count of zero here means it was reinitialised, or its memory
+             * reused, while this job was outstanding. */
+            configASSERT( pxFuture->uxPendingJobs != ( UBaseType_t ) 0U );
+            ( pxFuture->uxPendingJobs )--;
+
+            /* The waiting task can return from xTaskPoolWait() as soon as the
+             * critical section is exited, after which the future may no longer
+             * exist, so it must not be accessed outside the critical section. */
+            if( ( pxFuture->uxPendingJobs == ( UBaseType_t ) 0U ) && ( pxFuture->xWaitingTask != NULL ) )
+            {
+                ( void ) xTaskNotifyGiveIndexed( pxFuture->xWaitingTask, configTASK_POOL_NOTIFICATION_INDEX );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include task pool functionality. If you want to include task pools then
+ * ensure configUSE_TASK_POOL is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_TASK_POOL == 1 */
@@ -41,6 +41,11 @@
 #include "timers.h"
 #include "stack_macros.h"
 
+#if ( configUSE_WAIT_ANY == 1 )
+    #include "queue.h"
+    #include "stream_buffer.h"
+#endif
+
 /* The default definitions are only available for non-MPU ports. The
  * reason is that the stack alignment requirements vary for different
  * architectures.*/
@@ -86,7 +91,7 @@
 
         #define taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB ) \
     do {                                                        \
-        if( pxCurrentTCB->uxPriority < ( pxTCB )->uxPriority )  \
+        if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )                \
         {                                                       \
             portYIELD_WITHIN_API();                             \
         }                                                       \
@@ -172,6 +177,49 @@
     #define taskRESERVED_TASK_NAME_LENGTH    1U
 #endif /* if ( ( configNUMBER_OF_CORES > 1 ) */
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/* The ready list of the EDF priority is kept sorted by absolute deadline, so
+ * the task at its head is selected rather than indexing through the list. */
+    #define taskSELECT_FROM_READY_LIST( pxTCB, uxPriority )                                         \
+    do {                                                                                            \
+        if( ( uxPriority ) == ( UBaseType_t ) configEDF_PRIORITY )                                  \
+        {                                                                                           \
+            ( pxTCB ) = listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyTasksLists[ ( uxPriority ) ] ) );    \
+        }                                                                                           \
+        else                                                                                        \
+        {                                                                                           \
+            listGET_OWNER_OF_NEXT_ENTRY( ( pxTCB ), &( pxReadyTasksLists[ ( uxPriority ) ] ) );     \
+        }                                                                                           \
+    } while( 0 )
+
+    #define taskINSERT_INTO_READY_LIST( pxTCB )                                                              \
+    do {                                                                                                     \
+        if( ( pxTCB )->uxPriority == ( UBaseType_t ) configEDF_PRIORITY )                                    \
+        {                                                                                                    \
+            prvInsertIntoEdfReadyList( pxTCB );                                                              \
+        }                                                                                                    \
+        else                                                                                                 \
+        {                                                                                                    \
+            listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+        }                                                                                                    \
+    } while( 0 )
+
+/* A task made ready preempts the running task if it has a higher priority, or
+ * if both run at the EDF priority and its deadline is earlier. */
+    #define taskPREEMPTS_CURRENT_TASK( pxTCB ) \
+    ( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) || ( prvEdfDeadlineIsEarlier( ( pxTCB ), pxCurrentTCB ) != pdFALSE ) )
+
+/* Task densities are held as fixed point fractions of this value. */
+    #define taskEDF_DENSITY_SCALE    ( ( UBaseType_t ) 10000U )
+#else
+    #define taskSELECT_FROM_READY_LIST( pxTCB, uxPriority )    listGET_OWNER_OF_NEXT_ENTRY( ( pxTCB ), &( pxReadyTasksLists[ ( uxPriority ) ] ) )
+    #define taskINSERT_INTO_READY_LIST( pxTCB )                listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) )
+    #define taskPREEMPTS_CURRENT_TASK( pxTCB )                 ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority )
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 /* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -204,7 +252,7 @@
                                                                                          \
         /* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of \
          * the  same priority get an equal share of the processor time. */                    \
-        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) ); \
+        taskSELECT_FROM_READY_LIST( pxCurrentTCB, uxTopPriority );                            \
         uxTopReadyPriority = uxTopPriority;                                                   \
     } while( 0 ) /* taskSELECT_HIGHEST_PRIORITY_TASK */
     #else /* if ( configNUMBER_OF_CORES == 1 ) */
@@ -239,7 +287,7 @@
         /* Find the highest priority list that contains ready tasks. */                         \
         portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );                          \
         configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 ); \
-        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );   \
+        taskSELECT_FROM_READY_LIST( pxCurrentTCB, uxTopPriority );                              \
     } while( 0 )
 
 /*-----------------------------------------------------------*/
@@ -285,7 +333,7 @@
     do {                                                                                                   \
         traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
         taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
-        listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+        taskINSERT_INTO_READY_LIST( pxTCB );                                                               \
         tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                                                      \
     } while( 0 )
 /*-----------------------------------------------------------*/
@@ -314,6 +362,20 @@
     #define taskEVENT_LIST_ITEM_VALUE_IN_USE    ( ( uint64_t ) 0x8000000000000000U )
 #endif
 
+/* Stores the value an event group associates with a blocked task.  When the
+ * value is wider than a list item value it is held in the TCB instead, and the
+ * list item value only records that the item is in use. */
+#if ( tskEVENT_ITEM_VALUE_IN_TCB != 0 )
+    #define taskSET_EVENT_ITEM_VALUE( pxTCB, xItemValue )                                                   \
+    do {                                                                                                    \
+        ( pxTCB )->uxEventItemValue = ( xItemValue );                                                       \
+        listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xEventListItem ), taskEVENT_LIST_ITEM_VALUE_IN_USE );       \
+    } while( 0 )
+#else
+    #define taskSET_EVENT_ITEM_VALUE( pxTCB, xItemValue ) \
+    listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xEventListItem ), ( xItemValue ) | taskEVENT_LIST_ITEM_VALUE_IN_USE )
+#endif
+
 /* Indicates that the task is not actively running on any core. */
 #define taskTASK_NOT_RUNNING           ( ( BaseType_t ) ( -1 ) )
 
@@ -449,6 +511,42 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iTaskErrno;
     #endif
+
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        TickType_t xEdfPeriod;           /**< Time between job releases, or 0 if the task is not scheduled by deadline. */
+        TickType_t xEdfRelativeDeadline; /**< Deadline of each job relative to its release. */
+        TickType_t xEdfRelease;          /**< Release time of the current job. */
+        TickType_t xEdfDeadline;          /**< Absolute deadline of the current job.  Orders the task within the EDF ready list. */
+        TickType_t xEdfInheritedDeadline; /**< Earlier deadline inherited from a task blocked on a mutex held by this task.  Orders the task in place of xEdfDeadline while xEdfDeadlineInherited is pdTRUE. */
+        UBaseType_t uxEdfDensity;         /**< Share of the processor reserved when the task was admitted, in units of 1/taskEDF_DENSITY_SCALE. */
+        UBaseType_t uxDeadlineMisses;     /**< Number of jobs that completed after their deadline. */
+        BaseType_t xEdfDeadlineInherited; /**< Set to pdTRUE while xEdfInheritedDeadline is valid. */
+    #endif
+
+    #if ( configUSE_TASK_CPU_BUDGET == 1 )
+        configRUN_TIME_COUNTER_TYPE ulCpuBudget;     /**< Run time the task can use in each budget period, or 0 if the task has no budget. */
+        configRUN_TIME_COUNTER_TYPE ulCpuBudgetUsed; /**< Run time used in the current budget period, excluding the time since the task was last switched in. */
+        TickType_t xCpuBudgetPeriod;                 /**< Length of the budget period in ticks. */
+        TickType_t xCpuBudgetReplenishTime;          /**< Tick count at which the current budget period ends. */
+        UBaseType_t uxCpuBudgetThrottles;            /**< Number of times the task was throttled for exhausting its budget. */
+    #endif
+
+    #if ( configTASK_RECYCLE_CACHE_DEPTH > 0 )
+        configSTACK_DEPTH_TYPE uxStackDepth; /**< Depth of the stack, used to match a recycled TCB and stack to a new task. */
+    #endif
+
+    #if ( configUSE_WAIT_ANY == 1 )
+        WaitAnyObject_t * pxWaitAnyObjects; /**< The objects the task is registered on by xTaskWaitAny(), or NULL. */
+        UBaseType_t uxWaitAnyObjectCount;   /**< The number of entries in pxWaitAnyObjects. */
+    #endif
+
+    #if ( tskEVENT_ITEM_VALUE_IN_TCB != 0 )
+        TaskEventItemValue_t uxEventItemValue; /**< Holds the event list item value set by an event group, which is too wide for the list item.  See the definition of tskEVENT_ITEM_VALUE_IN_TCB in FreeRTOS.h. */
+    #endif
+
+    #if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+        UBaseType_t uxBatchItemsNeeded; /**< The number of items or spaces the task is waiting for while blocked in a batch queue transfer, or 0 if it is waiting for one. */
+    #endif
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -492,6 +590,24 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Ta
 
 #endif
 
+#if ( configUSE_TASK_CPU_BUDGET == 1 )
+
+/* Tasks that are ready to run but have used all of their processor time
+ * budget, in the order in which their budget periods end.  A throttled task is
+ * not blocked, so it is reported as ready and cannot be woken early. */
+    PRIVILEGED_DATA static List_t xThrottledTaskList;
+
+#endif
+
+#if ( configUSE_WAIT_ANY == 1 )
+
+/* Holds the event list item of each task that is blocked in xTaskWaitAny().
+ * The list is never walked - an event list item being in it only marks the
+ * task as blocked there, and is removed by whatever unblocks the task. */
+    PRIVILEGED_DATA static List_t xWaitAnyTaskList;
+
+#endif
+
 /* Global POSIX errno. Its value is changed upon context switching to match
  * the errno of the currently running task. */
 #if ( configUSE_POSIX_ERRNO == 1 )
@@ -529,6 +645,26 @@ static const volatile UBaseType_t uxTopUsedPriority = configMAX_PRIORITIES - 1U;
  * from either an ISR or a task. */
 PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t ) 0U;
 
+#if ( configTASK_RECYCLE_CACHE_DEPTH > 0 )
+
+/* TCBs, and the stacks they point to, of deleted dynamically allocated tasks
+ * that are kept for reuse by prvCreateTask().  Only accessed from a critical
+ * section. */
+    PRIVILEGED_DATA static TCB_t * pxRecycledTCBs[ configTASK_RECYCLE_CACHE_DEPTH ];
+    PRIVILEGED_DATA static UBaseType_t uxRecycledTCBCount = ( UBaseType_t ) 0U;
+    PRIVILEGED_DATA static UBaseType_t uxRecycleCacheHits = ( UBaseType_t ) 0U;
+    PRIVILEGED_DATA static UBaseType_t uxRecycleCacheMisses = ( UBaseType_t ) 0U;
+
+#endif
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/* Sum of the densities of all the admitted EDF tasks, in units of
+ * 1/taskEDF_DENSITY_SCALE.  Only accessed from a critical section. */
+    PRIVILEGED_DATA static UBaseType_t uxEdfTotalDensity = ( UBaseType_t ) 0U;
+
+#endif
+
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
 /* Do not move these variables to function scope as doing so prevents the
@@ -624,6 +760,24 @@ static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( configTASK_RECYCLE_CACHE_DEPTH > 0 )
+
+/*
+ * Remove a TCB with a stack of uxStackDepth words from the recycle cache.
+ * Returns NULL if there is no such TCB in the cache.  The returned TCB is
+ * cleared, other than the pointer to its stack.
+ */
+    static TCB_t * prvTakeRecycledTCB( configSTACK_DEPTH_TYPE uxStackDepth ) PRIVILEGED_FUNCTION;
+
+/*
+ * Place the TCB of a deleted task in the recycle cache.  Returns pdFALSE if
+ * the TCB and its stack were not both allocated dynamically, or if the cache
+ * is full, in which case the caller must free the memory.
+ */
+    static BaseType_t prvRecycleTCB( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Used only by the idle task.  This checks to see if anything has been placed
  * in the list of tasks waiting to be deleted.  If so the task is cleaned up
@@ -638,6 +792,129 @@ static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                                             const BaseType_t xCanBlockIndefinitely ) PRIVILEGED_FUNCTION;
 
+/*
+ * Insert pxTCB into the ready list of configEDF_PRIORITY, ahead of every task
+ * whose current job has a later deadline.  Tasks without a deadline, for
+ * example a task that inherited the priority from a task that is not an EDF
+ * task, are placed at the end.
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+    static void prvInsertIntoEdfReadyList( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sets *pxDeadline to the deadline that orders pxTCB within the EDF ready
+ * list - an inherited deadline if it has one, otherwise the deadline of its
+ * current job.  Returns pdFALSE if the task has no deadline.
+ */
+    static BaseType_t prvGetEdfDeadline( const TCB_t * pxTCB,
+                                         TickType_t * pxDeadline ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if pxTCB and pxOtherTCB both run at configEDF_PRIORITY and
+ * pxTCB has a deadline earlier than that of pxOtherTCB, or pxOtherTCB has no
+ * deadline.
+ */
+    static BaseType_t prvEdfDeadlineIsEarlier( const TCB_t * pxTCB,
+                                               const TCB_t * pxOtherTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called by xTaskPriorityInherit().  If the running task has an earlier
+ * deadline than the mutex holder, the mutex holder inherits it and is moved
+ * within the EDF ready list.  Returns pdTRUE if the deadline was inherited.
+ */
+#if ( ( configUSE_EDF_SCHEDULING == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+    static BaseType_t prvInheritEdfDeadline( TCB_t * const pxMutexHolderTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_TASK_CPU_BUDGET == 1 )
+
+/*
+ * Start a new budget period for pxTCB if its current period ended at or
+ * before xConstTickCount.
+ */
+    static void prvReplenishCpuBudget( TCB_t * pxTCB,
+                                       const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from vTaskSwitchContext() before the next task is selected.  Moves
+ * the task being switched out to xThrottledTaskList until the end of its
+ * budget period if it is still ready to run but has used all of its budget.
+ */
+    static void prvThrottleCurrentTask( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from xTaskIncrementTick().  Returns each throttled task whose budget
+ * period has ended to the ready list with its budget replenished.  Returns
+ * pdTRUE if a task was released that should preempt the running task.
+ */
+    static BaseType_t prvReleaseThrottledTasks( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_WAIT_ANY == 1 )
+
+/*
+ * Remove the highest priority task from an event list, skipping entries left
+ * by xTaskWaitAny() for tasks that have already been unblocked for another
+ * reason.  Returns NULL if the list only held such entries.
+ */
+    static TCB_t * prvRemoveHeadOfEventList( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when a task in xTaskWaitAny() is unblocked.  Removes the task's event
+ * list item from xWaitAnyTaskList and stops the task waiting for notifications
+ * on the indexes it registered, so a second object cannot unblock it again.
+ * The entries the task placed in queue event lists are left for the task to
+ * remove, as lists other than the one being accessed might be in use.
+ */
+    static void prvWaitAnyUnblocked( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the index of the first object in pxObjects that is ready, or
+ * taskWAIT_ANY_TIMEOUT if none are.  Must be called from a critical section.
+ */
+    static BaseType_t prvWaitAnyGetReadyObject( const WaitAnyObject_t * const pxObjects,
+                                                UBaseType_t uxObjectCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Register the calling task on every object in pxObjects, so that whichever
+ * becomes ready first unblocks it.  Must be called from a critical section.
+ */
+    static void prvWaitAnyAddObjects( WaitAnyObject_t * const pxObjects,
+                                      UBaseType_t uxObjectCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Cancel the registrations made by xTaskWaitAny() for pxTCB.  Must be called
+ * from a critical section.
+ */
+    static void prvWaitAnyRemoveObjects( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Moves a task that has just been removed from an event list to the ready
+ * list, or to the pending ready list if the scheduler is suspended.  Returns
+ * pdTRUE if the task should run in place of the calling task.  Must be called
+ * from a critical section.
+ */
+static BaseType_t prvReadyTaskRemovedFromEventList( TCB_t * const pxUnblockedTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Used by ulTaskGenericNotifyTake() and ulTaskGenericNotifyTakeUpTo() to block
+ * the calling task until the notification value at uxIndexToWaitOn is non-zero
+ * or xTicksToWait expires.  Returns immediately if the value is already
+ * non-zero or xTicksToWait is 0.
+ */
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+    static void prvWaitForNotificationCount( UBaseType_t uxIndexToWaitOn,
+                                             TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Fills an TaskStatus_t structure with information on each task that is
  * referenced from the pxList list (which may be a ready list, a delayed list,
@@ -1648,77 +1925,96 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
     {
         TCB_t * pxNewTCB;
 
-        /* If the stack grows down then allocate the stack then the TCB so the stack
-         * does not grow into the TCB.  Likewise if the stack grows up then allocate
-         * the TCB then the stack. */
-        #if ( portSTACK_GROWTH > 0 )
+        #if ( configTASK_RECYCLE_CACHE_DEPTH > 0 )
         {
-            /* Allocate space for the TCB.  Where the memory comes from depends on
-             * the implementation of the port malloc function and whether or not static
-             * allocation is being used. */
-            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
-            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-            /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+            /* Reuse the TCB and stack of a deleted task if one with the same
+             * stack depth is available, otherwise allocate new memory. */
+            pxNewTCB = prvTakeRecycledTCB( uxStackDepth );
+        }
+        #else
+        {
+            pxNewTCB = NULL;
+        }
+        #endif
 
-            if( pxNewTCB != NULL )
+        if( pxNewTCB == NULL )
+        {
+            /* If the stack grows down then allocate the stack then the TCB so the stack
+             * does not grow into the TCB.  Likewise if the stack grows up then allocate
+             * the TCB then the stack. */
+            #if ( portSTACK_GROWTH > 0 )
             {
-                ( void ) memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
-
-                /* Allocate space for the stack used by the task being created.
-                 * The base of the stack memory stored in the TCB so the task can
-                 * be deleted later if required. */
+                /* Allocate space for the TCB.  Where the memory comes from depends on
+                 * the implementation of the port malloc function and whether or not static
+                 * allocation is being used. */
                 /* MISRA Ref 11.5.1 [Malloc memory assignment] */
                 /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
                 /* coverity[misra_c_2012_rule_11_5_violation] */
-                pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) uxStackDepth ) * sizeof( StackType_t ) ) );
+                pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
 
-                if( pxNewTCB->pxStack == NULL )
+                if( pxNewTCB != NULL )
                 {
-                    /* Could not allocate the stack.  Delete the allocated TCB. */
-                    vPortFree( pxNewTCB );
-                    pxNewTCB = NULL;
-                }
-            }
-        }
-        #else /* portSTACK_GROWTH */
-        {
-            StackType_t * pxStack;
+                    ( void ) memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
 
-            /* Allocate space for the stack used by the task being created. */
-            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
-            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-            /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxStack = pvPortMallocStack( ( ( ( size_t ) uxStackDepth ) * sizeof( StackType_t ) ) );
+                    /* Allocate space for the stack used by the task being created.
+                     * The base of the stack memory stored in the TCB so the task can
+                     * be deleted later if required. */
+                    /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                    /* coverity[misra_c_2012_rule_11_5_violation] */
+                    pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) uxStackDepth ) * sizeof( StackType_t ) ) );
 
-            if( pxStack != NULL )
+                    if( pxNewTCB->pxStack == NULL )
+                    {
+                        /* Could not allocate the stack.  Delete the allocated TCB. */
+                        vPortFree( pxNewTCB );
+                        pxNewTCB = NULL;
+                    }
+                }
+            }
+            #else /* portSTACK_GROWTH */
             {
-                /* Allocate space for the TCB. */
+                StackType_t * pxStack;
+
+                /* Allocate space for the stack used by the task being created. */
                 /* MISRA Ref 11.5.1 [Malloc memory assignment] */
                 /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
                 /* coverity[misra_c_2012_rule_11_5_violation] */
-                pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+                pxStack = pvPortMallocStack( ( ( ( size_t ) uxStackDepth ) * sizeof( StackType_t ) ) );
 
-                if( pxNewTCB != NULL )
+                if( pxStack != NULL )
                 {
-                    ( void ) memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
+                    /* Allocate space for the TCB. */
+                    /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                    /* coverity[misra_c_2012_rule_11_5_violation] */
+                    pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+
+                    if( pxNewTCB != NULL )
+                    {
+                        ( void ) memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
 
-                    /* Store the stack location in the TCB. */
-                    pxNewTCB->pxStack = pxStack;
+                        /* Store the stack location in the TCB. */
+                        pxNewTCB->pxStack = pxStack;
+                    }
+                    else
+                    {
+                        /* The stack cannot be used as the TCB was not created.  Free
+                         * it again. */
+                        vPortFreeStack( pxStack );
+                    }
                 }
                 else
                 {
-                    /* The stack cannot be used as the TCB was not created.  Free
-                     * it again. */
-                    vPortFreeStack( pxStack );
+                    pxNewTCB = NULL;
                 }
             }
-            else
-            {
-                pxNewTCB = NULL;
-            }
+            #endif /* portSTACK_GROWTH */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif /* portSTACK_GROWTH */
 
         if( pxNewTCB != NULL )
         {
@@ -1730,6 +2026,12 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             }
             #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
+            #if ( configTASK_RECYCLE_CACHE_DEPTH > 0 )
+            {
+                pxNewTCB->uxStackDepth = uxStackDepth;
+            }
+            #endif
+
             prvInitialiseNewTask( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
         }
 
@@ -1774,6 +2076,92 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
     }
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        BaseType_t xTaskCreateEdf( TaskFunction_t pxTaskCode,
+                                   const char * const pcName,
+                                   const configSTACK_DEPTH_TYPE uxStackDepth,
+                                   void * const pvParameters,
+                                   TickType_t xPeriod,
+                                   TickType_t xRelativeDeadline,
+                                   TickType_t xWorstCaseExecutionTime,
+                                   TaskHandle_t * const pxCreatedTask )
+        {
+            TCB_t * pxNewTCB;
+            BaseType_t xReturn = pdFAIL;
+            TickType_t xDensityWindow;
+            UBaseType_t uxDensity;
+
+            traceENTER_xTaskCreateEdf( pxTaskCode, pcName, uxStackDepth, pvParameters, xPeriod, xRelativeDeadline, xWorstCaseExecutionTime, pxCreatedTask );
+
+            configASSERT( xPeriod > ( TickType_t ) 0U );
+            configASSERT( xRelativeDeadline > ( TickType_t ) 0U );
+            configASSERT( xWorstCaseExecutionTime > ( TickType_t ) 0U );
+            configASSERT( configEDF_PRIORITY < configMAX_PRIORITIES );
+
+            /* The density test uses the lesser of the deadline and the period,
+             * which makes it valid for constrained deadlines too.  The density
+             * is rounded up so rounding can never admit an overloaded set. */
+            xDensityWindow = ( xRelativeDeadline < xPeriod ) ? xRelativeDeadline : xPeriod;
+
+            if( xWorstCaseExecutionTime <= xDensityWindow )
+            {
+                uxDensity = ( UBaseType_t ) ( ( ( ( uint64_t ) xWorstCaseExecutionTime * taskEDF_DENSITY_SCALE ) + xDensityWindow - 1U ) / xDensityWindow );
+
+                taskENTER_CRITICAL();
+                {
+                    if( ( uxEdfTotalDensity + uxDensity ) <= taskEDF_DENSITY_SCALE )
+                    {
+                        uxEdfTotalDensity += uxDensity;
+                        xReturn = pdPASS;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                /* A job cannot take longer than its deadline. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xReturn == pdPASS )
+            {
+                pxNewTCB = prvCreateTask( pxTaskCode, pcName, uxStackDepth, pvParameters, configEDF_PRIORITY, pxCreatedTask );
+
+                if( pxNewTCB != NULL )
+                {
+                    /* The first job is released now.  Its deadline must be set
+                     * before the task is placed in the ordered ready list. */
+                    pxNewTCB->xEdfPeriod = xPeriod;
+                    pxNewTCB->xEdfRelativeDeadline = xRelativeDeadline;
+                    pxNewTCB->xEdfRelease = xTaskGetTickCount();
+                    pxNewTCB->xEdfDeadline = pxNewTCB->xEdfRelease + xRelativeDeadline;
+                    pxNewTCB->uxEdfDensity = uxDensity;
+
+                    prvAddNewTaskToReadyList( pxNewTCB );
+                }
+                else
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        uxEdfTotalDensity -= uxDensity;
+                    }
+                    taskEXIT_CRITICAL();
+
+                    xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+                }
+            }
+
+            traceRETURN_xTaskCreateEdf( xReturn );
+
+            return xReturn;
+        }
+    #endif /* #if ( configUSE_EDF_SCHEDULING == 1 ) */
+/*-----------------------------------------------------------*/
+
     #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
         BaseType_t xTaskCreateAffinitySet( TaskFunction_t pxTaskCode,
                                            const char * const pcName,
@@ -2245,6 +2633,28 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            #if ( configUSE_EDF_SCHEDULING == 1 )
+            {
+                /* Return the share of the processor reserved by the task. */
+                uxEdfTotalDensity -= pxTCB->uxEdfDensity;
+            }
+            #endif
+
+            #if ( configUSE_WAIT_ANY == 1 )
+            {
+                /* The objects xTaskWaitAny() registered the task on hold list
+                 * items that are on the task's stack. */
+                if( pxTCB->pxWaitAnyObjects != NULL )
+                {
+                    prvWaitAnyRemoveObjects( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
             /* Increment the uxTaskNumber also so kernel aware debuggers can
              * detect that the task lists need re-generating.  This is done before
              * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
@@ -2453,35 +2863,107 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 #endif /* INCLUDE_xTaskDelayUntil */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelay == 1 )
+#if ( configUSE_EDF_SCHEDULING == 1 )
 
-    void vTaskDelay( const TickType_t xTicksToDelay )
+    void vTaskEdfWaitForNextPeriod( void )
     {
-        BaseType_t xAlreadyYielded = pdFALSE;
+        TCB_t * pxTCB;
+        BaseType_t xAlreadyYielded;
 
-        traceENTER_vTaskDelay( xTicksToDelay );
+        traceENTER_vTaskEdfWaitForNextPeriod();
 
-        /* A delay time of zero just forces a reschedule. */
-        if( xTicksToDelay > ( TickType_t ) 0U )
+        vTaskSuspendAll();
         {
-            vTaskSuspendAll();
+            /* Minor optimisation.  The tick count cannot change in this
+             * block. */
+            const TickType_t xConstTickCount = xTickCount;
+
+            pxTCB = pxCurrentTCB;
+            configASSERT( pxTCB->xEdfPeriod > ( TickType_t ) 0U );
+
+            /* Account the job that has just completed.  Measuring from the
+             * release keeps the comparison valid across a tick overflow. */
+            if( ( TickType_t ) ( xConstTickCount - pxTCB->xEdfRelease ) > pxTCB->xEdfRelativeDeadline )
             {
-                configASSERT( uxSchedulerSuspended == 1U );
+                ( pxTCB->uxDeadlineMisses )++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-                traceTASK_DELAY();
+            /* Release the next job one period after the previous one. */
+            pxTCB->xEdfRelease += pxTCB->xEdfPeriod;
+            pxTCB->xEdfDeadline = pxTCB->xEdfRelease + pxTCB->xEdfRelativeDeadline;
 
-                /* A task that is removed from the event list while the
-                 * scheduler is suspended will not get placed in the ready
-                 * list or removed from the blocked list until the scheduler
-                 * is resumed.
-                 *
-                 * This task cannot be in an event list as it is the currently
-                 * executing task. */
-                prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
+            if( ( pxTCB->xEdfRelease != xConstTickCount ) &&
+                ( ( TickType_t ) ( pxTCB->xEdfRelease - xConstTickCount ) <= pxTCB->xEdfPeriod ) )
+            {
+                /* The next release is in the future. */
+                prvAddCurrentTaskToDelayedList( pxTCB->xEdfRelease - xConstTickCount, pdFALSE );
             }
-            xAlreadyYielded = xTaskResumeAll();
-        }
-        else
+            else
+            {
+                /* The next job is already released, either because it is due
+                 * now or because the last job overran into its next period.  Its
+                 * deadline changed while the task remained in the ready list, so
+                 * move the task to its new position. */
+                taskENTER_CRITICAL();
+                {
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    prvInsertIntoEdfReadyList( pxTCB );
+                }
+                taskEXIT_CRITICAL();
+            }
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        /* Force a reschedule if xTaskResumeAll has not already done so, the
+         * task may have blocked or may no longer have the earliest deadline. */
+        if( xAlreadyYielded == pdFALSE )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskEdfWaitForNextPeriod();
+    }
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelay == 1 )
+
+    void vTaskDelay( const TickType_t xTicksToDelay )
+    {
+        BaseType_t xAlreadyYielded = pdFALSE;
+
+        traceENTER_vTaskDelay( xTicksToDelay );
+
+        /* A delay time of zero just forces a reschedule. */
+        if( xTicksToDelay > ( TickType_t ) 0U )
+        {
+            vTaskSuspendAll();
+            {
+                configASSERT( uxSchedulerSuspended == 1U );
+
+                traceTASK_DELAY();
+
+                /* A task that is removed from the event list while the
+                 * scheduler is suspended will not get placed in the ready
+                 * list or removed from the blocked list until the scheduler
+                 * is resumed.
+                 *
+                 * This task cannot be in an event list as it is the currently
+                 * executing task. */
+                prvAddCurrentTaskToDelayedList( xTicksToDelay, pdFALSE );
+            }
+            xAlreadyYielded = xTaskResumeAll();
+        }
+        else
         {
             mtCOVERAGE_TEST_MARKER();
         }
@@ -3006,6 +3488,57 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 #endif /* INCLUDE_vTaskPrioritySet */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_CPU_BUDGET == 1 )
+
+    void vTaskSetCpuBudget( TaskHandle_t xTask,
+                            configRUN_TIME_COUNTER_TYPE ulBudget,
+                            TickType_t xPeriod )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskSetCpuBudget( xTask, ulBudget, xPeriod );
+
+        /* The end of a period is found by comparing tick counts, which is
+         * only valid across a tick count overflow for up to half the tick
+         * range. */
+        configASSERT( ( ulBudget == 0U ) || ( ( xPeriod > ( TickType_t ) 0U ) && ( xPeriod <= ( portMAX_DELAY >> 1 ) ) ) );
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the budget of the calling
+             * task that is being set. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            /* The idle task must always be able to run. */
+            configASSERT( ( ulBudget == 0U ) || ( pxTCB != xIdleTaskHandles[ 0 ] ) );
+
+            pxTCB->ulCpuBudget = ulBudget;
+            pxTCB->ulCpuBudgetUsed = 0U;
+            pxTCB->xCpuBudgetPeriod = xPeriod;
+            pxTCB->xCpuBudgetReplenishTime = xTickCount + xPeriod;
+
+            /* The new budget has not been used, so a throttled task can run
+             * again. */
+            if( listIS_CONTAINED_WITHIN( &xThrottledTaskList, &( pxTCB->xStateListItem ) ) != pdFALSE )
+            {
+                listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                prvAddTaskToReadyList( pxTCB );
+                taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskSetCpuBudget();
+    }
+
+#endif /* configUSE_TASK_CPU_BUDGET */
+/*-----------------------------------------------------------*/
+
 #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
     void vTaskCoreAffinitySet( const TaskHandle_t xTask,
                                UBaseType_t uxCoreAffinityMask )
@@ -3484,7 +4017,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                     {
                         /* Ready lists can be accessed so move the task from the
                          * suspended list to the ready list directly. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
                         {
                             xYieldRequired = pdTRUE;
 
@@ -4000,6 +4533,30 @@ void vTaskSuspendAll( void )
         {
             xReturn = xNextTaskUnblockTime;
             xReturn -= xTickCount;
+
+            #if ( configUSE_TASK_CPU_BUDGET == 1 )
+            {
+                /* A throttled task must be released at the end of its budget
+                 * period. */
+                if( listLIST_IS_EMPTY( &xThrottledTaskList ) == pdFALSE )
+                {
+                    const TickType_t xReleaseTicks = listGET_ITEM_VALUE_OF_HEAD_ENTRY( &xThrottledTaskList ) - xTickCount;
+
+                    if( xReleaseTicks < xReturn )
+                    {
+                        xReturn = xReleaseTicks;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_TASK_CPU_BUDGET */
         }
 
         return xReturn;
@@ -4056,7 +4613,7 @@ BaseType_t xTaskResumeAll( void )
                         {
                             /* If the moved task has a priority higher than the current
                              * task then a yield must be performed. */
-                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                            if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
                             {
                                 xYieldPendings[ xCoreID ] = pdTRUE;
                             }
@@ -4350,6 +4907,16 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
             }
 
+            #if ( configUSE_TASK_CPU_BUDGET == 1 )
+            {
+                if( pxTCB == NULL )
+                {
+                    /* Search the throttled list. */
+                    pxTCB = prvSearchForNameWithinSingleList( &xThrottledTaskList, pcNameToQuery );
+                }
+            }
+            #endif
+
             #if ( INCLUDE_vTaskSuspend == 1 )
             {
                 if( pxTCB == NULL )
@@ -4463,6 +5030,13 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked ) );
                 uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked ) );
 
+                #if ( configUSE_TASK_CPU_BUDGET == 1 )
+                {
+                    /* Throttled tasks are still in the Ready state. */
+                    uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xThrottledTaskList, eReady ) );
+                }
+                #endif
+
                 #if ( INCLUDE_vTaskDelete == 1 )
                 {
                     /* Fill in an TaskStatus_t structure with information on
@@ -4684,7 +5258,7 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                         /* Preemption is on, but a context switch should only be
                          * performed if the unblocked task has a priority that is
                          * higher than the currently executing task. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
                         {
                             /* Pend the yield to be performed when the scheduler
                              * is unsuspended. */
@@ -4835,7 +5409,7 @@ BaseType_t xTaskIncrementTick( void )
                              * processing time (which happens when both
                              * preemption and time slicing are on) is
                              * handled below.*/
-                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                            if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
                             {
                                 xSwitchRequired = pdTRUE;
                             }
@@ -4855,6 +5429,21 @@ BaseType_t xTaskIncrementTick( void )
             }
         }
 
+        #if ( configUSE_TASK_CPU_BUDGET == 1 )
+        {
+            /* A throttled task gets its budget back, and can run again, on
+             * the tick at which its budget period ends. */
+            if( prvReleaseThrottledTasks( xConstTickCount ) != pdFALSE )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_TASK_CPU_BUDGET == 1 ) */
+
         /* Tasks of equal priority to the currently running task will share
          * processing time (time slice) if preemption is on, and the application
          * writer has not explicitly turned time slicing off. */
@@ -4891,6 +5480,55 @@ BaseType_t xTaskIncrementTick( void )
         }
         #endif /* #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_EDF_SCHEDULING == 1 ) )
+        {
+            /* A task unblocked at the EDF priority preempts the running EDF
+             * task if the deadline of its job is earlier, even though the two
+             * tasks have equal priority. */
+            if( ( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) &&
+                ( listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyTasksLists[ configEDF_PRIORITY ] ) ) != pxCurrentTCB ) )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_EDF_SCHEDULING == 1 ) ) */
+
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TASK_CPU_BUDGET == 1 ) )
+        {
+            /* Switch out the running task once it has used its budget, it is
+             * then throttled by vTaskSwitchContext(). */
+            if( pxCurrentTCB->ulCpuBudget != 0U )
+            {
+                configRUN_TIME_COUNTER_TYPE ulTotalTime;
+
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalTime );
+                #else
+                    ulTotalTime = portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+
+                prvReplenishCpuBudget( pxCurrentTCB, xConstTickCount );
+
+                if( ( pxCurrentTCB->ulCpuBudgetUsed + ( ulTotalTime - ulTaskSwitchedInTime[ 0 ] ) ) >= pxCurrentTCB->ulCpuBudget )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TASK_CPU_BUDGET == 1 ) ) */
+
         #if ( configUSE_TICK_HOOK == 1 )
         {
             /* Guard against the tick hook being called when the pended tick
@@ -5139,6 +5777,12 @@ BaseType_t xTaskIncrementTick( void )
                 if( ulTotalRunTime[ 0 ] > ulTaskSwitchedInTime[ 0 ] )
                 {
                     pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime[ 0 ] - ulTaskSwitchedInTime[ 0 ] );
+
+                    #if ( configUSE_TASK_CPU_BUDGET == 1 )
+                    {
+                        pxCurrentTCB->ulCpuBudgetUsed += ( ulTotalRunTime[ 0 ] - ulTaskSwitchedInTime[ 0 ] );
+                    }
+                    #endif
                 }
                 else
                 {
@@ -5149,6 +5793,12 @@ BaseType_t xTaskIncrementTick( void )
             }
             #endif /* configGENERATE_RUN_TIME_STATS */
 
+            #if ( configUSE_TASK_CPU_BUDGET == 1 )
+            {
+                prvThrottleCurrentTask();
+            }
+            #endif
+
             /* Check for stack overflow, if configured. */
             taskCHECK_FOR_STACK_OVERFLOW();
 
@@ -5316,14 +5966,43 @@ void vTaskPlaceOnEventList( List_t * const pxEventList,
      * simultaneous access from interrupts. */
     vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
 
+    #if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+    {
+        /* The task waits for a single item or space unless
+         * vTaskPlaceOnEventListForBatch() sets otherwise. */
+        pxCurrentTCB->uxBatchItemsNeeded = ( UBaseType_t ) 0U;
+    }
+    #endif
+
     prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
 
     traceRETURN_vTaskPlaceOnEventList();
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+
+    void vTaskPlaceOnEventListForBatch( List_t * const pxEventList,
+                                        UBaseType_t uxItemsNeeded,
+                                        const TickType_t xTicksToWait )
+    {
+        traceENTER_vTaskPlaceOnEventListForBatch( pxEventList, uxItemsNeeded, xTicksToWait );
+
+        /* THIS FUNCTION MUST BE CALLED WITH THE
+         * SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED.  The queue
+         * is locked, so xTaskRemoveFromEventListForBatch() cannot see the task
+         * until the number of items it needs has been recorded. */
+        vTaskPlaceOnEventList( pxEventList, xTicksToWait );
+        pxCurrentTCB->uxBatchItemsNeeded = uxItemsNeeded;
+
+        traceRETURN_vTaskPlaceOnEventListForBatch();
+    }
+
+#endif /* configUSE_QUEUE_BATCH_TRANSFER */
+/*-----------------------------------------------------------*/
+
 void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
-                                     const TickType_t xItemValue,
+                                     const TaskEventItemValue_t xItemValue,
                                      const TickType_t xTicksToWait )
 {
     traceENTER_vTaskPlaceOnUnorderedEventList( pxEventList, xItemValue, xTicksToWait );
@@ -5337,7 +6016,7 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
     /* Store the item value in the event list item.  It is safe to access the
      * event list item here as interrupts won't access the event list item of a
      * task that is not in the Blocked state. */
-    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+    taskSET_EVENT_ITEM_VALUE( pxCurrentTCB, xItemValue );
 
     /* Place the event list item of the TCB at the end of the appropriate event
      * list.  It is safe to access the event list here because it is part of an
@@ -5374,6 +6053,15 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
          * can be used in place of vListInsert. */
         listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
 
+        #if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
+        {
+            /* As in vTaskPlaceOnEventList(), the task waits for a single item,
+             * so a count left from an earlier batch transfer must not be seen by
+             * xTaskRemoveFromEventListForBatch(). */
+            pxCurrentTCB->uxBatchItemsNeeded = ( UBaseType_t ) 0U;
+        }
+        #endif
+
         /* If the task should block indefinitely then set the block time to a
          * value that will be recognised as an indefinite delay inside the
          * prvAddCurrentTaskToDelayedList() function. */
@@ -5411,105 +6099,286 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
      *
      * This function assumes that a check has already been made to ensure that
      * pxEventList is not empty. */
-    /* MISRA Ref 11.5.3 [Void pointer assignment] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-    /* coverity[misra_c_2012_rule_11_5_violation] */
-    pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
-    configASSERT( pxUnblockedTCB );
-    listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
-
-    if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
+    #if ( configUSE_WAIT_ANY == 1 )
     {
-        listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-        prvAddTaskToReadyList( pxUnblockedTCB );
-
-        #if ( configUSE_TICKLESS_IDLE != 0 )
-        {
-            /* If a task is blocked on a kernel object then xNextTaskUnblockTime
-             * might be set to the blocked task's time out time.  If the task is
-             * unblocked for a reason other than a timeout xNextTaskUnblockTime is
-             * normally left unchanged, because it is automatically reset to a new
-             * value when the tick count equals xNextTaskUnblockTime.  However if
-             * tickless idling is used it might be more important to enter sleep mode
-             * at the earliest possible time - so reset xNextTaskUnblockTime here to
-             * ensure it is updated at the earliest possible time. */
-            prvResetNextTaskUnblockTime();
-        }
-        #endif
+        pxUnblockedTCB = prvRemoveHeadOfEventList( pxEventList );
     }
-    else
+    #else
     {
-        /* The delayed and ready lists cannot be accessed, so hold this task
-         * pending until the scheduler is resumed. */
-        listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+        configASSERT( pxUnblockedTCB );
+        listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
     }
+    #endif /* configUSE_WAIT_ANY */
 
-    #if ( configNUMBER_OF_CORES == 1 )
+    if( pxUnblockedTCB != NULL )
     {
-        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
-        {
-            /* Return true if the task removed from the event list has a higher
-             * priority than the calling task.  This allows the calling task to know if
-             * it should force a context switch now. */
-            xReturn = pdTRUE;
-
-            /* Mark that a yield is pending in case the user is not using the
-             * "xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
-            xYieldPendings[ 0 ] = pdTRUE;
-        }
-        else
-        {
-            xReturn = pdFALSE;
-        }
+        xReturn = prvReadyTaskRemovedFromEventList( pxUnblockedTCB );
     }
-    #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+    else
     {
         xReturn = pdFALSE;
-
-        #if ( configUSE_PREEMPTION == 1 )
-        {
-            prvYieldForTask( pxUnblockedTCB );
-
-            if( xYieldPendings[ portGET_CORE_ID() ] != pdFALSE )
-            {
-                xReturn = pdTRUE;
-            }
-        }
-        #endif /* #if ( configUSE_PREEMPTION == 1 ) */
     }
-    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
 
     traceRETURN_xTaskRemoveFromEventList( xReturn );
     return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
-                                        const TickType_t xItemValue )
-{
-    TCB_t * pxUnblockedTCB;
+#if ( configUSE_QUEUE_BATCH_TRANSFER == 1 )
 
-    traceENTER_vTaskRemoveFromUnorderedEventList( pxEventListItem, xItemValue );
+    BaseType_t xTaskRemoveFromEventListForBatch( const List_t * const pxEventList,
+                                                 UBaseType_t uxAvailable,
+                                                 UBaseType_t uxAdded )
+    {
+        const ListItem_t * const pxEndMarker = listGET_END_MARKER( pxEventList );
+        ListItem_t * pxListItem;
+        ListItem_t * pxNextListItem;
+        TCB_t * pxUnblockedTCB;
+        UBaseType_t uxNeeded;
+        BaseType_t xReturn = pdFALSE;
 
-    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-     * the event flags implementation. */
-    configASSERT( uxSchedulerSuspended != ( UBaseType_t ) 0U );
+        traceENTER_xTaskRemoveFromEventListForBatch( pxEventList, uxAvailable, uxAdded );
 
-    /* Store the new item value in the event list. */
-    listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+        /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+         * called from a critical section within an ISR.
+         *
+         * The event list is in priority order, but the highest priority task
+         * might be waiting for more items or spaces than are available.  It is
+         * left blocked, so it is not woken once per item only to block again,
+         * and the next task whose need can be met is unblocked instead.  Tasks
+         * are unblocked until the uxAdded new items or spaces are accounted
+         * for. */
+        pxListItem = listGET_HEAD_ENTRY( pxEventList );
 
-    /* Remove the event list form the event flag.  Interrupts do not access
-     * event flags. */
-    /* MISRA Ref 11.5.3 [Void pointer assignment] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-    /* coverity[misra_c_2012_rule_11_5_violation] */
-    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem );
-    configASSERT( pxUnblockedTCB );
-    listREMOVE_ITEM( pxEventListItem );
+        while( ( pxListItem != pxEndMarker ) && ( uxAdded > ( UBaseType_t ) 0U ) && ( uxAvailable > ( UBaseType_t ) 0U ) )
+        {
+            pxNextListItem = listGET_NEXT( pxListItem );
 
-    #if ( configUSE_TICKLESS_IDLE != 0 )
-    {
-        /* If a task is blocked on a kernel object then xNextTaskUnblockTime
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxListItem );
+            configASSERT( pxUnblockedTCB );
+
+            uxNeeded = pxUnblockedTCB->uxBatchItemsNeeded;
+
+            #if ( configUSE_WAIT_ANY == 1 )
+            {
+                if( pxListItem != &( pxUnblockedTCB->xEventListItem ) )
+                {
+                    /* The entry was placed by xTaskWaitAny(), which waits for
+                     * a single item.  Entries left for tasks that have already
+                     * been unblocked for another reason are removed, as in
+                     * prvRemoveHeadOfEventList(). */
+                    uxNeeded = ( UBaseType_t ) 0U;
+
+                    if( listIS_CONTAINED_WITHIN( &xWaitAnyTaskList, &( pxUnblockedTCB->xEventListItem ) ) == pdFALSE )
+                    {
+                        listREMOVE_ITEM( pxListItem );
+                        pxUnblockedTCB = NULL;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_WAIT_ANY */
+
+            if( uxNeeded == ( UBaseType_t ) 0U )
+            {
+                uxNeeded = ( UBaseType_t ) 1U;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( ( pxUnblockedTCB != NULL ) && ( uxNeeded <= uxAvailable ) )
+            {
+                listREMOVE_ITEM( pxListItem );
+
+                #if ( configUSE_WAIT_ANY == 1 )
+                {
+                    if( pxListItem != &( pxUnblockedTCB->xEventListItem ) )
+                    {
+                        prvWaitAnyUnblocked( pxUnblockedTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_WAIT_ANY */
+
+                if( prvReadyTaskRemovedFromEventList( pxUnblockedTCB ) != pdFALSE )
+                {
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                uxAvailable -= uxNeeded;
+                uxAdded = ( uxNeeded < uxAdded ) ? ( uxAdded - uxNeeded ) : ( UBaseType_t ) 0U;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxListItem = pxNextListItem;
+        }
+
+        traceRETURN_xTaskRemoveFromEventListForBatch( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_BATCH_TRANSFER */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvReadyTaskRemovedFromEventList( TCB_t * const pxUnblockedTCB )
+{
+    BaseType_t xReturn;
+
+    if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
+    {
+        listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+        prvAddTaskToReadyList( pxUnblockedTCB );
+
+        #if ( configUSE_TICKLESS_IDLE != 0 )
+        {
+            /* If a task is blocked on a kernel object then xNextTaskUnblockTime
+             * might be set to the blocked task's time out time.  If the task is
+             * unblocked for a reason other than a timeout xNextTaskUnblockTime is
+             * normally left unchanged, because it is automatically reset to a new
+             * value when the tick count equals xNextTaskUnblockTime.  However if
+             * tickless idling is used it might be more important to enter sleep mode
+             * at the earliest possible time - so reset xNextTaskUnblockTime here to
+             * ensure it is updated at the earliest possible time. */
+            prvResetNextTaskUnblockTime();
+        }
+        #endif
+    }
+    else
+    {
+        /* The delayed and ready lists cannot be accessed, so hold this task
+         * pending until the scheduler is resumed. */
+        listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+    }
+
+    #if ( configNUMBER_OF_CORES == 1 )
+    {
+        if( taskPREEMPTS_CURRENT_TASK( pxUnblockedTCB ) )
+        {
+            /* Return true if the task removed from the event list has a higher
+             * priority than the calling task.  This allows the calling task to know if
+             * it should force a context switch now. */
+            xReturn = pdTRUE;
+
+            /* Mark that a yield is pending in case the user is not using the
+             * "xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
+            xYieldPendings[ 0 ] = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+    }
+    #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+    {
+        xReturn = pdFALSE;
+
+        #if ( configUSE_PREEMPTION == 1 )
+        {
+            prvYieldForTask( pxUnblockedTCB );
+
+            if( xYieldPendings[ portGET_CORE_ID() ] != pdFALSE )
+            {
+                xReturn = pdTRUE;
+            }
+        }
+        #endif /* #if ( configUSE_PREEMPTION == 1 ) */
+    }
+    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configEVENT_GROUP_ISR_MAX_WAITERS > 0 )
+
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem,
+                                                         const TaskEventItemValue_t xItemValue )
+    {
+        TCB_t * pxUnblockedTCB;
+        BaseType_t xReturn;
+
+        traceENTER_xTaskRemoveFromUnorderedEventListFromISR( pxEventListItem, xItemValue );
+
+        /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+         * called from a critical section within an ISR.  It is used by the event
+         * flags implementation when configEVENT_GROUP_ISR_MAX_WAITERS allows
+         * interrupts to access event flags. */
+
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem );
+        configASSERT( pxUnblockedTCB );
+
+        /* Store the new item value in the event list. */
+        taskSET_EVENT_ITEM_VALUE( pxUnblockedTCB, xItemValue );
+
+        listREMOVE_ITEM( pxEventListItem );
+
+        xReturn = prvReadyTaskRemovedFromEventList( pxUnblockedTCB );
+
+        traceRETURN_xTaskRemoveFromUnorderedEventListFromISR( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configEVENT_GROUP_ISR_MAX_WAITERS */
+/*-----------------------------------------------------------*/
+
+void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
+                                        const TaskEventItemValue_t xItemValue )
+{
+    TCB_t * pxUnblockedTCB;
+
+    traceENTER_vTaskRemoveFromUnorderedEventList( pxEventListItem, xItemValue );
+
+    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+     * the event flags implementation. */
+    configASSERT( uxSchedulerSuspended != ( UBaseType_t ) 0U );
+
+    /* MISRA Ref 11.5.3 [Void pointer assignment] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+    /* coverity[misra_c_2012_rule_11_5_violation] */
+    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem );
+    configASSERT( pxUnblockedTCB );
+
+    /* Store the new item value in the event list. */
+    taskSET_EVENT_ITEM_VALUE( pxUnblockedTCB, xItemValue );
+
+    /* Remove the event list form the event flag.  Interrupts do not access
+     * event flags. */
+    listREMOVE_ITEM( pxEventListItem );
+
+    #if ( configUSE_TICKLESS_IDLE != 0 )
+    {
+        /* If a task is blocked on a kernel object then xNextTaskUnblockTime
          * might be set to the blocked task's time out time.  If the task is
          * unblocked for a reason other than a timeout xNextTaskUnblockTime is
          * normally left unchanged, because it is automatically reset to a new
@@ -5529,7 +6398,7 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
 
     #if ( configNUMBER_OF_CORES == 1 )
     {
-        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+        if( taskPREEMPTS_CURRENT_TASK( pxUnblockedTCB ) )
         {
             /* The unblocked task has a priority above that of the calling task, so
              * a context switch is required.  This function is called with the
@@ -6089,6 +6958,18 @@ static void prvInitialiseTaskLists( void )
     }
     #endif /* INCLUDE_vTaskSuspend */
 
+    #if ( configUSE_TASK_CPU_BUDGET == 1 )
+    {
+        vListInitialise( &xThrottledTaskList );
+    }
+    #endif /* configUSE_TASK_CPU_BUDGET */
+
+    #if ( configUSE_WAIT_ANY == 1 )
+    {
+        vListInitialise( &xWaitAnyTaskList );
+    }
+    #endif /* configUSE_WAIT_ANY */
+
     /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
      * using list2. */
     pxDelayedTaskList = &xDelayedTaskList1;
@@ -6203,6 +7084,19 @@ static void prvCheckTasksWaitingTermination( void )
         }
         #endif
 
+        #if ( configUSE_EDF_SCHEDULING == 1 )
+        {
+            pxTaskStatus->xAbsoluteDeadline = pxTCB->xEdfDeadline;
+            pxTaskStatus->uxDeadlineMisses = pxTCB->uxDeadlineMisses;
+        }
+        #endif
+
+        #if ( configUSE_TASK_CPU_BUDGET == 1 )
+        {
+            pxTaskStatus->uxBudgetThrottleCount = pxTCB->uxCpuBudgetThrottles;
+        }
+        #endif
+
         #if ( configUSE_MUTEXES == 1 )
         {
             pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
@@ -6461,6 +7355,8 @@ static void prvCheckTasksWaitingTermination( void )
 
     static void prvDeleteTCB( TCB_t * pxTCB )
     {
+        BaseType_t xRecycled;
+
         /* This call is required specifically for the TriCore port.  It must be
          * above the vPortFree() calls.  The call is also used by ports/demos that
          * want to allocate and clean RAM statically. */
@@ -6473,83 +7369,242 @@ static void prvCheckTasksWaitingTermination( void )
         }
         #endif
 
-        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+        #if ( configTASK_RECYCLE_CACHE_DEPTH > 0 )
         {
-            /* The task can only have been allocated dynamically - free both
-             * the stack and TCB. */
-            vPortFreeStack( pxTCB->pxStack );
-            vPortFree( pxTCB );
+            /* Keep the memory for reuse rather than freeing it if there is
+             * space in the recycle cache. */
+            xRecycled = prvRecycleTCB( pxTCB );
         }
-        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+        #else
         {
-            /* The task could have been allocated statically or dynamically, so
-             * check what was statically allocated before trying to free the
-             * memory. */
-            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+            xRecycled = pdFALSE;
+        }
+        #endif
+
+        if( xRecycled == pdFALSE )
+        {
+            #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
             {
-                /* Both the stack and TCB were allocated dynamically, so both
-                 * must be freed. */
+                /* The task can only have been allocated dynamically - free both
+                 * the stack and TCB. */
                 vPortFreeStack( pxTCB->pxStack );
                 vPortFree( pxTCB );
             }
-            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
-            {
-                /* Only the stack was statically allocated, so the TCB is the
-                 * only memory that must be freed. */
-                vPortFree( pxTCB );
-            }
-            else
+            #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
             {
-                /* Neither the stack nor the TCB were allocated dynamically, so
-                 * nothing needs to be freed. */
-                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
-                mtCOVERAGE_TEST_MARKER();
+                /* The task could have been allocated statically or dynamically, so
+                 * check what was statically allocated before trying to free the
+                 * memory. */
+                if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+                {
+                    /* Both the stack and TCB were allocated dynamically, so both
+                     * must be freed. */
+                    vPortFreeStack( pxTCB->pxStack );
+                    vPortFree( pxTCB );
+                }
+                else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+                {
+                    /* Only the stack was statically allocated, so the TCB is the
+                     * only memory that must be freed. */
+                    vPortFree( pxTCB );
+                }
+                else
+                {
+                    /* Neither the stack nor the TCB were allocated dynamically, so
+                     * nothing needs to be freed. */
+                    configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
+            #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
     }
 
 #endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
-static void prvResetNextTaskUnblockTime( void )
-{
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-    {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
-    }
-    else
-    {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
-    }
-}
-/*-----------------------------------------------------------*/
+#if ( configTASK_RECYCLE_CACHE_DEPTH > 0 )
 
-#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_RECURSIVE_MUTEXES == 1 ) ) || ( configNUMBER_OF_CORES > 1 )
+    static TCB_t * prvTakeRecycledTCB( configSTACK_DEPTH_TYPE uxStackDepth )
+    {
+        TCB_t * pxTCB = NULL;
+        StackType_t * pxStack;
+        UBaseType_t uxIndex;
 
-    #if ( configNUMBER_OF_CORES == 1 )
-        TaskHandle_t xTaskGetCurrentTaskHandle( void )
+        taskENTER_CRITICAL();
         {
-            TaskHandle_t xReturn;
-
-            traceENTER_xTaskGetCurrentTaskHandle();
-
-            /* A critical section is not required as this is not called from
-             * an interrupt and the current TCB will always be the same for any
-             * individual execution thread. */
-            xReturn = pxCurrentTCB;
+            for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxRecycledTCBCount; uxIndex++ )
+            {
+                if( pxRecycledTCBs[ uxIndex ]->uxStackDepth == uxStackDepth )
+                {
+                    pxTCB = pxRecycledTCBs[ uxIndex ];
 
-            traceRETURN_xTaskGetCurrentTaskHandle( xReturn );
+                    /* The order of the cache does not matter, so fill the gap
+                     * with the last entry. */
+                    uxRecycledTCBCount--;
+                    pxRecycledTCBs[ uxIndex ] = pxRecycledTCBs[ uxRecycledTCBCount ];
+                    break;
+                }
+            }
 
-            return xReturn;
+            if( pxTCB != NULL )
+            {
+                uxRecycleCacheHits++;
+            }
+            else
+            {
+                uxRecycleCacheMisses++;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( pxTCB != NULL )
+        {
+            /* Give the new task the same clean TCB as a newly allocated one,
+             * keeping only the stack. */
+            pxStack = pxTCB->pxStack;
+            ( void ) memset( ( void * ) pxTCB, 0x00, sizeof( TCB_t ) );
+            pxTCB->pxStack = pxStack;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxTCB;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvRecycleTCB( TCB_t * pxTCB )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+        #endif
+        {
+            taskENTER_CRITICAL();
+            {
+                if( uxRecycledTCBCount < ( UBaseType_t ) configTASK_RECYCLE_CACHE_DEPTH )
+                {
+                    pxRecycledTCBs[ uxRecycledTCBCount ] = pxTCB;
+                    uxRecycledTCBCount++;
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetRecycleCacheStats( UBaseType_t * puxHits,
+                                    UBaseType_t * puxMisses )
+    {
+        traceENTER_vTaskGetRecycleCacheStats( puxHits, puxMisses );
+
+        taskENTER_CRITICAL();
+        {
+            if( puxHits != NULL )
+            {
+                *puxHits = uxRecycleCacheHits;
+            }
+
+            if( puxMisses != NULL )
+            {
+                *puxMisses = uxRecycleCacheMisses;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskGetRecycleCacheStats();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskFlushRecycleCache( void )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskFlushRecycleCache();
+
+        /* Free one TCB at a time so the memory is not freed from within the
+         * critical section. */
+        do
+        {
+            taskENTER_CRITICAL();
+            {
+                if( uxRecycledTCBCount > ( UBaseType_t ) 0U )
+                {
+                    uxRecycledTCBCount--;
+                    pxTCB = pxRecycledTCBs[ uxRecycledTCBCount ];
+                }
+                else
+                {
+                    pxTCB = NULL;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( pxTCB != NULL )
+            {
+                vPortFreeStack( pxTCB->pxStack );
+                vPortFree( pxTCB );
+            }
+        } while( pxTCB != NULL );
+
+        traceRETURN_vTaskFlushRecycleCache();
+    }
+
+#endif /* configTASK_RECYCLE_CACHE_DEPTH */
+/*-----------------------------------------------------------*/
+
+static void prvResetNextTaskUnblockTime( void )
+{
+    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+    {
+        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+         * the maximum possible value so it is  extremely unlikely that the
+         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+         * there is an item in the delayed list. */
+        xNextTaskUnblockTime = portMAX_DELAY;
+    }
+    else
+    {
+        /* The new current delayed list is not empty, get the value of
+         * the item at the head of the delayed list.  This is the time at
+         * which the task at the head of the delayed list should be removed
+         * from the Blocked state. */
+        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_RECURSIVE_MUTEXES == 1 ) || ( configUSE_FAST_MUTEXES == 1 ) || ( configUSE_RW_LOCKS == 1 ) ) || ( configNUMBER_OF_CORES > 1 )
+
+    #if ( configNUMBER_OF_CORES == 1 )
+        TaskHandle_t xTaskGetCurrentTaskHandle( void )
+        {
+            TaskHandle_t xReturn;
+
+            traceENTER_xTaskGetCurrentTaskHandle();
+
+            /* A critical section is not required as this is not called from
+             * an interrupt and the current TCB will always be the same for any
+             * individual execution thread. */
+            xReturn = pxCurrentTCB;
+
+            traceRETURN_xTaskGetCurrentTaskHandle( xReturn );
+
+            return xReturn;
         }
     #else /* #if ( configNUMBER_OF_CORES == 1 ) */
         TaskHandle_t xTaskGetCurrentTaskHandle( void )
@@ -6591,7 +7646,7 @@ static void prvResetNextTaskUnblockTime( void )
         return xReturn;
     }
 
-#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_RECURSIVE_MUTEXES == 1 ) ) */
+#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_RECURSIVE_MUTEXES == 1 ) || ( configUSE_FAST_MUTEXES == 1 ) || ( configUSE_RW_LOCKS == 1 ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
@@ -6647,6 +7702,17 @@ static void prvResetNextTaskUnblockTime( void )
          * inheritance is not applied in this scenario. */
         if( pxMutexHolder != NULL )
         {
+            #if ( configUSE_EDF_SCHEDULING == 1 )
+            {
+                /* The mutex holder also inherits the deadline of the task
+                 * attempting to obtain the mutex if it is earlier, so it runs
+                 * ahead of EDF tasks with later deadlines.  This is done first so
+                 * a holder that inherits the EDF priority below is placed by the
+                 * inherited deadline. */
+                xReturn = prvInheritEdfDeadline( pxMutexHolderTCB );
+            }
+            #endif
+
             /* If the holder of the mutex has a priority below the priority of
              * the task attempting to obtain the mutex then it will temporarily
              * inherit the priority of the task attempting to obtain the mutex. */
@@ -6756,6 +7822,38 @@ static void prvResetNextTaskUnblockTime( void )
             configASSERT( pxTCB->uxMutexesHeld );
             ( pxTCB->uxMutexesHeld )--;
 
+            #if ( configUSE_EDF_SCHEDULING == 1 )
+            {
+                /* As with priorities, an inherited deadline is only dropped once
+                 * no mutexes are held. */
+                if( ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 ) && ( pxTCB->xEdfDeadlineInherited != pdFALSE ) )
+                {
+                    pxTCB->xEdfDeadlineInherited = pdFALSE;
+
+                    /* If the priority is also inherited the task is placed by
+                     * its own deadline when it is moved back to its own ready list
+                     * below. */
+                    if( ( pxTCB->uxPriority == pxTCB->uxBasePriority ) &&
+                        ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configEDF_PRIORITY ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+                    {
+                        ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                        prvInsertIntoEdfReadyList( pxTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Another EDF task may now have the earliest deadline. */
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_EDF_SCHEDULING */
+
             /* Has the holder of the mutex inherited the priority of another
              * task? */
             if( pxTCB->uxPriority != pxTCB->uxBasePriority )
@@ -7643,13 +8741,21 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
 /*-----------------------------------------------------------*/
 
-TickType_t uxTaskResetEventItemValue( void )
+TaskEventItemValue_t uxTaskResetEventItemValue( void )
 {
-    TickType_t uxReturn;
+    TaskEventItemValue_t uxReturn;
 
     traceENTER_uxTaskResetEventItemValue();
 
-    uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+    #if ( tskEVENT_ITEM_VALUE_IN_TCB != 0 )
+    {
+        uxReturn = pxCurrentTCB->uxEventItemValue;
+    }
+    #else
+    {
+        uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+    }
+    #endif
 
     /* Reset the event list item to its normal value - so it can be used with
      * queues and semaphores. */
@@ -7661,6 +8767,31 @@ TickType_t uxTaskResetEventItemValue( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( tskEVENT_ITEM_VALUE_IN_TCB != 0 )
+
+    TaskEventItemValue_t uxTaskGetEventItemValue( const ListItem_t * pxEventListItem )
+    {
+        const TCB_t * pxTCB;
+        TaskEventItemValue_t uxReturn;
+
+        traceENTER_uxTaskGetEventItemValue( pxEventListItem );
+
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        pxTCB = listGET_LIST_ITEM_OWNER( pxEventListItem );
+        configASSERT( pxTCB );
+
+        uxReturn = pxTCB->uxEventItemValue;
+
+        traceRETURN_uxTaskGetEventItemValue( uxReturn );
+
+        return uxReturn;
+    }
+
+#endif /* #if ( tskEVENT_ITEM_VALUE_IN_TCB != 0 ) */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_MUTEXES == 1 )
 
     TaskHandle_t pvTaskIncrementMutexHeldCount( void )
@@ -7686,18 +8817,32 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+#if ( ( configUSE_FAST_MUTEXES == 1 ) || ( configUSE_RW_LOCKS == 1 ) )
 
-    uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn,
-                                      BaseType_t xClearCountOnExit,
-                                      TickType_t xTicksToWait )
+    void vTaskIncrementMutexHeldCountOfHolder( TaskHandle_t xMutexHolder )
     {
-        uint32_t ulReturn;
-        BaseType_t xAlreadyYielded, xShouldBlock = pdFALSE;
+        TCB_t * const pxTCB = xMutexHolder;
 
-        traceENTER_ulTaskGenericNotifyTake( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait );
+        traceENTER_vTaskIncrementMutexHeldCountOfHolder( xMutexHolder );
 
-        configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+        configASSERT( pxTCB != NULL );
+
+        /* The holder's count is otherwise only changed from within critical
+         * sections, so this must be called from a critical section too. */
+        ( pxTCB->uxMutexesHeld )++;
+
+        traceRETURN_vTaskIncrementMutexHeldCountOfHolder();
+    }
+
+#endif /* ( configUSE_FAST_MUTEXES == 1 ) || ( configUSE_RW_LOCKS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+    static void prvWaitForNotificationCount( UBaseType_t uxIndexToWaitOn,
+                                             TickType_t xTicksToWait )
+    {
+        BaseType_t xAlreadyYielded, xShouldBlock = pdFALSE;
 
         /* If the notification count is zero, and if we are willing to wait for a
          * notification, then block the task and wait. */
@@ -7754,6 +8899,24 @@ TickType_t uxTaskResetEventItemValue( void )
                 mtCOVERAGE_TEST_MARKER();
             }
         }
+    }
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+    uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn,
+                                      BaseType_t xClearCountOnExit,
+                                      TickType_t xTicksToWait )
+    {
+        uint32_t ulReturn;
+
+        traceENTER_ulTaskGenericNotifyTake( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait );
+
+        configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+        prvWaitForNotificationCount( uxIndexToWaitOn, xTicksToWait );
 
         taskENTER_CRITICAL();
         {
@@ -7788,6 +8951,49 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+    uint32_t ulTaskGenericNotifyTakeUpTo( UBaseType_t uxIndexToWaitOn,
+                                          uint32_t ulMaxCount,
+                                          TickType_t xTicksToWait )
+    {
+        uint32_t ulReturn;
+
+        traceENTER_ulTaskGenericNotifyTakeUpTo( uxIndexToWaitOn, ulMaxCount, xTicksToWait );
+
+        configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+        configASSERT( ulMaxCount != 0U );
+
+        prvWaitForNotificationCount( uxIndexToWaitOn, xTicksToWait );
+
+        taskENTER_CRITICAL();
+        {
+            traceTASK_NOTIFY_TAKE( uxIndexToWaitOn );
+            ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ];
+
+            /* Take no more than ulMaxCount, leaving the rest pending. */
+            if( ulReturn > ulMaxCount )
+            {
+                ulReturn = ulMaxCount;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] -= ulReturn;
+            pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_ulTaskGenericNotifyTakeUpTo( ulReturn );
+
+        return ulReturn;
+    }
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
     BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn,
@@ -7918,6 +9124,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
         configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
         configASSERT( xTaskToNotify );
+
         pxTCB = xTaskToNotify;
 
         taskENTER_CRITICAL();
@@ -7927,89 +9134,112 @@ TickType_t uxTaskResetEventItemValue( void )
                 *pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
             }
 
-            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
-
-            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
-
-            switch( eAction )
+            if( ( eAction == eIncrementBy ) && ( ulValue == 0U ) )
             {
-                case eSetBits:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
-                    break;
+                /* Adding nothing leaves the notification state unchanged, so
+                 * a task waiting for a count is not unblocked with nothing to
+                 * take. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+            else
+            {
+                ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
 
-                case eIncrement:
-                    ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
-                    break;
+                pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
-                case eSetValueWithOverwrite:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-                    break;
+                switch( eAction )
+                {
+                    case eSetBits:
+                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
+                        break;
 
-                case eSetValueWithoutOverwrite:
+                    case eIncrement:
+                        ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+                        break;
 
-                    if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
-                    {
+                    case eIncrementBy:
+                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] += ulValue;
+                        break;
+
+                    case eSetValueWithOverwrite:
                         pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-                    }
-                    else
-                    {
-                        /* The value could not be written to the task. */
-                        xReturn = pdFAIL;
-                    }
+                        break;
 
-                    break;
+                    case eSetValueWithoutOverwrite:
 
-                case eNoAction:
+                        if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+                        {
+                            pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+                        }
+                        else
+                        {
+                            /* The value could not be written to the task. */
+                            xReturn = pdFAIL;
+                        }
 
-                    /* The task is being notified without its notify value being
-                     * updated. */
-                    break;
+                        break;
 
-                default:
+                    case eNoAction:
 
-                    /* Should not get here if all enums are handled.
-                     * Artificially force an assert by testing a value the
-                     * compiler can't assume is const. */
-                    configASSERT( xTickCount == ( TickType_t ) 0 );
+                        /* The task is being notified without its notify value being
+                         * updated. */
+                        break;
 
-                    break;
-            }
+                    default:
 
-            traceTASK_NOTIFY( uxIndexToNotify );
+                        /* Should not get here if all enums are handled.
+                         * Artificially force an assert by testing a value the
+                         * compiler can't assume is const. */
+                        configASSERT( xTickCount == ( TickType_t ) 0 );
 
-            /* If the task is in the blocked state specifically to wait for a
-             * notification then unblock it now. */
-            if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
-            {
-                listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                prvAddTaskToReadyList( pxTCB );
+                        break;
+                }
 
-                /* The task should not have been on an event list. */
-                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+                traceTASK_NOTIFY( uxIndexToNotify );
 
-                #if ( configUSE_TICKLESS_IDLE != 0 )
-                {
-                    /* If a task is blocked waiting for a notification then
-                     * xNextTaskUnblockTime might be set to the blocked task's time
-                     * out time.  If the task is unblocked for a reason other than
-                     * a timeout xNextTaskUnblockTime is normally left unchanged,
-                     * because it will automatically get reset to a new value when
-                     * the tick count equals xNextTaskUnblockTime.  However if
-                     * tickless idling is used it might be more important to enter
-                     * sleep mode at the earliest possible time - so reset
-                     * xNextTaskUnblockTime here to ensure it is updated at the
-                     * earliest possible time. */
-                    prvResetNextTaskUnblockTime();
-                }
-                #endif
+                /* If the task is in the blocked state specifically to wait for a
+                 * notification then unblock it now. */
+                if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+                {
+                    #if ( configUSE_WAIT_ANY == 1 )
+                    {
+                        if( pxTCB->pxWaitAnyObjects != NULL )
+                        {
+                            prvWaitAnyUnblocked( pxTCB );
+                        }
+                    }
+                    #endif
 
-                /* Check if the notified task has a priority above the currently
-                 * executing task. */
-                taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB );
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    prvAddTaskToReadyList( pxTCB );
+
+                    /* The task should not have been on an event list. */
+                    configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+
+                    #if ( configUSE_TICKLESS_IDLE != 0 )
+                    {
+                        /* If a task is blocked waiting for a notification then
+                         * xNextTaskUnblockTime might be set to the blocked task's time
+                         * out time.  If the task is unblocked for a reason other than
+                         * a timeout xNextTaskUnblockTime is normally left unchanged,
+                         * because it will automatically get reset to a new value when
+                         * the tick count equals xNextTaskUnblockTime.  However if
+                         * tickless idling is used it might be more important to enter
+                         * sleep mode at the earliest possible time - so reset
+                         * xNextTaskUnblockTime here to ensure it is updated at the
+                         * earliest possible time. */
+                        prvResetNextTaskUnblockTime();
+                    }
+                    #endif
+
+                    /* Check if the notified task has a priority above the currently
+                     * executing task. */
+                    taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
         }
         taskEXIT_CRITICAL();
@@ -8071,127 +9301,150 @@ TickType_t uxTaskResetEventItemValue( void )
                 *pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
             }
 
-            ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
-            pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
-
-            switch( eAction )
+            if( ( eAction == eIncrementBy ) && ( ulValue == 0U ) )
             {
-                case eSetBits:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
-                    break;
+                /* Adding nothing leaves the notification state unchanged, so
+                 * a task waiting for a count is not unblocked with nothing to
+                 * take. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+            else
+            {
+                ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+                pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
-                case eIncrement:
-                    ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
-                    break;
+                switch( eAction )
+                {
+                    case eSetBits:
+                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
+                        break;
 
-                case eSetValueWithOverwrite:
-                    pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-                    break;
+                    case eIncrement:
+                        ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+                        break;
 
-                case eSetValueWithoutOverwrite:
+                    case eIncrementBy:
+                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] += ulValue;
+                        break;
 
-                    if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
-                    {
+                    case eSetValueWithOverwrite:
                         pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
-                    }
-                    else
-                    {
-                        /* The value could not be written to the task. */
-                        xReturn = pdFAIL;
-                    }
+                        break;
 
-                    break;
+                    case eSetValueWithoutOverwrite:
 
-                case eNoAction:
+                        if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+                        {
+                            pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+                        }
+                        else
+                        {
+                            /* The value could not be written to the task. */
+                            xReturn = pdFAIL;
+                        }
 
-                    /* The task is being notified without its notify value being
-                     * updated. */
-                    break;
+                        break;
 
-                default:
+                    case eNoAction:
 
-                    /* Should not get here if all enums are handled.
-                     * Artificially force an assert by testing a value the
-                     * compiler can't assume is const. */
-                    configASSERT( xTickCount == ( TickType_t ) 0 );
-                    break;
-            }
+                        /* The task is being notified without its notify value being
+                         * updated. */
+                        break;
 
-            traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify );
+                    default:
 
-            /* If the task is in the blocked state specifically to wait for a
-             * notification then unblock it now. */
-            if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
-            {
-                /* The task should not have been on an event list. */
-                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+                        /* Should not get here if all enums are handled.
+                         * Artificially force an assert by testing a value the
+                         * compiler can't assume is const. */
+                        configASSERT( xTickCount == ( TickType_t ) 0 );
+                        break;
+                }
 
-                if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
-                {
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+                traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify );
 
-                    #if ( configUSE_TICKLESS_IDLE != 0 )
+                /* If the task is in the blocked state specifically to wait for a
+                 * notification then unblock it now. */
+                if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+                {
+                    #if ( configUSE_WAIT_ANY == 1 )
                     {
-                        /* If a task is blocked waiting for a notification then
-                         * xNextTaskUnblockTime might be set to the blocked task's time
-                         * out time.  If the task is unblocked for a reason other than
-                         * a timeout xNextTaskUnblockTime is normally left unchanged,
-                         * because it will automatically get reset to a new value when
-                         * the tick count equals xNextTaskUnblockTime.  However if
-                         * tickless idling is used it might be more important to enter
-                         * sleep mode at the earliest possible time - so reset
-                         * xNextTaskUnblockTime here to ensure it is updated at the
-                         * earliest possible time. */
-                        prvResetNextTaskUnblockTime();
+                        if( pxTCB->pxWaitAnyObjects != NULL )
+                        {
+                            prvWaitAnyUnblocked( pxTCB );
+                        }
                     }
                     #endif
-                }
-                else
-                {
-                    /* The delayed and ready lists cannot be accessed, so hold
-                     * this task pending until the scheduler is resumed. */
-                    listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
-                }
 
-                #if ( configNUMBER_OF_CORES == 1 )
-                {
-                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    /* The task should not have been on an event list. */
+                    configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+
+                    if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
                     {
-                        /* The notified task has a priority above the currently
-                         * executing task so a yield is required. */
-                        if( pxHigherPriorityTaskWoken != NULL )
+                        listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                        prvAddTaskToReadyList( pxTCB );
+
+                        #if ( configUSE_TICKLESS_IDLE != 0 )
                         {
-                            *pxHigherPriorityTaskWoken = pdTRUE;
+                            /* If a task is blocked waiting for a notification then
+                             * xNextTaskUnblockTime might be set to the blocked task's time
+                             * out time.  If the task is unblocked for a reason other than
+                             * a timeout xNextTaskUnblockTime is normally left unchanged,
+                             * because it will automatically get reset to a new value when
+                             * the tick count equals xNextTaskUnblockTime.  However if
+                             * tickless idling is used it might be more important to enter
+                             * sleep mode at the earliest possible time - so reset
+                             * xNextTaskUnblockTime here to ensure it is updated at the
+                             * earliest possible time. */
+                            prvResetNextTaskUnblockTime();
                         }
-
-                        /* Mark that a yield is pending in case the user is not
-                         * using the "xHigherPriorityTaskWoken" parameter to an ISR
-                         * safe FreeRTOS function. */
-                        xYieldPendings[ 0 ] = pdTRUE;
+                        #endif
                     }
                     else
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        /* The delayed and ready lists cannot be accessed, so hold
+                         * this task pending until the scheduler is resumed. */
+                        listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                     }
-                }
-                #else /* #if ( configNUMBER_OF_CORES == 1 ) */
-                {
-                    #if ( configUSE_PREEMPTION == 1 )
-                    {
-                        prvYieldForTask( pxTCB );
 
-                        if( xYieldPendings[ portGET_CORE_ID() ] == pdTRUE )
+                    #if ( configNUMBER_OF_CORES == 1 )
+                    {
+                        if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
                         {
+                            /* The notified task has a priority above the currently
+                             * executing task so a yield is required. */
                             if( pxHigherPriorityTaskWoken != NULL )
                             {
                                 *pxHigherPriorityTaskWoken = pdTRUE;
                             }
+
+                            /* Mark that a yield is pending in case the user is not
+                             * using the "xHigherPriorityTaskWoken" parameter to an ISR
+                             * safe FreeRTOS function. */
+                            xYieldPendings[ 0 ] = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+                    {
+                        #if ( configUSE_PREEMPTION == 1 )
+                        {
+                            prvYieldForTask( pxTCB );
+
+                            if( xYieldPendings[ portGET_CORE_ID() ] == pdTRUE )
+                            {
+                                if( pxHigherPriorityTaskWoken != NULL )
+                                {
+                                    *pxHigherPriorityTaskWoken = pdTRUE;
+                                }
+                            }
                         }
+                        #endif /* if ( configUSE_PREEMPTION == 1 ) */
                     }
-                    #endif /* if ( configUSE_PREEMPTION == 1 ) */
+                    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
                 }
-                #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
             }
         }
         taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
@@ -8257,6 +9510,15 @@ TickType_t uxTaskResetEventItemValue( void )
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
+                #if ( configUSE_WAIT_ANY == 1 )
+                {
+                    if( pxTCB->pxWaitAnyObjects != NULL )
+                    {
+                        prvWaitAnyUnblocked( pxTCB );
+                    }
+                }
+                #endif
+
                 /* The task should not have been on an event list. */
                 configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
 
@@ -8290,7 +9552,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
                 #if ( configNUMBER_OF_CORES == 1 )
                 {
-                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
                     {
                         /* The notified task has a priority above the currently
                          * executing task so a yield is required. */
@@ -8410,48 +9672,376 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-#if ( configGENERATE_RUN_TIME_STATS == 1 )
+#if ( configUSE_WAIT_ANY == 1 )
 
-    configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask )
+    BaseType_t xTaskWaitAny( WaitAnyObject_t * const pxObjects,
+                             UBaseType_t uxObjectCount,
+                             TickType_t xTicksToWait )
     {
-        TCB_t * pxTCB;
-        configRUN_TIME_COUNTER_TYPE ulTotalTime = 0, ulTimeSinceLastSwitchedIn = 0, ulTaskRunTime = 0;
+        TimeOut_t xTimeOut;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xReturn, xAlreadyYielded, xShouldBlock;
 
-        traceENTER_ulTaskGetRunTimeCounter( xTask );
+        traceENTER_xTaskWaitAny( pxObjects, uxObjectCount, xTicksToWait );
 
-        pxTCB = prvGetTCBFromHandle( xTask );
-        configASSERT( pxTCB != NULL );
+        configASSERT( pxObjects != NULL );
+        configASSERT( uxObjectCount > ( UBaseType_t ) 0U );
 
-        taskENTER_CRITICAL();
+        /* Cannot block if the scheduler is suspended. */
+        configASSERT( ( uxSchedulerSuspended == ( UBaseType_t ) 0U ) || ( xTicksToWait == ( TickType_t ) 0 ) );
+
+        for( ; ; )
         {
-            if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+            xShouldBlock = pdFALSE;
+
+            /* We suspend the scheduler here as prvAddCurrentTaskToDelayedList is a
+             * non-deterministic operation. */
+            vTaskSuspendAll();
             {
-                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalTime );
-                #else
-                    ulTotalTime = portGET_RUN_TIME_COUNTER_VALUE();
-                #endif
+                /* The objects are checked and the task registered on them in one
+                 * critical section, so an interrupt cannot make an object ready
+                 * between the two. */
+                taskENTER_CRITICAL();
+                {
+                    xReturn = prvWaitAnyGetReadyObject( pxObjects, uxObjectCount );
 
-                #if ( configNUMBER_OF_CORES == 1 )
-                    ulTimeSinceLastSwitchedIn = ulTotalTime - ulTaskSwitchedInTime[ 0 ];
-                #else
-                    ulTimeSinceLastSwitchedIn = ulTotalTime - ulTaskSwitchedInTime[ pxTCB->xTaskRunState ];
-                #endif
+                    if( ( xReturn == taskWAIT_ANY_TIMEOUT ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+                    {
+                        if( xEntryTimeSet == pdFALSE )
+                        {
+                            vTaskInternalSetTimeOutState( &xTimeOut );
+                            xEntryTimeSet = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        prvWaitAnyAddObjects( pxObjects, uxObjectCount );
+                        xShouldBlock = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                if( xShouldBlock == pdTRUE )
+                {
+                    traceTASK_WAIT_ANY_BLOCK( uxObjectCount );
+                    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            xAlreadyYielded = xTaskResumeAll();
+
+            if( xShouldBlock == pdFALSE )
+            {
+                break;
             }
 
-            ulTaskRunTime = pxTCB->ulRunTimeCounter + ulTimeSinceLastSwitchedIn;
+            /* Force a reschedule if xTaskResumeAll has not already done so. */
+            if( xAlreadyYielded == pdFALSE )
+            {
+                taskYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Remove the registrations left on the objects that did not
+             * unblock the task. */
+            taskENTER_CRITICAL();
+            {
+                prvWaitAnyRemoveObjects( pxCurrentTCB );
+            }
+            taskEXIT_CRITICAL();
+
+            /* After a timeout or an aborted delay the objects are checked once
+             * more, then the function returns without blocking again. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                xTicksToWait = ( TickType_t ) 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-        taskEXIT_CRITICAL();
 
-        traceRETURN_ulTaskGetRunTimeCounter( ulTaskRunTime );
+        traceRETURN_xTaskWaitAny( xReturn );
 
-        return ulTaskRunTime;
+        return xReturn;
     }
-
-#endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configGENERATE_RUN_TIME_STATS == 1 )
+    static BaseType_t prvWaitAnyGetReadyObject( const WaitAnyObject_t * const pxObjects,
+                                                UBaseType_t uxObjectCount )
+    {
+        BaseType_t xReturn = taskWAIT_ANY_TIMEOUT;
+        BaseType_t xReady;
+        UBaseType_t x;
+
+        for( x = ( UBaseType_t ) 0U; ( x < uxObjectCount ) && ( xReturn == taskWAIT_ANY_TIMEOUT ); x++ )
+        {
+            if( pxObjects[ x ].eType == eWaitAnyQueue )
+            {
+                xReady = ( pxQueueGetWaitAnyListRestricted( pxObjects[ x ].pvObject ) == NULL ) ? pdTRUE : pdFALSE;
+            }
+            else if( pxObjects[ x ].eType == eWaitAnyNotification )
+            {
+                configASSERT( pxObjects[ x ].uxIndex < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+                xReady = ( pxCurrentTCB->ucNotifyState[ pxObjects[ x ].uxIndex ] == taskNOTIFICATION_RECEIVED ) ? pdTRUE : pdFALSE;
+            }
+            else
+            {
+                #if ( configUSE_STREAM_BUFFERS == 1 )
+                {
+                    configASSERT( pxObjects[ x ].eType == eWaitAnyStreamBuffer );
+
+                    xReady = ( xStreamBufferIsEmpty( pxObjects[ x ].pvObject ) == pdFALSE ) ? pdTRUE : pdFALSE;
+                }
+                #else
+                {
+                    /* Stream buffers are not included in the build. */
+                    configASSERT( pdFALSE );
+                    xReady = pdFALSE;
+                }
+                #endif
+            }
+
+            if( xReady != pdFALSE )
+            {
+                xReturn = ( BaseType_t ) x;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvWaitAnyAddObjects( WaitAnyObject_t * const pxObjects,
+                                      UBaseType_t uxObjectCount )
+    {
+        List_t * pxEventList;
+        UBaseType_t x, uxIndex;
+
+        for( x = ( UBaseType_t ) 0U; x < uxObjectCount; x++ )
+        {
+            if( pxObjects[ x ].eType == eWaitAnyQueue )
+            {
+                /* Place the entry in priority order, as vTaskPlaceOnEventList()
+                 * does with the task's own event list item. */
+                pxEventList = pxQueueGetWaitAnyListRestricted( pxObjects[ x ].pvObject );
+                configASSERT( pxEventList != NULL );
+
+                vListInitialiseItem( &( pxObjects[ x ].xListItem ) );
+                listSET_LIST_ITEM_OWNER( &( pxObjects[ x ].xListItem ), pxCurrentTCB );
+                listSET_LIST_ITEM_VALUE( &( pxObjects[ x ].xListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority );
+                vListInsert( pxEventList, &( pxObjects[ x ].xListItem ) );
+            }
+            else
+            {
+                uxIndex = pxObjects[ x ].uxIndex;
+
+                #if ( configUSE_STREAM_BUFFERS == 1 )
+                {
+                    if( pxObjects[ x ].eType == eWaitAnyStreamBuffer )
+                    {
+                        uxIndex = uxStreamBufferSetWaitingReceiverRestricted( pxObjects[ x ].pvObject, pxCurrentTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+
+                /* Any stale notification on a stream buffer's index is
+                 * discarded, as xStreamBufferReceive() does. */
+                pxCurrentTCB->ucNotifyState[ uxIndex ] = taskWAITING_NOTIFICATION;
+            }
+        }
+
+        listINSERT_END( &xWaitAnyTaskList, &( pxCurrentTCB->xEventListItem ) );
+        pxCurrentTCB->pxWaitAnyObjects = pxObjects;
+        pxCurrentTCB->uxWaitAnyObjectCount = uxObjectCount;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvWaitAnyRemoveObjects( TCB_t * pxTCB )
+    {
+        WaitAnyObject_t * const pxObjects = pxTCB->pxWaitAnyObjects;
+        UBaseType_t x;
+
+        #if ( configUSE_STREAM_BUFFERS == 1 )
+            UBaseType_t uxIndex;
+        #endif
+
+        for( x = ( UBaseType_t ) 0U; x < pxTCB->uxWaitAnyObjectCount; x++ )
+        {
+            if( pxObjects[ x ].eType == eWaitAnyQueue )
+            {
+                if( listLIST_ITEM_CONTAINER( &( pxObjects[ x ].xListItem ) ) != NULL )
+                {
+                    ( void ) uxListRemove( &( pxObjects[ x ].xListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                #if ( configUSE_STREAM_BUFFERS == 1 )
+                {
+                    if( pxObjects[ x ].eType == eWaitAnyStreamBuffer )
+                    {
+                        /* A stream buffer that unblocked the task left a
+                         * notification at its index.  Discard it, as
+                         * xStreamBufferReceive() does, otherwise the next wait
+                         * for a notification at that index would return at
+                         * once.  Stream buffers notify with eNoAction, so the
+                         * notification value is unchanged. */
+                        uxIndex = uxStreamBufferSetWaitingReceiverRestricted( pxObjects[ x ].pvObject, NULL );
+                        pxTCB->ucNotifyState[ uxIndex ] = taskNOT_WAITING_NOTIFICATION;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+            }
+        }
+
+        /* A timeout leaves the task waiting for notifications. */
+        prvWaitAnyUnblocked( pxTCB );
+        pxTCB->pxWaitAnyObjects = NULL;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvWaitAnyUnblocked( TCB_t * pxTCB )
+    {
+        UBaseType_t uxIndex;
+
+        if( listIS_CONTAINED_WITHIN( &xWaitAnyTaskList, &( pxTCB->xEventListItem ) ) != pdFALSE )
+        {
+            listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        for( uxIndex = ( UBaseType_t ) 0U; uxIndex < ( UBaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; uxIndex++ )
+        {
+            if( pxTCB->ucNotifyState[ uxIndex ] == taskWAITING_NOTIFICATION )
+            {
+                pxTCB->ucNotifyState[ uxIndex ] = taskNOT_WAITING_NOTIFICATION;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static TCB_t * prvRemoveHeadOfEventList( const List_t * const pxEventList )
+    {
+        TCB_t * pxTCB = NULL;
+        ListItem_t * pxHeadEntry;
+
+        while( ( pxTCB == NULL ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+        {
+            pxHeadEntry = listGET_HEAD_ENTRY( pxEventList );
+
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_LIST_ITEM_OWNER( pxHeadEntry );
+            configASSERT( pxTCB );
+            listREMOVE_ITEM( pxHeadEntry );
+
+            if( pxHeadEntry != &( pxTCB->xEventListItem ) )
+            {
+                /* The entry was placed by xTaskWaitAny().  The task is only
+                 * still blocked there if its own event list item is in
+                 * xWaitAnyTaskList. */
+                if( listIS_CONTAINED_WITHIN( &xWaitAnyTaskList, &( pxTCB->xEventListItem ) ) != pdFALSE )
+                {
+                    prvWaitAnyUnblocked( pxTCB );
+                }
+                else
+                {
+                    pxTCB = NULL;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return pxTCB;
+    }
+
+#endif /* configUSE_WAIT_ANY */
+/*-----------------------------------------------------------*/
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+    configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        configRUN_TIME_COUNTER_TYPE ulTotalTime = 0, ulTimeSinceLastSwitchedIn = 0, ulTaskRunTime = 0;
+
+        traceENTER_ulTaskGetRunTimeCounter( xTask );
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+        configASSERT( pxTCB != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+            {
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalTime );
+                #else
+                    ulTotalTime = portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+
+                #if ( configNUMBER_OF_CORES == 1 )
+                    ulTimeSinceLastSwitchedIn = ulTotalTime - ulTaskSwitchedInTime[ 0 ];
+                #else
+                    ulTimeSinceLastSwitchedIn = ulTotalTime - ulTaskSwitchedInTime[ pxTCB->xTaskRunState ];
+                #endif
+            }
+
+            ulTaskRunTime = pxTCB->ulRunTimeCounter + ulTimeSinceLastSwitchedIn;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_ulTaskGetRunTimeCounter( ulTaskRunTime );
+
+        return ulTaskRunTime;
+    }
+
+#endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
 
     configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimePercent( const TaskHandle_t xTask )
     {
@@ -8576,6 +10166,281 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+    static void prvInsertIntoEdfReadyList( TCB_t * pxTCB )
+    {
+        List_t * const pxReadyList = &( pxReadyTasksLists[ configEDF_PRIORITY ] );
+        ListItem_t * pxIterator;
+        const TCB_t * pxOwner;
+
+        /* Find the first task that must run after pxTCB. */
+        for( pxIterator = listGET_HEAD_ENTRY( pxReadyList ); pxIterator != listGET_END_MARKER( pxReadyList ); pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            pxOwner = listGET_LIST_ITEM_OWNER( pxIterator );
+
+            if( prvEdfDeadlineIsEarlier( pxTCB, pxOwner ) != pdFALSE )
+            {
+                break;
+            }
+        }
+
+        /* listINSERT_END inserts ahead of pxIndex, so temporarily point the
+         * index at the insertion point.  The index of this list is not used
+         * for task selection so it is always returned to the end marker. */
+        pxReadyList->pxIndex = pxIterator;
+        listINSERT_END( pxReadyList, &( pxTCB->xStateListItem ) );
+        pxReadyList->pxIndex = ( ListItem_t * ) listGET_END_MARKER( pxReadyList );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvGetEdfDeadline( const TCB_t * pxTCB,
+                                         TickType_t * pxDeadline )
+    {
+        BaseType_t xReturn = pdTRUE;
+
+        if( pxTCB->xEdfDeadlineInherited != pdFALSE )
+        {
+            *pxDeadline = pxTCB->xEdfInheritedDeadline;
+        }
+        else if( pxTCB->xEdfPeriod != ( TickType_t ) 0U )
+        {
+            *pxDeadline = pxTCB->xEdfDeadline;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEdfDeadlineIsEarlier( const TCB_t * pxTCB,
+                                               const TCB_t * pxOtherTCB )
+    {
+        TickType_t xDeadline = 0U, xOtherDeadline = 0U;
+        BaseType_t xReturn = pdFALSE;
+
+        if( ( pxTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) &&
+            ( pxOtherTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) &&
+            ( prvGetEdfDeadline( pxTCB, &xDeadline ) != pdFALSE ) )
+        {
+            /* Deadlines are compared by their difference, treating a
+             * difference of more than half the tick range as negative, so the
+             * order remains correct when the absolute deadlines straddle a tick
+             * count overflow. */
+            if( ( prvGetEdfDeadline( pxOtherTCB, &xOtherDeadline ) == pdFALSE ) ||
+                ( ( TickType_t ) ( xDeadline - xOtherDeadline ) > ( portMAX_DELAY >> 1 ) ) )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULING == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+    static BaseType_t prvInheritEdfDeadline( TCB_t * const pxMutexHolderTCB )
+    {
+        TickType_t xDeadline = 0U, xHolderDeadline = 0U;
+        BaseType_t xReturn = pdFALSE;
+
+        if( prvGetEdfDeadline( pxCurrentTCB, &xDeadline ) != pdFALSE )
+        {
+            if( ( prvGetEdfDeadline( pxMutexHolderTCB, &xHolderDeadline ) == pdFALSE ) ||
+                ( ( TickType_t ) ( xDeadline - xHolderDeadline ) > ( portMAX_DELAY >> 1 ) ) )
+            {
+                pxMutexHolderTCB->xEdfInheritedDeadline = xDeadline;
+                pxMutexHolderTCB->xEdfDeadlineInherited = pdTRUE;
+
+                /* A mutex holder that is already ready at the EDF priority must
+                 * move forward in the ready list.  A holder at a lower priority is
+                 * placed by its new deadline when it inherits the priority. */
+                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configEDF_PRIORITY ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    ( void ) uxListRemove( &( pxMutexHolderTCB->xStateListItem ) );
+                    prvInsertIntoEdfReadyList( pxMutexHolderTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* ( ( configUSE_EDF_SCHEDULING == 1 ) && ( configUSE_MUTEXES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_CPU_BUDGET == 1 )
+
+    static void prvReplenishCpuBudget( TCB_t * pxTCB,
+                                       const TickType_t xConstTickCount )
+    {
+        /* The period has ended if the replenish time is not more than half
+         * the tick range ahead of the tick count, which keeps the test valid
+         * across a tick count overflow. */
+        if( ( pxTCB->ulCpuBudget != 0U ) &&
+            ( ( TickType_t ) ( xConstTickCount - pxTCB->xCpuBudgetReplenishTime ) <= ( portMAX_DELAY >> 1 ) ) )
+        {
+            const TickType_t xPeriodsEnded = ( ( TickType_t ) ( xConstTickCount - pxTCB->xCpuBudgetReplenishTime ) / pxTCB->xCpuBudgetPeriod ) + ( TickType_t ) 1U;
+
+            /* Periods stay aligned to when the budget was set.  Any periods
+             * that ended while the task was not running are skipped. */
+            pxTCB->ulCpuBudgetUsed = 0U;
+            pxTCB->xCpuBudgetReplenishTime += xPeriodsEnded * pxTCB->xCpuBudgetPeriod;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvThrottleCurrentTask( void )
+    {
+        BaseType_t xThrottle = pdFALSE;
+
+        prvReplenishCpuBudget( pxCurrentTCB, xTickCount );
+
+        /* Only a task that is still ready to run needs to be throttled, a
+         * task that is switching out because it blocked or was suspended has
+         * already left the ready list. */
+        if( ( pxCurrentTCB->ulCpuBudget != 0U ) &&
+            ( pxCurrentTCB->ulCpuBudgetUsed >= pxCurrentTCB->ulCpuBudget ) &&
+            ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ), &( pxCurrentTCB->xStateListItem ) ) != pdFALSE ) )
+        {
+            xThrottle = pdTRUE;
+
+            #if ( configUSE_MUTEXES == 1 )
+            {
+                /* Blocking a mutex holder would extend the time higher
+                 * priority tasks are blocked on the mutex, so the task is
+                 * throttled when it next switches out without a mutex. */
+                if( pxCurrentTCB->uxMutexesHeld != ( UBaseType_t ) 0U )
+                {
+                    xThrottle = pdFALSE;
+                }
+            }
+            #endif
+        }
+
+        if( xThrottle != pdFALSE )
+        {
+            const TickType_t xConstTickCount = xTickCount;
+            const TickType_t xTicksToRelease = pxCurrentTCB->xCpuBudgetReplenishTime - xConstTickCount;
+            ListItem_t * pxIterator;
+
+            ( pxCurrentTCB->uxCpuBudgetThrottles )++;
+
+            if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Every period in the list ends within half the tick range of the
+             * tick count, so ordering by the ticks remaining until each period
+             * ends remains correct across a tick count overflow. */
+            for( pxIterator = listGET_HEAD_ENTRY( &xThrottledTaskList ); pxIterator != listGET_END_MARKER( &xThrottledTaskList ); pxIterator = listGET_NEXT( pxIterator ) )
+            {
+                if( ( TickType_t ) ( listGET_LIST_ITEM_VALUE( pxIterator ) - xConstTickCount ) > xTicksToRelease )
+                {
+                    break;
+                }
+            }
+
+            listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), pxCurrentTCB->xCpuBudgetReplenishTime );
+
+            /* listINSERT_END inserts ahead of pxIndex, so temporarily point the
+             * index at the insertion point, as prvInsertIntoEdfReadyList()
+             * does. */
+            xThrottledTaskList.pxIndex = pxIterator;
+            listINSERT_END( &xThrottledTaskList, &( pxCurrentTCB->xStateListItem ) );
+            xThrottledTaskList.pxIndex = ( ListItem_t * ) listGET_END_MARKER( &xThrottledTaskList );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvReleaseThrottledTasks( const TickType_t xConstTickCount )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        while( listLIST_IS_EMPTY( &xThrottledTaskList ) == pdFALSE )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( &xThrottledTaskList );
+
+            if( ( TickType_t ) ( xConstTickCount - listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) ) > ( portMAX_DELAY >> 1 ) )
+            {
+                /* The period of the task at the head of the list has not
+                 * ended, so neither has that of any other throttled task. */
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+            prvReplenishCpuBudget( pxTCB, xConstTickCount );
+            prvAddTaskToReadyList( pxTCB );
+
+            #if ( configUSE_PREEMPTION == 1 )
+            {
+                if( taskPREEMPTS_CURRENT_TASK( pxTCB ) )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* #if ( configUSE_PREEMPTION == 1 ) */
+        }
+
+        return xSwitchRequired;
+    }
+
+#endif /* configUSE_TASK_CPU_BUDGET */
+/*-----------------------------------------------------------*/
+
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                                             const BaseType_t xCanBlockIndefinitely )
 {